@@ -41,7 +41,8 @@ uint64_t asn1::SessionId::get_next_id() {
 
 // Pool classes
 asn1::ASN1Pool::~ASN1Pool() {
-    for (int i = 0; i < asn1_node_count; i++) {
+    // pool might not be initialized (init_pool)
+    for (std::size_t i = 0; i < ASN1_POOL.size(); i++) {
         // children and tlv have to be cleared or double free corruption can
         // occur every asn1node frees its own children but in case of pooling
         // this has to be avoided since all individual child objects are
@@ -50,7 +51,7 @@ asn1::ASN1Pool::~ASN1Pool() {
         ASN1_POOL[i]->tlv = nullptr;
         delete ASN1_POOL[i];
     }
-    for (int i = 0; i < tlv_count; i++) delete TLV_POOL[i];
+    for (std::size_t i = 0; i < TLV_POOL.size(); i++) delete TLV_POOL[i];
 
     TLV_POOL.clear();
     ASN1_POOL.clear();
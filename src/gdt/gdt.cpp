@@ -234,6 +234,8 @@ static void generate_stream_complete(asn1::GDTMessage *gdt_orig_message,
         if(bdy != nullptr) gdt_out_message->_body->unlink(_session_id);
         // check is status is set
         if(hdr->_status != nullptr) hdr->_status->unlink(_out_session_id);
+        // unlink hop info if exists
+        if(hdr->_hop_info != nullptr) hdr->_hop_info->unlink(_session_id);
 
 
         // version
@@ -279,6 +281,39 @@ static void generate_stream_complete(asn1::GDTMessage *gdt_orig_message,
 
 }
 
+/**
+ * Get current time for hop trace
+ * @return  CLOCK_REALTIME in usec
+ */
+static uint64_t trace_now(){
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * Copy hop trace from original header and append current timestamp;
+ * if trace is full, oldest timestamps are kept
+ * @param[in]   oh                  Pointer to original GDT header
+ * @param[in]   _orig_session_id    Current session id of original GDT message
+ * @param[out]  out                 Output buffer (GDT_TRACE_MAX_HOPS * 8)
+ * @return      Length of new hop trace or 0 if trace is not present
+ */
+static unsigned int append_hop_trace(const asn1::Header *oh,
+                                     uint64_t _orig_session_id,
+                                     unsigned char *out){
+    if(!asn1::node_exists(oh->_hop_info, _orig_session_id)) return 0;
+    if(!asn1::node_exists(oh->_hop_info->_hop_trace, _orig_session_id)) return 0;
+    const asn1::TLVNode *tlv = oh->_hop_info->_hop_trace->linked_node->tlv;
+    unsigned int l = tlv->value_length - (tlv->value_length % 8);
+    if(l > (gdt::GDT_TRACE_MAX_HOPS - 1) * 8) l = (gdt::GDT_TRACE_MAX_HOPS - 1) * 8;
+    memcpy(out, tlv->value, l);
+    // append current hop
+    uint64_t ts = htobe64(trace_now());
+    memcpy(&out[l], &ts, sizeof(ts));
+    return l + sizeof(ts);
+}
+
 /**
  * U[date hop data
  * @param[in]   gdt_orig_message    Pointer to original GDT message
@@ -406,6 +441,14 @@ static int update_hop_info(asn1::GDTMessage *gdt_orig_message,
             prepare_needed = true;
         }
 
+        // hop trace
+        unsigned char trace_buff[gdt::GDT_TRACE_MAX_HOPS * 8];
+        unsigned int trace_len = append_hop_trace(oh, _orig_session_id, trace_buff);
+        if((trace_len > 0) && (hdr->_hop_info->_hop_trace == nullptr)){
+            hdr->_hop_info->set_hop_trace();
+            prepare_needed = true;
+        }
+
         // prepare only if one of optional fields was not set
         if(prepare_needed) gdt_out_message->prepare();
 
@@ -475,6 +518,14 @@ static int update_hop_info(asn1::GDTMessage *gdt_orig_message,
         hdr->_hop_info->_max_hops->set_linked_data(_session_id,
                                                    (unsigned char*)&max_hops,
                                                    sizeof(max_hops));
+        if(trace_len > 0){
+            hdr->_hop_info->_hop_trace->set_linked_data(_session_id,
+                                                        trace_buff,
+                                                        trace_len);
+
+        }else if(hdr->_hop_info->_hop_trace != nullptr){
+            hdr->_hop_info->_hop_trace->unlink(_session_id);
+        }
 
         copy_choice_selection(has_body, bdy, ob, _session_id);
 
@@ -544,8 +595,23 @@ static void set_destination_id(asn1::GDTMessage* gdt_orig_message,
             }
         }
 
+        // hop trace (hop info is kept only for traced streams)
+        int current_hop = 0;
+        int max_hops = 10;
+        unsigned char trace_buff[gdt::GDT_TRACE_MAX_HOPS * 8];
+        unsigned int trace_len = append_hop_trace(oh, _orig_session_id, trace_buff);
+        if(trace_len > 0){
+            if(hdr->_hop_info == nullptr){
+                hdr->set_hop_info();
+                prepare_needed = true;
+            }
+            if(hdr->_hop_info->_hop_trace == nullptr){
+                hdr->_hop_info->set_hop_trace();
+                prepare_needed = true;
+            }
+
         // unlink hop info if exists
-        if(hdr->_hop_info != nullptr) hdr->_hop_info->unlink(_session_id);
+        }else if(hdr->_hop_info != nullptr) hdr->_hop_info->unlink(_session_id);
 
 
         // status
@@ -640,6 +706,26 @@ static void set_destination_id(asn1::GDTMessage* gdt_orig_message,
 
         }
 
+        // hop trace
+        if(trace_len > 0){
+            const asn1::TLVNode *ch = oh->_hop_info->_current_hop->linked_node->tlv;
+            unsigned int ch_len = ch->value_length;
+            memcpy(&current_hop,
+                   ch->value,
+                   (ch_len > sizeof(current_hop) ? sizeof(current_hop) : ch_len));
+            current_hop = htobe32(be32toh(current_hop) + 1);
+            max_hops = htobe32(max_hops);
+            hdr->_hop_info->_current_hop->set_linked_data(_session_id,
+                                                          (unsigned char*)&current_hop,
+                                                          sizeof(current_hop));
+            hdr->_hop_info->_max_hops->set_linked_data(_session_id,
+                                                       (unsigned char*)&max_hops,
+                                                       sizeof(max_hops));
+            hdr->_hop_info->_hop_trace->set_linked_data(_session_id,
+                                                        trace_buff,
+                                                        trace_len);
+        }
+
         copy_choice_selection(has_body, bdy, ob, _session_id);
 
         // encode
@@ -752,6 +838,8 @@ static int register_client(gdt::GDTClient* client, const char* dest_daemon_type)
                     if(!reg->_params->has_linked_data(*in_sess)) goto stream_pld_sent;
                     // params
                     p = reg->_params;
+                    // capabilities are optional (older peers)
+                    client->set_peer_caps(gdt::GDT_CAP_NONE);
 
                     // process params
                     for(unsigned int i = 0; i<p->children.size(); i++){
@@ -794,6 +882,15 @@ static int register_client(gdt::GDTClient* client, const char* dest_daemon_type)
                                 ++adone.status;
                                 break;
 
+                                // capabilities (optional)
+                            case asn1::ParameterType::_pt_mink_gdt_capabilities:
+                                if(tmp_val_l == sizeof(uint32_t)){
+                                    uint32_t caps;
+                                    memcpy(&caps, tmp_val, sizeof(uint32_t));
+                                    client->set_peer_caps(be32toh(caps));
+                                }
+                                break;
+
                             default:
                                 break;
 
@@ -852,13 +949,15 @@ stream_timeout:
         uint32_t pm_dtype = htobe32(asn1::ParameterType::_pt_mink_daemon_type);
         uint32_t pm_did = htobe32(asn1::ParameterType::_pt_mink_daemon_id);
         uint32_t pm_router = htobe32(asn1::ParameterType::_pt_mink_router_status);
+        uint32_t pm_caps = htobe32(asn1::ParameterType::_pt_mink_gdt_capabilities);
         uint32_t reg_action = asn1::RegistrationAction::_ra_reg_request;
         int router_flag = (client->get_session()->is_router() ? 1 : 0);
+        uint32_t caps = htobe32(gdt::GDT_LOCAL_CAPS);
         // set params
         if(gdtm->_body->_reg->_params == nullptr){
             gdtm->_body->_reg->set_params();
             // set children, allocate more
-            for(int i = 0; i<3; i++){
+            for(int i = 0; i<4; i++){
                 gdtm->_body->_reg->_params->set_child(i);
                 gdtm->_body->_reg->_params->get_child(i)->set_value();
                 gdtm->_body->_reg->_params->get_child(i)->_value->set_child(0);
@@ -870,9 +969,9 @@ stream_timeout:
             // unlink params before setting new ones
         }else{
             int cc = gdtm->_body->_reg->_params->children.size();
-            if(cc < 3){
+            if(cc < 4){
                 // set children, allocate more
-                for(int i = cc; i<3; i++){
+                for(int i = cc; i<4; i++){
                     gdtm->_body->_reg->_params->set_child(i);
                     gdtm->_body->_reg->_params->get_child(i)->set_value();
                     gdtm->_body->_reg->_params->get_child(i)->_value->set_child(0);
@@ -881,9 +980,9 @@ stream_timeout:
                 // prepare
                 gdtm->prepare();
 
-            }else if(cc > 3){
-                // remove extra children if used in some other session, only 2 needed
-                for(int i = 3; i<cc; i++) gdtm->_body->_reg->_params->get_child(i)->unlink(1);
+            }else if(cc > 4){
+                // remove extra children if used in some other session, only 4 needed
+                for(int i = 4; i<cc; i++) gdtm->_body->_reg->_params->get_child(i)->unlink(1);
             }
         }
         asn1::RegistrationMessage *reg = gdtm->_body->_reg;
@@ -927,6 +1026,19 @@ stream_timeout:
            ->get_child(0)
            ->set_linked_data(1, (unsigned char*)&router_flag, 1);
 
+        // set capabilities
+        reg->_params
+           ->get_child(3)
+           ->_id
+           ->set_linked_data(1, (unsigned char*)&pm_caps, sizeof(uint32_t));
+        reg->_params
+           ->get_child(3)
+           ->_value
+           ->get_child(0)
+           ->set_linked_data(1, (unsigned char*)&caps, sizeof(uint32_t));
+
+        // registration is control traffic
+        gdt_stream->set_priority(gdt::GDT_PRIO_CONTROL);
         // start stream
         gdt_stream->send(true);
 
@@ -1113,6 +1225,8 @@ void* gdt::HeartbeatInfo::heartbeat_loop(void* args){
                     gdt_stream->set_callback(GDT_ET_PAYLOAD_SENT, tmp_sent);
                     // set sequence flag
                     gdt_stream->set_sequence_flag(GDT_SF_HEARTBEAT);
+                    // heartbeats must not wait behind bulk traffic
+                    gdt_stream->set_priority(GDT_PRIO_CONTROL);
                     // start stream
                     gdt_stream->send(false);
 
@@ -1290,7 +1404,9 @@ gdt::GDTPayload::GDTPayload() : free_on_send(true),
                                 raw_data(nullptr),
                                 raw_data_length(0),
                                 client(nullptr),
-                                stream(nullptr) {}
+                                stream(nullptr),
+                                priority(GDT_PRIO_NORMAL),
+                                ts_queued(0) {}
 
 gdt::GDTPayload::~GDTPayload() = default;
 
@@ -1329,9 +1445,107 @@ gdt::GDTStats& gdt::GDTStats::operator=(GDTStats& rhs){
     strm_alloc_errors.set(rhs.strm_alloc_errors.get());
     strm_timeout.set(rhs.strm_timeout.get());
     strm_loopback.set(rhs.strm_loopback.get());
+    queue_depth.set(rhs.queue_depth.get());
+    queue_hwm.set(rhs.queue_hwm.get());
+    queue_congested.set(rhs.queue_congested.get());
+    lat_stream = rhs.lat_stream;
+    lat_queue = rhs.lat_queue;
+    lat_process = rhs.lat_process;
+    lat_trace = rhs.lat_trace;
+    return *this;
+}
+
+// GDTLatencyHistogram
+gdt::GDTLatencyHistogram& gdt::GDTLatencyHistogram::operator=(GDTLatencyHistogram& rhs){
+    for(unsigned int i = 0; i < BUCKETS; i++) buckets[i].set(rhs.buckets[i].get());
+    count.set(rhs.count.get());
+    max.set(rhs.max.get());
     return *this;
 }
 
+unsigned int gdt::GDTLatencyHistogram::bucket(uint64_t usec){
+    // linear range
+    if(usec < (1 << SUB_BITS)) return usec;
+    // power of two and sub-bucket
+    unsigned int exp = 63 - __builtin_clzll(usec);
+    if(exp >= MAX_EXP) return BUCKETS - 1;
+    return (1 << SUB_BITS) +
+           (exp - SUB_BITS) * (1 << SUB_BITS) +
+           ((usec >> (exp - SUB_BITS)) & ((1 << SUB_BITS) - 1));
+}
+
+uint64_t gdt::GDTLatencyHistogram::bucket_value(unsigned int idx){
+    // linear range
+    if(idx < (1 << SUB_BITS)) return idx;
+    // upper bound of sub-bucket
+    unsigned int exp = (idx - (1 << SUB_BITS)) / (1 << SUB_BITS) + SUB_BITS;
+    uint64_t sub = (idx - (1 << SUB_BITS)) % (1 << SUB_BITS);
+    uint64_t low = ((uint64_t)1 << exp) | (sub << (exp - SUB_BITS));
+    return low + ((uint64_t)1 << (exp - SUB_BITS)) - 1;
+}
+
+void gdt::GDTLatencyHistogram::record(uint64_t usec){
+    buckets[bucket(usec)].add_fetch(1);
+    count.add_fetch(1);
+    // max
+    uint64_t m = max.get();
+    while((usec > m) && (max.comp_swap(m, usec) != m)) m = max.get();
+}
+
+uint64_t gdt::GDTLatencyHistogram::percentile(unsigned int permille){
+    uint64_t total = count.get();
+    if(total == 0) return 0;
+    if(permille > 1000) permille = 1000;
+    // rank of requested sample
+    uint64_t rank = (total * permille + 999) / 1000;
+    if(rank == 0) rank = 1;
+    uint64_t c = 0;
+    for(unsigned int i = 0; i < BUCKETS; i++){
+        c += buckets[i].get();
+        if(c >= rank){
+            uint64_t v = bucket_value(i);
+            uint64_t m = max.get();
+            return (v < m ? v : m);
+        }
+    }
+    return max.get();
+}
+
+uint64_t gdt::GDTLatencyHistogram::get_count(){
+    return count.get();
+}
+
+uint64_t gdt::GDTLatencyHistogram::get_max(){
+    return max.get();
+}
+
+uint64_t gdt::GDTLatencyHistogram::now(){
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int gdt::get_hop_trace(asn1::GDTMessage *msg,
+                       uint64_t session_id,
+                       uint64_t *ts,
+                       unsigned int *count){
+    if((msg == nullptr) || (ts == nullptr) || (count == nullptr)) return 1;
+    const asn1::Header *hdr = msg->_header;
+    if(!asn1::node_exists(hdr->_hop_info, session_id)) return 1;
+    if(!asn1::node_exists(hdr->_hop_info->_hop_trace, session_id)) return 1;
+    const asn1::TLVNode *tlv = hdr->_hop_info->_hop_trace->linked_node->tlv;
+    // copy timestamps
+    unsigned int c = tlv->value_length / 8;
+    if(c > *count) c = *count;
+    for(unsigned int i = 0; i < c; i++){
+        uint64_t tmp;
+        memcpy(&tmp, &tlv->value[i * 8], sizeof(tmp));
+        ts[i] = be64toh(tmp);
+    }
+    *count = c;
+    return 0;
+}
+
 // GDTStateMachine
 gdt::GDTStateMachine::GDTStateMachine() : gdtc(nullptr),
                                           res(0),
@@ -1349,7 +1563,9 @@ gdt::GDTStateMachine::GDTStateMachine() : gdtc(nullptr),
                                           seq_flag_tlv(nullptr),
                                           seq_num_tlv(nullptr),
                                           header(nullptr),
-                                          uuid_tlv(nullptr) {
+                                          uuid_tlv(nullptr),
+                                          ts_decode(0),
+                                          traced(false) {
     memset(d_id, 0, sizeof(d_id));
     memset(d_type, 0, sizeof(d_type));
     memset(tmp_buff, 0, sizeof(tmp_buff));
@@ -1385,6 +1601,10 @@ void gdt::GDTStateMachine::init(GDTClient* _gdtc){
 
 }
 
+void gdt::GDTStateMachine::record_in_latency(){
+    gdtc->in_stats.lat_process.record(GDTLatencyHistogram::now() - ts_decode);
+}
+
 void gdt::GDTStateMachine::process_sf_stream_complete(GDTStream* tmp_stream){
     // update timestamp
     tmp_stream->set_timestamp(time(nullptr));
@@ -1411,6 +1631,7 @@ void gdt::GDTStateMachine::process_sf_stream_complete(GDTStream* tmp_stream){
     cb_stream_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_IN_MSG_ID, &tmp_in_session_id);
     // GDT_ET_STREAM_NEXT event
     tmp_stream->process_callback(GDT_ET_STREAM_END, &cb_stream_args);
+    record_in_latency();
 
 }
 
@@ -1437,6 +1658,7 @@ void gdt::GDTStateMachine::process_sf_end(GDTStream* tmp_stream, bool remove_str
         cb_stream_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_IN_MSG_ID, &tmp_in_session_id);
         // GDT_ET_STREAM_END event
         tmp_stream->process_callback(GDT_ET_STREAM_END, &cb_stream_args);
+        record_in_latency();
 
         // inc sequenuce number
         if(tmp_stream->get_seq_reply_received()) tmp_stream->inc_sequence_num();
@@ -1518,6 +1740,7 @@ void gdt::GDTStateMachine::process_sf_continue(GDTStream* tmp_stream, bool remov
         cb_stream_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_MEM_SWITCH, &mem_switch);
         // GDT_ET_STREAM_NEXT event
         tmp_stream->process_callback(GDT_ET_STREAM_NEXT, &cb_stream_args);
+        record_in_latency();
 
         // inc sequenuce number
         if(tmp_stream->get_seq_reply_received()) tmp_stream->inc_sequence_num();
@@ -1673,6 +1896,9 @@ void gdt::GDTStateMachine::run(){
                     // next in session id
                     tmp_in_session_id = _in_session_id.get_next_id(&gdt_in_message);
 
+                    // in processing latency start
+                    ts_decode = GDTLatencyHistogram::now();
+
                     // decode GDT packet
                     res = asn1::decode((unsigned char*)tmp_buff,
                                        sctp_len,
@@ -1805,6 +2031,13 @@ void gdt::GDTStateMachine::run(){
                                     gdtp->client = route_c;
                                     gdtp->sctp_sid = rcvinfo.sinfo_stream;
                                     gdtp->clear_callbacks();
+                                    // priority class is not on the wire; forward
+                                    // heartbeats as control traffic, everything
+                                    // else (including BULK) as NORMAL
+                                    gdtp->priority =
+                                        (gdt_in_message._header->_sequence_flag->linked_node->tlv->value[0] ==
+                                         asn1::SequenceFlag::_sf_heartbeat ?
+                                         GDT_PRIO_CONTROL : GDT_PRIO_NORMAL);
 
                                     // set new GDT header destination id if destination is final
                                     if(!route_c->is_router()){
@@ -1881,6 +2114,18 @@ void gdt::GDTStateMachine::run(){
                         seq_num_tlv = header->_sequence_num->linked_node->tlv;
                         uuid_tlv = header->_uuid->linked_node->tlv;
 
+                        // hop trace (origin to local delivery)
+                        uint64_t trace_origin = 0;
+                        unsigned int trace_count = 1;
+                        traced = (get_hop_trace(&gdt_in_message,
+                                                tmp_in_session_id,
+                                                &trace_origin,
+                                                &trace_count) == 0);
+                        if(traced && (trace_count > 0)){
+                            uint64_t tm_now = trace_now();
+                            if(tm_now > trace_origin) gdtc->in_stats.lat_trace.record(tm_now - trace_origin);
+                        }
+
                         // update timestamp
                         gdtc->timestamp.set(time(nullptr));
 
@@ -1980,6 +2225,7 @@ void gdt::GDTStateMachine::run(){
                                 gdtp->client = gdtc;
                                 gdtp->sctp_sid = rcvinfo.sinfo_stream;
                                 gdtp->clear_callbacks();
+                                gdtp->priority = GDT_PRIO_CONTROL;
 
                                 // set sequence flag
                                 gdts->set_sequence_flag(GDT_SF_HEARTBEAT);
@@ -2058,6 +2304,7 @@ void gdt::GDTStateMachine::run(){
 
                             // GDT_ET_DATAGRAM event
                             gdtc->process_callback(GDT_ET_DATAGRAM, &cb_args);
+                            record_in_latency();
 
                             // send payload
                             gdtc->internal_out_queue.push(1, gdtp);
@@ -2122,6 +2369,7 @@ void gdt::GDTStateMachine::run(){
                                 tmp_stream->clear_callbacks();
                                 tmp_stream->reset(false);
                                 tmp_stream->set_client(gdtc);
+                                tmp_stream->set_trace(traced);
                                 // add to list of active streams
                                 if(!loopback) gdtc->add_stream(tmp_stream);
 
@@ -2149,6 +2397,7 @@ void gdt::GDTStateMachine::run(){
 
                                 // GDT_ET_STREAM_NEW event
                                 gdtc->process_callback(GDT_ET_STREAM_NEW, &cb_args);
+                                record_in_latency();
 
                                 // generate ACK
                                 gdtc->generate_ack(&gdt_in_message,
@@ -2424,6 +2673,7 @@ void gdt::GDTStateMachine::run(){
 
                             // GDT_ET_DATAGRAM event
                             gdtc->process_callback(GDT_ET_DATAGRAM, &cb_args);
+                            record_in_latency();
 
                         }
 
@@ -2473,6 +2723,7 @@ void gdt::GDTClient::init(){
     client_id = -1;
     client_socket = -1;
     router = false;
+    peer_caps.set(GDT_CAP_NONE);
     in_thread = 0;
     out_thread = 0;
     timeout_thread = 0;
@@ -2494,8 +2745,25 @@ void gdt::GDTClient::init(){
 
     // queues
     out_queue.set_capacity(max_concurrent_streams);
+    ctrl_out_queue.set_capacity(max_concurrent_streams);
+    bulk_out_queue.set_capacity(max_concurrent_streams);
     internal_out_queue.init(max_concurrent_streams);
 
+    // DRR (bulk traffic gets 1/5 of bandwidth under load)
+    set_prio_weight(GDT_PRIO_NORMAL, 4);
+    set_prio_weight(GDT_PRIO_BULK, 1);
+    memset(drr_deficit, 0, sizeof(drr_deficit));
+    drr_class = GDT_PRIO_NORMAL;
+    drr_active = false;
+    memset(prio_staged, 0, sizeof(prio_staged));
+
+    // backpressure
+    pthread_mutex_init(&mtx_out_cap, nullptr);
+    pthread_cond_init(&cond_out_cap, nullptr);
+    out_congested.set(false);
+    out_low_pending.set(false);
+    set_out_watermarks(50, 90);
+
     // memory pools
     mc_pool.init(max_concurrent_streams);
     mc_pool.construct_objects();
@@ -2620,6 +2888,8 @@ gdt::GDTClient::~GDTClient(){
 
     // destory mutexes
     pthread_mutex_destroy(&mtx_streams);
+    pthread_mutex_destroy(&mtx_out_cap);
+    pthread_cond_destroy(&cond_out_cap);
     pthread_spin_destroy(&slock_callback);
     pthread_spin_destroy(&slock_uuid);
 }
@@ -2698,13 +2968,70 @@ int gdt::GDTClient::deallocate_stream_pool(GDTStream* stream){
 }
 
 gdt::GDTStream* gdt::GDTClient::allocate_stream_pool(){
-    return stream_pool.allocate_constructed();
+    GDTStream* stream = stream_pool.allocate_constructed();
+    if(stream == nullptr) return nullptr;
+    // default priority
+    stream->get_gdt_payload()->priority = GDT_PRIO_NORMAL;
+    return stream;
+}
+
+void gdt::GDTClient::set_out_watermarks(unsigned int low_pct, unsigned int high_pct){
+    if(high_pct > 100) high_pct = 100;
+    if(low_pct > high_pct) low_pct = high_pct;
+    out_wm_low = max_concurrent_streams * low_pct / 100;
+    out_wm_high = max_concurrent_streams * high_pct / 100;
+}
+
+unsigned int gdt::GDTClient::get_out_depth(){
+    return out_stats.queue_depth.get();
+}
+
+bool gdt::GDTClient::is_out_congested(){
+    return out_congested.get();
+}
+
+int gdt::GDTClient::wait_out_capacity(unsigned int timeout_ms){
+    // fast path
+    if(!out_congested.get()) return 0;
+    if(timeout_ms == 0) return 1;
+    // deadline
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += timeout_ms / 1000;
+    ts.tv_nsec += (timeout_ms % 1000) * 1000000;
+    if(ts.tv_nsec >= 1000000000){
+        ++ts.tv_sec;
+        ts.tv_nsec -= 1000000000;
+    }
+    // wait
+    int res = 0;
+    pthread_mutex_lock(&mtx_out_cap);
+    while(out_congested.get() && (res == 0))
+        res = pthread_cond_timedwait(&cond_out_cap, &mtx_out_cap, &ts);
+    pthread_mutex_unlock(&mtx_out_cap);
+    return (out_congested.get() ? 1 : 0);
 }
 
 int gdt::GDTClient::push_out_queue(GDTPayload* payload){
     if(payload != nullptr){
-        bool res = out_queue.push(payload);
-        return !res;
+        payload->ts_queued = GDTLatencyHistogram::now();
+        // control traffic (heartbeats, registration) has its own
+        // queue, it must not wait behind or be rejected by bulk
+        if(payload->priority == GDT_PRIO_CONTROL)
+            return (ctrl_out_queue.push(payload) ? 0 : 1);
+        bool res = (payload->priority == GDT_PRIO_BULK ?
+                    bulk_out_queue.push(payload) :
+                    out_queue.push(payload));
+        if(!res) return 1;
+        // queue depth and high watermark
+        uint64_t depth = out_stats.queue_depth.add_fetch(1);
+        uint64_t hwm = out_stats.queue_hwm.get();
+        while((depth > hwm) && (out_stats.queue_hwm.comp_swap(hwm, depth) != hwm))
+            hwm = out_stats.queue_hwm.get();
+        // congestion (comp_swap returns previous value)
+        if((depth >= out_wm_high) && !out_congested.comp_swap(false, true))
+            out_stats.queue_congested.add_fetch(1);
+        return 0;
 
     }
 
@@ -2712,11 +3039,103 @@ int gdt::GDTClient::push_out_queue(GDTPayload* payload){
 }
 gdt::GDTPayload* gdt::GDTClient::pop_out_queue(){
     GDTPayload* tmp = nullptr;
-    out_queue.pop(&tmp);
+    // control queue is not part of queue depth
+    if(ctrl_out_queue.pop(&tmp) && tmp != nullptr) return tmp;
+    tmp = pop_out_queue(GDT_PRIO_NORMAL);
+    return (tmp != nullptr ? tmp : pop_out_queue(GDT_PRIO_BULK));
+}
+
+gdt::GDTPayload* gdt::GDTClient::pop_out_queue(GDTPriority prio){
+    GDTPayload* tmp = nullptr;
+    if(prio == GDT_PRIO_BULK) bulk_out_queue.pop(&tmp);
+    else out_queue.pop(&tmp);
+    if(tmp == nullptr) return nullptr;
+    // queue depth
+    uint64_t depth = out_stats.queue_depth.sub_fetch(1);
+    // release producers if drained below low watermark
+    if((depth <= out_wm_low) && out_congested.comp_swap(true, false)){
+        pthread_mutex_lock(&mtx_out_cap);
+        pthread_cond_broadcast(&cond_out_cap);
+        pthread_mutex_unlock(&mtx_out_cap);
+        // GDT_ET_OUT_QUEUE_LOW event (processed in OUT thread)
+        out_low_pending.set(true);
+    }
     return tmp;
 
 }
 
+gdt::GDTPayload* gdt::GDTClient::schedule_out(){
+    GDTPayload* tmp = nullptr;
+    // move to priority class queues (internal queue
+    // is bounded by stream pool, move all)
+    while(internal_out_queue.pop(&tmp) == 0){
+        prio_out_queue[tmp->priority].push_back(tmp);
+        prio_staged[tmp->priority] += tmp->raw_data_length;
+    }
+    // control queue (bounded by stream pool, move all)
+    while(ctrl_out_queue.pop(&tmp) && tmp != nullptr){
+        prio_out_queue[GDT_PRIO_CONTROL].push_back(tmp);
+        prio_staged[GDT_PRIO_CONTROL] += tmp->raw_data_length;
+        tmp = nullptr;
+    }
+    // class out queues, only what one DRR quantum of each
+    // class needs; the rest stays in ring buffers (backpressure)
+    for(unsigned int i = GDT_PRIO_NORMAL; i < GDT_PRIO_COUNT; i++){
+        while((prio_staged[i] < drr_quantum[i].get()) &&
+              ((tmp = pop_out_queue(static_cast<GDTPriority>(i))) != nullptr)){
+            prio_out_queue[i].push_back(tmp);
+            prio_staged[i] += tmp->raw_data_length;
+        }
+    }
+
+    // control traffic first
+    std::deque<GDTPayload*>* q = &prio_out_queue[GDT_PRIO_CONTROL];
+    if(!q->empty()){
+        tmp = q->front();
+        q->pop_front();
+        prio_staged[GDT_PRIO_CONTROL] -= tmp->raw_data_length;
+        return tmp;
+    }
+
+    // DRR (quantum >= max payload size, two
+    // passes are enough to find a payload)
+    for(unsigned int i = 0; i < 2 * GDT_PRIO_COUNT; i++){
+        q = &prio_out_queue[drr_class];
+        // empty class, reset deficit
+        if(q->empty()){
+            drr_deficit[drr_class] = 0;
+
+        }else{
+            // new round for current class
+            if(!drr_active){
+                drr_deficit[drr_class] += drr_quantum[drr_class].get();
+                drr_active = true;
+            }
+            // send if deficit allows it
+            tmp = q->front();
+            if(tmp->raw_data_length <= drr_deficit[drr_class]){
+                drr_deficit[drr_class] -= tmp->raw_data_length;
+                q->pop_front();
+                prio_staged[drr_class] -= tmp->raw_data_length;
+                return tmp;
+            }
+        }
+        // next class
+        drr_class = (drr_class + 1 < static_cast<unsigned int>(GDT_PRIO_COUNT) ?
+                     drr_class + 1 :
+                     static_cast<unsigned int>(GDT_PRIO_NORMAL));
+        drr_active = false;
+    }
+
+    // all queues empty
+    return nullptr;
+}
+
+void gdt::GDTClient::set_prio_weight(GDTPriority prio, unsigned int weight){
+    if(prio >= GDT_PRIO_COUNT) return;
+    drr_quantum[prio].set((weight > 0 ? weight : 1) * MEM_CSIZE);
+}
+
 int gdt::GDTClient::generate_uuid(unsigned char* out){
     if(out == nullptr) return 1;
     pthread_spin_lock(&slock_uuid);
@@ -2768,6 +3187,14 @@ bool gdt::GDTClient::is_router() const {
     return router;
 }
 
+void gdt::GDTClient::set_peer_caps(uint32_t _caps){
+    peer_caps.set(_caps);
+}
+
+bool gdt::GDTClient::has_peer_cap(GDTCapability cap){
+    return (peer_caps.get() & cap) == cap;
+}
+
 
 
 int gdt::GDTClient::send(unsigned int sctp_stream_id,
@@ -3121,6 +3548,9 @@ void gdt::GDTClient::remove_stream(const gdt::GDTStream* _stream){
     pthread_mutex_lock(&mtx_streams);
     for(unsigned int i = 0; i<streams.size(); i++){
         if(streams[i] == _stream){
+            // stream latency
+            GDTStats *st = (_stream->initiator == GDT_SIT_LOCAL ? &out_stats : &in_stats);
+            st->lat_stream.record(GDTLatencyHistogram::now() - _stream->created_ts);
             streams.erase(streams.begin() + i);
             if(streams.empty()) streams_active.set(false);
             break;
@@ -3391,6 +3821,18 @@ void gdt::GDTClient::generate_stream_header(asn1::GDTMessage* gdt_out_message,
             bdy->unlink(_session_id);
         }
 
+        // hop trace
+        if(stream->trace){
+            if(hdr->_hop_info == nullptr){
+                hdr->set_hop_info();
+                prepare_needed = true;
+            }
+            if(hdr->_hop_info->_hop_trace == nullptr){
+                hdr->_hop_info->set_hop_trace();
+                prepare_needed = true;
+            }
+        }
+
         // prepare only if one of optional fields was not set
         if(prepare_needed) gdt_out_message->prepare();
 
@@ -3399,6 +3841,23 @@ void gdt::GDTClient::generate_stream_header(asn1::GDTMessage* gdt_out_message,
         // unlink status if exists
         if(hdr->_status != nullptr) hdr->_status->unlink(_session_id);
 
+        // hop trace (origin timestamp), data stored in stream
+        if(stream->trace){
+            stream->trace_hops[0] = htobe32(0);
+            stream->trace_hops[1] = htobe32(10);
+            stream->trace_ts = htobe64(trace_now());
+            hdr->_hop_info->_current_hop->set_linked_data(_session_id,
+                                                          (unsigned char*)&stream->trace_hops[0],
+                                                          sizeof(uint32_t));
+            hdr->_hop_info->_max_hops->set_linked_data(_session_id,
+                                                       (unsigned char*)&stream->trace_hops[1],
+                                                       sizeof(uint32_t));
+            hdr->_hop_info->_hop_trace->set_linked_data(_session_id,
+                                                        (unsigned char*)&stream->trace_ts,
+                                                        sizeof(uint64_t));
+
+        }else if(hdr->_hop_info != nullptr) hdr->_hop_info->unlink(_session_id);
+
         // header
         int ver = _GDT_VERSION_;
         hdr->_version->set_linked_data(_session_id, (unsigned char*)&ver, 1);
@@ -3583,6 +4042,9 @@ void gdt::GDTClient::generate_ack(asn1::GDTMessage* gdt_orig_message,
             bdy->unlink(_session_id);
         }
 
+        // unlink hop info if exists
+        if(hdr->_hop_info != nullptr) hdr->_hop_info->unlink(_session_id);
+
         // version
         int ver = _GDT_VERSION_;
         hdr->_version->set_linked_data(_session_id, (unsigned char*)&ver, 1);
@@ -4099,26 +4561,27 @@ void* gdt::GDTClient::out_loop(void* args){
 
     // loop
     while(gdtc->is_active()){
-        // reset
-        bool internal_data = false;
-        bool external_data = false;
-
-        // pop internal
-        if(gdtc->internal_out_queue.pop(&gdtpld) == 0){
-            internal_data = true;
-            gdtc->out_process(gdtpld, &cb_args);
+        // out capacity released
+        if(gdtc->out_low_pending.comp_swap(true, false)){
+            cb_args.clear_all_args();
+            cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_CLIENT, gdtc);
+            // GDT_ET_OUT_QUEUE_LOW event
+            gdtc->process_callback(GDT_ET_OUT_QUEUE_LOW, &cb_args);
         }
 
-
-        // pop external
-        gdtpld = gdtc->pop_out_queue();
-        if(gdtpld != nullptr) {
-            external_data = true;
+        // next payload (priority class scheduler)
+        gdtpld = gdtc->schedule_out();
+        if(gdtpld != nullptr){
+            // out queue latency
+            if(gdtpld->ts_queued > 0){
+                gdtc->out_stats.lat_queue.record(GDTLatencyHistogram::now() - gdtpld->ts_queued);
+                gdtpld->ts_queued = 0;
+            }
             gdtc->out_process(gdtpld, &cb_args);
         }
 
-        // sleep if both queues are empty
-        if(!(external_data || internal_data)) {
+        // sleep if all queues are empty
+        else {
             // - use smaller sleep value (1 nsec) if the
             //   following conditions are met:
             //     1. at least one stream is active
@@ -4178,7 +4641,11 @@ gdt::GDTStream::GDTStream() : random_generator(nullptr),
                               expired(false),
                               linked_stream(nullptr),
                               last_linked_side(nullptr),
-                              initiator(GDT_SIT_LOCAL) {
+                              initiator(GDT_SIT_LOCAL),
+                              created_ts(0),
+                              trace(false),
+                              trace_hops{0, 0},
+                              trace_ts(0) {
     memset(uuid, 0, 16);
 }
 
@@ -4189,7 +4656,11 @@ gdt::GDTStream::GDTStream(mink_utils::Randomizer *_random_generator) : random_ge
                                                                        expired(false),
                                                                        linked_stream(nullptr),
                                                                        last_linked_side(nullptr),
-                                                                       initiator(GDT_SIT_LOCAL) {
+                                                                       initiator(GDT_SIT_LOCAL),
+                                                                       created_ts(0),
+                                                                       trace(false),
+                                                                       trace_hops{0, 0},
+                                                                       trace_ts(0) {
     memset(uuid, 0, 16);
     generate_uuid();
 
@@ -4251,6 +4722,29 @@ void gdt::GDTStream::send(bool include_body){
     client->push_out_queue(gdt_payload);
 }
 
+void gdt::GDTStream::send_stateless(){
+    sequence_flag = GDT_SF_STATELESS_NO_REPLY;
+    gdt_payload->free_on_send = true;
+    gdt_payload->out.set(true);
+    gdt_payload->gdt_stream_type = GDT_ST_STATELESS_NO_REPLY;
+    gdt_payload->client = client;
+    gdt_payload->sctp_sid = 0;
+    gdt_payload->clear_callbacks();
+    gdt_payload->set_callback(GDT_ET_PAYLOAD_SENT, get_callback(GDT_ET_PAYLOAD_SENT));
+    client->generate_stream_header(gdt_message,
+                                   this,
+                                   1,
+                                   gdt_payload,
+                                   true,
+                                   destination_type.c_str(),
+                                   (destination_id.empty() ? nullptr: destination_id.c_str()));
+    client->push_out_queue(gdt_payload);
+}
+
+void gdt::GDTStream::set_priority(GDTPriority prio){
+    gdt_payload->priority = prio;
+}
+
 void gdt::GDTStream::set_client(GDTClient* _client){
     client = _client;
 }
@@ -4263,6 +4757,8 @@ void gdt::GDTStream::reset(bool reset_uuid){
     destination_id.clear();
     destination_type.clear();
     timestamp = time(nullptr);
+    created_ts = GDTLatencyHistogram::now();
+    trace = false;
     expired = false;
     linked_stream = nullptr;
     last_linked_side = nullptr;
@@ -4271,6 +4767,14 @@ void gdt::GDTStream::reset(bool reset_uuid){
 
 }
 
+void gdt::GDTStream::set_trace(bool _trace){
+    trace = _trace;
+}
+
+bool gdt::GDTStream::get_trace() const {
+    return trace;
+}
+
 void gdt::GDTStream::set_timestamp(time_t _timestamp){
     timestamp = _timestamp;
 }
@@ -5103,6 +5607,20 @@ int gdt::GDTSession::remove_client(GDTClient* gdt_client){
                     gdt_client->deallocate_stream_pool(gdtpld->stream);
                 }
             }
+            // priority class queues
+            for(auto &q : gdt_client->prio_out_queue){
+                for(auto pld : q){
+                    // free memory, return back to pool
+                    if(pld->free_on_send){
+                        if (pld->stream->linked_stream != nullptr)
+                            gdt_client->deallocate_stream_pool(
+                                pld->stream->linked_stream);
+                        gdt_client->deallocate_stream_pool(pld->stream);
+                    }
+                }
+                q.clear();
+            }
+            memset(gdt_client->prio_staged, 0, sizeof(gdt_client->prio_staged));
 
             // process callback
             GDTCallbackArgs cb_args;
@@ -1786,6 +1786,9 @@ asn1::HopInfo::HopInfo(){
     _max_hops->tlv->tag_value = 2;
     children.push_back(_max_hops);
 
+    // hop_trace
+    _hop_trace = nullptr;
+    children.push_back(_hop_trace);
 
 }
 
@@ -1808,6 +1811,14 @@ static void copy_HopInfo(asn1::HopInfo &t, const asn1::HopInfo &o){
         *t._max_hops->tlv = *o._max_hops->tlv;
     }
     t.children.push_back(t._max_hops);
+
+    // hop_trace
+    t._hop_trace = nullptr;
+    if (o._hop_trace) {
+        t._hop_trace = new asn1::Octet_string();
+        *t._hop_trace->tlv = *o._hop_trace->tlv;
+    }
+    t.children.push_back(t._hop_trace);
 }
 
 asn1::HopInfo::HopInfo(const HopInfo &o){
@@ -1822,6 +1833,25 @@ asn1::HopInfo &asn1::HopInfo::operator=(const HopInfo &o){
 
 asn1::HopInfo::~HopInfo() = default;
 
+asn1::ASN1Node* asn1::HopInfo::create_node(unsigned int _index){
+    switch(_index){
+        case 2:
+            {
+                _hop_trace = new Octet_string();
+                _hop_trace->tlv->tag_class = CONTEXT_SPECIFIC;
+                _hop_trace->tlv->tag_value = 3;
+                children[2] = _hop_trace;
+                return _hop_trace;
+            }
+
+        default: return nullptr;
+    }
+}
+
+void asn1::HopInfo::set_hop_trace(){
+    if(_hop_trace == nullptr) _hop_trace = (Octet_string*)create_node(2);
+}
+
 //ErrorCode
 asn1::ErrorCode::ErrorCode(){
 #ifdef ENABLE_MDEBUG
@@ -0,0 +1,202 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <grpcpp/grpcpp.h>
+#include <gdt_def.h>
+#include <gdt.grpc.pb.h>
+
+using grpc::Channel;
+using grpc::ClientContext;
+using grpc::CompletionQueue;
+using grpc::Status;
+using bench_clock = std::chrono::steady_clock;
+
+// bench params
+struct BenchCfg {
+    std::string target = "localhost:50051";
+    std::string dest_id;
+    int cmd_id = gdt_grpc::CMD_GET_SYSINFO;
+    int max_threads = std::thread::hardware_concurrency();
+    int inflight = 32;
+    int duration = 5;
+    bool pipelined = false;
+};
+
+// single in-flight call
+struct BenchCall {
+    ClientContext ctx;
+    gdt_grpc::CommonReply reply;
+    Status status;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<gdt_grpc::CommonReply> > rdr;
+};
+
+// load generator thread (own channel and completion queue)
+class BenchWorker {
+public:
+    explicit BenchWorker(const BenchCfg &cfg) : cfg_(cfg) {
+        // separate channel per worker (no shared HTTP/2 connection)
+        grpc::ChannelArguments args;
+        args.SetInt("grpc.use_local_subchannel_pool", 1);
+        auto ch = grpc::CreateCustomChannel(cfg.target,
+                                            grpc::InsecureChannelCredentials(),
+                                            args);
+        stub_ = gdt_grpc::SysagentGrpcService::NewStub(ch);
+
+        // request
+        gdt_grpc::Header *hdr = req_.mutable_header();
+        gdt_grpc::EndPointDescriptor *dest = hdr->mutable_destination();
+        dest->set_type("sysagentd");
+        dest->set_id(cfg.dest_id);
+        gdt_grpc::Body *bdy = req_.mutable_body();
+        bdy->set_service_id(gdt_grpc::Body_ServiceId_SYSAGENT);
+        gdt_grpc::Body::Param *p = bdy->add_params();
+        p->set_id(asn1::ParameterType::_pt_mink_command_id);
+        p->set_value(std::to_string(cfg.cmd_id));
+    }
+
+    void run(const bench_clock::time_point &end) {
+        for (int i = 0; i < cfg_.inflight; i++)
+            start_call();
+
+        void *tag;
+        bool ok;
+        while (cq_.Next(&tag, &ok)) {
+            auto c = static_cast<BenchCall *>(tag);
+            if (ok && c->status.ok())
+                ++done;
+            else
+                ++failed;
+            delete c;
+            --active_;
+            // keep pipeline full until deadline
+            if (bench_clock::now() < end)
+                start_call();
+            else if (active_ == 0)
+                cq_.Shutdown();
+        }
+    }
+
+    std::atomic<uint64_t> done{0};
+    std::atomic<uint64_t> failed{0};
+
+private:
+    void start_call() {
+        auto c = new BenchCall();
+        c->ctx.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+        if (cfg_.pipelined)
+            c->ctx.AddMetadata("mink-pipelined", "1");
+        c->rdr = stub_->PrepareAsyncGetData(&c->ctx, req_, &cq_);
+        c->rdr->StartCall();
+        c->rdr->Finish(&c->reply, &c->status, c);
+        ++active_;
+    }
+
+    const BenchCfg &cfg_;
+    gdt_grpc::CommonRequest req_;
+    std::unique_ptr<gdt_grpc::SysagentGrpcService::Stub> stub_;
+    CompletionQueue cq_;
+    int active_ = 0;
+};
+
+// run bench with nt threads, return requests/sec
+static double run_bench(const BenchCfg &cfg, int nt, uint64_t &failed) {
+    std::vector<std::unique_ptr<BenchWorker> > workers;
+    std::vector<std::thread> thrds;
+    for (int i = 0; i < nt; i++)
+        workers.push_back(std::unique_ptr<BenchWorker>(new BenchWorker(cfg)));
+
+    auto start = bench_clock::now();
+    auto end = start + std::chrono::seconds(cfg.duration);
+    for (int i = 0; i < nt; i++)
+        thrds.push_back(std::thread(&BenchWorker::run, workers[i].get(), end));
+    for (auto &t : thrds)
+        t.join();
+    double sec = std::chrono::duration<double>(bench_clock::now() - start).count();
+
+    uint64_t done = 0;
+    failed = 0;
+    for (auto &w : workers) {
+        done += w->done;
+        failed += w->failed;
+    }
+    return done / sec;
+}
+
+static void print_help() {
+    std::cout << "grpcb - grpcd load generator (requests/sec vs. client threads)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -t\ttarget address [localhost:50051]" << std::endl;
+    std::cout << " -c\tsysagent command id [" << gdt_grpc::CMD_GET_SYSINFO << "]" << std::endl;
+    std::cout << " -i\tsysagent daemon id" << std::endl;
+    std::cout << " -n\tmax number of client threads [CPU count]" << std::endl;
+    std::cout << " -q\tin-flight requests per thread [32]" << std::endl;
+    std::cout << " -d\tduration of each run in seconds [5]" << std::endl;
+    std::cout << " -p\tpipelined GDT mode" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    BenchCfg cfg;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:c:i:n:q:d:ph")) != -1) {
+        switch (opt) {
+            case 't':
+                cfg.target.assign(optarg);
+                break;
+            case 'c':
+                cfg.cmd_id = atoi(optarg);
+                break;
+            case 'i':
+                cfg.dest_id.assign(optarg);
+                break;
+            case 'n':
+                cfg.max_threads = atoi(optarg);
+                break;
+            case 'q':
+                cfg.inflight = atoi(optarg);
+                break;
+            case 'd':
+                cfg.duration = atoi(optarg);
+                break;
+            case 'p':
+                cfg.pipelined = true;
+                break;
+            default:
+                print_help();
+                return 1;
+        }
+    }
+    if (cfg.max_threads < 1 || cfg.inflight < 1 || cfg.duration < 1) {
+        print_help();
+        return 1;
+    }
+
+    // 1, 2, 4 ... max_threads
+    std::cout << "threads\treq/s\tfailed" << std::endl;
+    for (int nt = 1; ; nt *= 2) {
+        if (nt > cfg.max_threads)
+            nt = cfg.max_threads;
+        uint64_t failed = 0;
+        double rps = run_bench(cfg, nt, failed);
+        std::cout << nt << "\t" << (uint64_t)rps << "\t" << failed << std::endl;
+        if (nt == cfg.max_threads)
+            break;
+    }
+    return 0;
+}
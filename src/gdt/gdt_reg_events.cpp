@@ -57,8 +57,10 @@ void gdt::RegClientStreamDone::run(gdt::GDTCallbackArgs* args){
 gdt::RegClientStreamNew::RegClientStreamNew(GDTClient* _client): pm_dtype(0),
                                                                  pm_did(0),
                                                                  pm_router(0),
+                                                                 pm_caps(0),
                                                                  reg_action(0),
                                                                  router_flag(0),
+                                                                 caps(0),
                                                                  client(_client),
                                                                  sdone(nullptr),
                                                                  status(1) {
@@ -88,6 +90,8 @@ void gdt::RegClientStreamNew::run(gdt::GDTCallbackArgs* args){
     // set end and timeout event handlers
     stream->set_callback(gdt::GDT_ET_STREAM_END, sdone);
     stream->set_callback(gdt::GDT_ET_STREAM_TIMEOUT, sdone);
+    // registration is control traffic
+    stream->set_priority(gdt::GDT_PRIO_CONTROL);
     // remove new stream event, discard any new streams (unsafe flag is TRUE, mutex already locked)
     client->remove_callback(gdt::GDT_ET_STREAM_NEW, true);
 
@@ -108,6 +112,8 @@ void gdt::RegClientStreamNew::run(gdt::GDTCallbackArgs* args){
     if(!reg->_params->has_linked_data(*in_sess)) goto params_done;
     // params
     p = reg->_params;
+    // capabilities are optional (older peers)
+    client->set_peer_caps(GDT_CAP_NONE);
 
     // process params
     for(unsigned int i = 0; i<p->children.size(); i++){
@@ -150,6 +156,14 @@ void gdt::RegClientStreamNew::run(gdt::GDTCallbackArgs* args){
                 ++c;
                 break;
 
+                // capabilities (optional)
+            case asn1::ParameterType::_pt_mink_gdt_capabilities:
+                if(tmp_val_l == sizeof(uint32_t)){
+                    memcpy(&caps, tmp_val, sizeof(uint32_t));
+                    client->set_peer_caps(be32toh(caps));
+                }
+                break;
+
             default:
                 break;
         }
@@ -172,13 +186,15 @@ params_done:
     pm_dtype = htobe32(asn1::ParameterType::_pt_mink_daemon_type);
     pm_did = htobe32(asn1::ParameterType::_pt_mink_daemon_id);
     pm_router = htobe32(asn1::ParameterType::_pt_mink_router_status);
+    pm_caps = htobe32(asn1::ParameterType::_pt_mink_gdt_capabilities);
     reg_action = asn1::RegistrationAction::_ra_reg_result;
     router_flag = (client->get_session()->is_router() ? 1 : 0);
+    caps = htobe32(GDT_LOCAL_CAPS);
     // set params
     if(gdtm->_body->_reg->_params == nullptr){
         gdtm->_body->_reg->set_params();
         // set children, allocate more
-        for(int i = 0; i<3; i++){
+        for(int i = 0; i<4; i++){
             gdtm->_body->_reg->_params->set_child(i);
             gdtm->_body->_reg->_params->get_child(i)->set_value();
             gdtm->_body->_reg->_params->get_child(i)->_value->set_child(0);
@@ -190,9 +206,9 @@ params_done:
         // unlink params before setting new ones
     }else{
         int cc = gdtm->_body->_reg->_params->children.size();
-        if(cc < 3){
+        if(cc < 4){
             // set children, allocate more
-            for(int i = cc; i<3; i++){
+            for(int i = cc; i<4; i++){
                 gdtm->_body->_reg->_params->set_child(i);
                 gdtm->_body->_reg->_params->get_child(i)->set_value();
                 gdtm->_body->_reg->_params->get_child(i)->_value->set_child(0);
@@ -201,9 +217,9 @@ params_done:
             // prepare
             gdtm->prepare();
 
-        }else if(cc > 3){
-            // remove extra children if used in some other session, only 2 needed
-            for(int i = 3; i<cc; i++) gdtm->_body->_reg->_params->get_child(i)->unlink(1);
+        }else if(cc > 4){
+            // remove extra children if used in some other session, only 4 needed
+            for(int i = 4; i<cc; i++) gdtm->_body->_reg->_params->get_child(i)->unlink(1);
         }
     }
 
@@ -262,6 +278,22 @@ params_done:
         ->get_child(0)
         ->set_linked_data(1, (unsigned char*)&router_flag, 1);
 
+    // set capabilities
+    gdtm->_body
+        ->_reg
+        ->_params
+        ->get_child(3)
+        ->_id
+        ->set_linked_data(1, (unsigned char*)&pm_caps, sizeof(uint32_t));
+
+    gdtm->_body
+        ->_reg
+        ->_params
+        ->get_child(3)
+        ->_value
+        ->get_child(0)
+        ->set_linked_data(1, (unsigned char*)&caps, sizeof(uint32_t));
+
     // include
     *include_body = true;
 
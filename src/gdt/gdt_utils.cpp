@@ -17,6 +17,36 @@ bool gdt::ServiceParam::FRAGMENTATION_DONE = false;
 bool gdt::ServiceParam::FRAGMENTATION_NEXT = true;
 gdt::ServiceMessageAsyncDone gdt::ServiceMsgManager::cb_async_done;
 
+/**
+ * Per-thread deflate context, reset between params
+ * instead of allocating new zlib state for each one
+ */
+class ZDeflateCtx {
+public:
+    ZDeflateCtx() {
+        memset(&zs, 0, sizeof(zs));
+        ready = (deflateInit(&zs, Z_BEST_SPEED) == Z_OK);
+    }
+    ~ZDeflateCtx() {
+        if (ready)
+            deflateEnd(&zs);
+    }
+    ZDeflateCtx(const ZDeflateCtx &o) = delete;
+    ZDeflateCtx &operator=(const ZDeflateCtx &o) = delete;
+
+    z_stream *get() {
+        if (!ready || deflateReset(&zs) != Z_OK)
+            return nullptr;
+        return &zs;
+    }
+
+private:
+    z_stream zs;
+    bool ready;
+};
+
+static thread_local ZDeflateCtx zdeflate_ctx;
+
 gdt::ServiceParam::ServiceParam() : data_size(0),
                                     total_data_size(0),
                                     type(SPT_UNKNOWN),
@@ -747,7 +777,7 @@ void gdt::ServiceMessageNext::run(GDTCallbackArgs *args) {
                                               gdt::GDT_CB_ARG_BODY);
 
     // param map
-    std::vector<ServiceParam *> *pmap = smsg->get_param_map();
+    std::vector<ServiceParam *> *pmap = this->pmap;
 
     // more segments
     if (pindex < pc) {
@@ -937,20 +967,31 @@ void gdt::ServiceMessageNext::run(GDTCallbackArgs *args) {
 }
 
 gdt::ServiceMessage::ServiceMessage() : missing_params(false),
+                                        pipelined(false),
                                         idt_map(nullptr),
                                         service_id(0),
                                         service_action(0),
                                         smsg_m(nullptr),
                                         frag_param(nullptr),
-                                        auto_free(true) {
+                                        auto_free(true),
+                                        priority(GDT_PRIO_NORMAL),
+                                        trace(false),
+                                        zstrm_init(false),
+                                        zstrm_active(false) {
 
     sem_init(&smsg_sem, 0, 0);
     sem_init(&new_param_sem, 0, 0);
     msg_done.smsg = this;
     msg_next.smsg = this;
+    msg_next.pmap = &stlvs;
+    memset(&zstrm, 0, sizeof(zstrm));
 }
 
-gdt::ServiceMessage::~ServiceMessage() { tlvs.clear(); }
+gdt::ServiceMessage::~ServiceMessage() {
+    tlvs.clear();
+    if (zstrm_init)
+        inflateEnd(&zstrm);
+}
 
 int gdt::ServiceMessage::add_param(uint32_t id, ServiceParam *param,
                                     uint32_t index) {
@@ -1039,6 +1080,14 @@ bool gdt::ServiceMessage::set_auto_free(bool _auto_free) {
 
 bool gdt::ServiceMessage::get_auto_free() const { return auto_free; }
 
+void gdt::ServiceMessage::set_priority(GDTPriority prio) { priority = prio; }
+
+gdt::GDTPriority gdt::ServiceMessage::get_priority() const { return priority; }
+
+void gdt::ServiceMessage::set_trace(bool _trace) { trace = _trace; }
+
+bool gdt::ServiceMessage::get_trace() const { return trace; }
+
 void gdt::ServiceMessage::set_callback(GDTEventType type,
                                         GDTCallbackMethod *cback) {
     cb_handler.set_callback(type, cback);
@@ -1181,6 +1230,13 @@ void gdt::ServiceStreamHandlerNext::run(GDTCallbackArgs *args) {
                                    ->linked_node
                                    ->tlv
                                    ->value[0];
+                // compressed param
+                if (extra_type & ServiceParam::COMPRESSED_FLAG) {
+                    ssh_new->smsg_m->process_zparam(smsg,
+                                                    sm->_params->get_child(i),
+                                                    *in_sess);
+                    continue;
+                }
                 // create param
                 sparam = ssh_new->smsg_m->get_param_factory()
                                         ->new_param((extra_type > 0)
@@ -1532,6 +1588,11 @@ void gdt::ServiceStreamHandlerDone::run(GDTCallbackArgs *args) {
                       ->linked_node
                       ->tlv
                       ->value[0];
+        // compressed param
+        if (extra_type & ServiceParam::COMPRESSED_FLAG) {
+            ssh_new->smsg_m->process_zparam(smsg, p->get_child(i), *in_sess);
+            continue;
+        }
         // create param
         sparam = ssh_new->smsg_m
                          ->get_param_factory()
@@ -1897,6 +1958,8 @@ void gdt::ServiceStreamHandlerNew::run(GDTCallbackArgs *args) {
     smsg->set_auto_free(true);
     // reset missing params
     smsg->missing_params = false;
+    // stream mode
+    smsg->pipelined = false;
 
     // run callback
     cb_args.clear_all_args();
@@ -1922,6 +1985,8 @@ void gdt::ServiceStreamHandlerNew::run(GDTCallbackArgs *args) {
     bool frag = false;
     // extra type
     int extra_type;
+    // end point caps param found
+    bool caps = false;
 
     // check for params part
     if (!p) goto stream_continue;
@@ -1971,6 +2036,16 @@ void gdt::ServiceStreamHandlerNew::run(GDTCallbackArgs *args) {
                       ->linked_node
                       ->tlv
                       ->value[0];
+        // compressed param
+        if (extra_type & ServiceParam::COMPRESSED_FLAG) {
+            smsg_m->process_zparam(smsg, p->get_child(i), *in_sess);
+            continue;
+        }
+        // end point caps (always sent in first packet)
+        if (smsg_m->learn_end_caps(in_msg, p->get_child(i), *in_sess)) {
+            caps = true;
+            continue;
+        }
         // create param
         sparam = smsg_m->get_param_factory()
                        ->new_param((extra_type > 0)
@@ -2226,11 +2301,196 @@ void gdt::ServiceStreamHandlerNew::run(GDTCallbackArgs *args) {
         }
     }
 stream_continue:
+    // no caps in first packet; end point restarted
+    // or downgraded, stale caps must not be used
+    if (!caps)
+        smsg_m->forget_end_caps(in_msg, *in_sess);
     // continue
     stream->continue_sequence();
 
 }
 
+// set vpmap value for non fragmented VARIANT param
+static void sparam_vpmap_set(gdt::ServiceMessage *smsg,
+                             gdt::ServiceParam *sparam) {
+    switch (sparam->get_extra_type()) {
+        // c string
+        case mink_utils::DPT_STRING: {
+            char tmp_str[256];
+            sparam->extract(tmp_str);
+            smsg->vpmap.set_cstr(sparam->get_id(),
+                                 tmp_str,
+                                 sparam->get_index());
+            break;
+        }
+        // int
+        case mink_utils::DPT_INT: {
+            uint64_t tmp = 0;
+            sparam->extract(&tmp);
+            smsg->vpmap.set_int(sparam->get_id(),
+                                tmp,
+                                sparam->get_index());
+            break;
+        }
+        // bool
+        case mink_utils::DPT_BOOL: {
+            bool tmp = false;
+            sparam->extract(&tmp);
+            smsg->vpmap.set_bool(sparam->get_id(),
+                                 tmp,
+                                 sparam->get_index());
+            break;
+        }
+        // other
+        default: {
+            unsigned char tmp_buff[256];
+            sparam->extract(&tmp_buff);
+            smsg->vpmap.set_octets(sparam->get_id(),
+                                   tmp_buff,
+                                   sparam->get_data_size(),
+                                   sparam->get_index());
+            break;
+        }
+    }
+}
+
+void gdt::ServiceDatagramHandler::run(GDTCallbackArgs *args) {
+    auto in_msg = (asn1::GDTMessage *)args->get_arg(gdt::GDT_CB_INPUT_ARGS,
+                                                    gdt::GDT_CB_ARG_IN_MSG);
+    auto in_sess = (uint64_t *)args->get_arg(gdt::GDT_CB_INPUT_ARGS,
+                                             gdt::GDT_CB_ARG_IN_MSG_ID);
+    auto client = (gdt::GDTClient *)args->get_arg(gdt::GDT_CB_INPUT_ARGS,
+                                                  gdt::GDT_CB_ARG_CLIENT);
+    // stream params carrier (SMSG_PT_PASS), one per GDT IN thread
+    static thread_local GDTStream stream;
+    GDTCallbackArgs cb_args;
+
+    // check for ServiceMessage
+    if (!in_msg->_body) return;
+    if (!in_msg->_body->_service_msg->has_linked_data(*in_sess)) return;
+
+    // create new ServiceMessage
+    ServiceMessage *smsg = smsg_m->new_smsg();
+
+    // nullptr check
+    if (!smsg) {
+        smsg_m->stats.inc(SST_RX_SMSG_POOL_EMPTY, 1);
+        // run callback
+        cb_args.clear_all_args();
+        smsg_m->process_callback(GDT_ET_SRVC_MSG_ERROR, &cb_args);
+        return;
+    }
+    smsg_m->stats.inc(SST_RX_SMSG_PIPELINED, 1);
+
+    // reset
+    smsg->set_frag_param(nullptr);
+    smsg->clear_callbacks();
+    smsg->vpmap.clear_params();
+    smsg->set_complete(false);
+    smsg->set_auto_free(true);
+    smsg->missing_params = false;
+    smsg->pipelined = true;
+
+    // setup carrier stream
+    stream.clear_params();
+    stream.set_client(client);
+    stream.set_param(SMSG_PT_SMSG, smsg);
+
+    // run callback
+    cb_args.clear_all_args();
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_MSG, smsg);
+    smsg_m->process_callback(GDT_ET_SRVC_MSG_NEW, &cb_args);
+
+    asn1::ServiceMessage *sm = in_msg->_body->_service_msg;
+    asn1::Parameters *p = sm->_params;
+    // get ID->TYPE map
+    ParamIdTypeMap *idt_map = smsg_m->get_idt_map();
+
+    // service id
+    if (sm->_service_id->has_linked_data(*in_sess)) {
+        auto tmp_ui32 = (uint32_t *)sm->_service_id
+                                      ->linked_node
+                                      ->tlv
+                                      ->value;
+        smsg->set_service_id(be32toh(*tmp_ui32));
+    }
+
+    // process params (pipelined messages are never fragmented)
+    for (unsigned int i = 0;
+         (p != nullptr) && p->has_linked_data(*in_sess) && (i < p->children.size());
+         i++) {
+        asn1::Parameter *gp = p->get_child(i);
+        // check for value
+        if (!gp->_value) continue;
+        if (!gp->_value->has_linked_data(*in_sess)) continue;
+        if (!gp->_value->get_child(0)) continue;
+        if (!gp->_value->get_child(0)->has_linked_data(*in_sess)) continue;
+
+        // param id and extra type
+        auto param_id = (uint32_t *)gp->_id->linked_node->tlv->value;
+        int extra_type = gp->_value->get_child(3)->linked_node->tlv->value[0];
+        // fragmented or compressed params are not expected
+        bool frag = false;
+        if ((gp->_value->get_child(1)) &&
+            (gp->_value->get_child(1)->has_linked_data(*in_sess))) {
+            const asn1::TLVNode *tlv = gp->_value->get_child(1)->linked_node->tlv;
+            frag = ((tlv->value_length == 1) && (tlv->value[0] == 1));
+        }
+        if (frag || (extra_type & ServiceParam::COMPRESSED_FLAG)) {
+            smsg->missing_params = true;
+            continue;
+        }
+
+        // create param
+        ServiceParam *sparam = smsg_m->get_param_factory()
+                                     ->new_param((extra_type > 0)
+                                                 ? SPT_VARIANT
+                                                 : idt_map->get(be32toh(*param_id)));
+        if (!sparam) {
+            smsg->missing_params = true;
+            smsg_m->stats.inc(SST_RX_SPARAM_POOL_EMPTY, 1);
+            continue;
+        }
+
+        // set param data
+        sparam->set_id(be32toh(*param_id));
+        sparam->reset_data_p();
+        sparam->set_data(gp->_value->get_child(0)->linked_node->tlv->value,
+                         gp->_value->get_child(0)->linked_node->tlv->value_length);
+        sparam->set_index(gp->_value->get_child(2)->linked_node->tlv->value[0]);
+        sparam->set_extra_type(extra_type);
+        sparam->set_fragmented(false);
+        // add param
+        smsg->add_param(be32toh(*param_id), sparam, sparam->get_index());
+        // process vparam
+        if (sparam->get_type() == SPT_VARIANT) sparam_vpmap_set(smsg, sparam);
+
+        // run callback
+        cb_args.clear_all_args();
+        cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_MSG, smsg);
+        cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_PARAM, sparam);
+        smsg->process_callback(GDT_ET_SRVC_SHORT_PARAM_NEW, &cb_args);
+    }
+
+    // single packet, complete
+    smsg->set_complete(true);
+
+    // run callback
+    cb_args.clear_all_args();
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_STREAM, &stream);
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_MSG, smsg);
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_CLIENT, client);
+    smsg->process_callback(GDT_ET_SRVC_MSG_COMPLETE, &cb_args);
+
+    // free message if not passed and auto_free flag was set (default)
+    auto smsg_pass = (ServiceMessage *)stream.get_param(SMSG_PT_PASS);
+    if ((smsg_pass != smsg) && (smsg->get_auto_free())) {
+        smsg_m->free_smsg(smsg);
+    }
+    // remove params
+    stream.clear_params();
+}
+
 gdt::ServiceMsgManager::ServiceMsgManager(ParamIdTypeMap *_idt_map,
                                           GDTCallbackMethod *_new_msg_hndlr,
                                           GDTCallbackMethod *_nonsrvc_stream_hndlr,
@@ -2238,10 +2498,13 @@ gdt::ServiceMsgManager::ServiceMsgManager(ParamIdTypeMap *_idt_map,
                                           unsigned int param_pool_size) {
 
     idt_map = _idt_map;
+    z_threshold = COMPRESSION_THRESHOLD;
+    pthread_mutex_init(&mtx_caps, nullptr);
     param_factory = new ServiceParamFactory(true, false, param_pool_size);
     sem_init(&q_sem, 0, 0);
     srvcs_hndlr.smsg_m = this;
     srvcs_nc.smsg_m = this;
+    srvcs_dgram.smsg_m = this;
     srvcs_hndlr.usr_stream_hndlr = _nonsrvc_stream_hndlr;
     srvcs_hndlr.ssh_next.ssh_new = &srvcs_hndlr;
     srvcs_hndlr.ssh_done.ssh_new = &srvcs_hndlr;
@@ -2265,10 +2528,15 @@ gdt::ServiceMsgManager::ServiceMsgManager(ParamIdTypeMap *_idt_map,
     // stats
     stats.register_item(SST_RX_SMSG_POOL_EMPTY);
     stats.register_item(SST_RX_SPARAM_POOL_EMPTY);
+    stats.register_item(SST_TX_SPARAM_COMPRESSED);
+    stats.register_item(SST_RX_SPARAM_INFLATE_ERROR);
+    stats.register_item(SST_TX_SMSG_PIPELINED);
+    stats.register_item(SST_RX_SMSG_PIPELINED);
 }
 
 gdt::ServiceMsgManager::~ServiceMsgManager() {
     sem_destroy(&q_sem);
+    pthread_mutex_destroy(&mtx_caps);
     delete param_factory;
 }
 
@@ -2297,6 +2565,352 @@ bool gdt::ServiceMsgManager::process_callback(GDTEventType type,
     return cb_handler.process_callback(type, args);
 }
 
+void gdt::ServiceMsgManager::set_compression_threshold(unsigned int threshold) {
+    z_threshold = threshold;
+}
+
+unsigned int gdt::ServiceMsgManager::get_compression_threshold() const {
+    return z_threshold;
+}
+
+gdt::ServiceParam *gdt::ServiceMsgManager::compress_param(ServiceParam *param) {
+    // only in-memory fragmented params are compressed
+    if (!param->fragmented ||
+        (param->param_data_cb != &ServiceParam::param_data_default) ||
+        (param->extra_type & ServiceParam::COMPRESSED_FLAG) ||
+        (param->total_data_size < z_threshold))
+        return nullptr;
+
+    // per-thread deflate context
+    z_stream *zs = zdeflate_ctx.get();
+    if (zs == nullptr)
+        return nullptr;
+
+    // send-local param (caller's param stays intact)
+    ServiceParam *zp = param_factory->new_param(param->type);
+    if (zp == nullptr)
+        return nullptr;
+
+    // compress
+    zp->zbuff.resize(deflateBound(zs, param->total_data_size));
+    zs->next_in = (Bytef *)param->in_data_p;
+    zs->avail_in = param->total_data_size;
+    zs->next_out = zp->zbuff.data();
+    zs->avail_out = zp->zbuff.size();
+
+    // incompressible data, send as is
+    if ((deflate(zs, Z_FINISH) != Z_STREAM_END) ||
+        (zs->total_out >= param->total_data_size)) {
+        param_factory->free_param(zp);
+        return nullptr;
+    }
+
+    // compressed copy
+    zp->reset_data_p();
+    zp->set_data(zp->zbuff.data(), zs->total_out);
+    zp->set_id(param->id);
+    zp->index = param->index;
+    zp->extra_type = param->extra_type | ServiceParam::COMPRESSED_FLAG;
+    stats.inc(SST_TX_SPARAM_COMPRESSED, 1);
+    return zp;
+}
+
+void gdt::ServiceMsgManager::free_send_params(ServiceMessage *msg) {
+    for (unsigned int i = 0; i < msg->ztlvs.size(); i++) {
+        ServiceParam *param = msg->ztlvs[i];
+        // temp linked buffer params
+        for (unsigned int j = 0; j < param->linked.size(); j++)
+            param_factory->free_param(param->linked[j]);
+        param->linked.clear();
+        param_factory->free_param(param);
+    }
+    msg->ztlvs.clear();
+    msg->stlvs.clear();
+}
+
+bool gdt::ServiceMsgManager::end_has_cap(GDTClient *gdtc,
+                                         const char *dtype,
+                                         const char *did,
+                                         GDTCapability cap) {
+    // direct connection, next hop is end point
+    if (!gdtc->is_router() &&
+        (dtype != nullptr) &&
+        (strcmp(dtype, gdtc->get_end_point_daemon_type()) == 0) &&
+        ((did == nullptr) ||
+         (strcmp(did, gdtc->get_end_point_daemon_id()) == 0)))
+        return gdtc->has_peer_cap(cap);
+
+    // routed end point, caps are known only for
+    // specific end points that already sent a message
+    if ((dtype == nullptr) || (did == nullptr))
+        return false;
+
+    std::string ep(dtype);
+    ep += ':';
+    ep += did;
+    pthread_mutex_lock(&mtx_caps);
+    auto it = end_caps.find(ep);
+    bool res = (it != end_caps.end()) && ((it->second.caps & cap) == cap);
+    pthread_mutex_unlock(&mtx_caps);
+    return res;
+}
+
+// source end point of received message ("type:id")
+static bool src_end_point(asn1::GDTMessage *in_msg,
+                          uint64_t in_sess,
+                          std::string &ep) {
+    asn1::EndPointDescriptor *src = in_msg->_header->_source;
+    if ((src->_id == nullptr) || (!src->_id->has_linked_data(in_sess)))
+        return false;
+
+    ep.assign((const char *)src->_type->linked_node->tlv->value,
+              src->_type->linked_node->tlv->value_length);
+    ep += ':';
+    ep.append((const char *)src->_id->linked_node->tlv->value,
+              src->_id->linked_node->tlv->value_length);
+    return true;
+}
+
+bool gdt::ServiceMsgManager::learn_end_caps(asn1::GDTMessage *in_msg,
+                                            asn1::Parameter *p,
+                                            uint64_t in_sess) {
+    // param id
+    auto param_id = (uint32_t *)p->_id->linked_node->tlv->value;
+    if (be32toh(*param_id) != asn1::ParameterType::_pt_mink_gdt_capabilities)
+        return false;
+
+    // caps value
+    const asn1::TLVNode *tlv = p->_value->get_child(0)->linked_node->tlv;
+    if (tlv->value_length != sizeof(uint32_t))
+        return true;
+
+    // source end point
+    std::string ep;
+    if (!src_end_point(in_msg, in_sess, ep))
+        return true;
+
+    uint32_t caps;
+    memcpy(&caps, tlv->value, sizeof(uint32_t));
+    pthread_mutex_lock(&mtx_caps);
+    auto it = end_caps.find(ep);
+    // known end point, move to front
+    if (it != end_caps.end()) {
+        it->second.caps = be32toh(caps);
+        end_caps_lru.splice(end_caps_lru.begin(), end_caps_lru, it->second.lru);
+
+    } else {
+        // bounded; evict least recently learned end point
+        // (caps are re-learned from its next message)
+        if (end_caps.size() >= MAX_END_CAPS) {
+            end_caps.erase(end_caps_lru.back());
+            end_caps_lru.pop_back();
+        }
+        end_caps_lru.push_front(ep);
+        end_caps.emplace(ep, EndCaps{be32toh(caps), end_caps_lru.begin()});
+    }
+    pthread_mutex_unlock(&mtx_caps);
+    return true;
+}
+
+void gdt::ServiceMsgManager::forget_end_caps(asn1::GDTMessage *in_msg,
+                                             uint64_t in_sess) {
+    pthread_mutex_lock(&mtx_caps);
+    if (!end_caps.empty()) {
+        std::string ep;
+        auto it = (src_end_point(in_msg, in_sess, ep) ? end_caps.find(ep) : end_caps.end());
+        if (it != end_caps.end()) {
+            end_caps_lru.erase(it->second.lru);
+            end_caps.erase(it);
+        }
+    }
+    pthread_mutex_unlock(&mtx_caps);
+}
+
+int gdt::ServiceMsgManager::zparam_fragment(ServiceMessage *smsg,
+                                            uint32_t id,
+                                            uint32_t index,
+                                            int extra_type,
+                                            const unsigned char *data,
+                                            unsigned int size,
+                                            GDTEventType et) {
+    // create param
+    ServiceParam *sparam = param_factory->new_param((extra_type > 0)
+                                                    ? SPT_VARIANT
+                                                    : idt_map->get(id));
+    if (sparam == nullptr) {
+        stats.inc(SST_RX_SPARAM_POOL_EMPTY, 1);
+        return 1;
+    }
+    sparam->set_id(id);
+    sparam->reset_data_p();
+    sparam->set_data(data, size);
+    sparam->set_fragmented(true);
+    sparam->index = index;
+    sparam->extra_type = extra_type;
+
+    // first fragment is retained until the last one
+    ServiceParam *fparam = smsg->get_frag_param();
+    if (et == GDT_ET_SRVC_PARAM_STREAM_NEW) {
+        sparam->fragment_index = 0;
+        sparam->clear_callbacks();
+        smsg->set_frag_param(sparam);
+        fparam = sparam;
+
+    } else
+        fparam->inc_total_data_size(size);
+
+    // process vparam
+    if (sparam->get_type() == SPT_VARIANT) {
+        smsg->vpmap.set_octets(id,
+                               sparam->get_data(),
+                               size,
+                               index,
+                               fparam->get_fragment_index());
+
+        if (et == GDT_ET_SRVC_PARAM_STREAM_END) {
+            mink_utils::VariantParam *vparam = smsg->vpmap.defragment(id, index);
+            if (vparam != nullptr)
+                vparam->set_type((mink_utils::VariantParamType)extra_type);
+        }
+    }
+
+    // run callback
+    GDTCallbackArgs cb_args;
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_MSG, smsg);
+    cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_PARAM, sparam);
+    if (et == GDT_ET_SRVC_PARAM_STREAM_NEW) {
+        smsg->process_callback(et, &cb_args);
+        return 0;
+    }
+    fparam->process_callback(et, &cb_args);
+
+    // return to pool (fragmented params are not retained in memory)
+    param_factory->free_param(sparam);
+    if (et == GDT_ET_SRVC_PARAM_STREAM_END) {
+        param_factory->free_param(fparam);
+        smsg->set_frag_param(nullptr);
+    }
+    return 0;
+}
+
+int gdt::ServiceMsgManager::process_zparam(ServiceMessage *smsg,
+                                           asn1::Parameter *p,
+                                           uint64_t in_sess) {
+    // inflate step size
+    constexpr std::size_t ZCHUNK_SZ = 4096;
+    z_stream *zs = &smsg->zstrm;
+    int zres = Z_OK;
+
+    // error, discard param
+    auto zabort = [this, smsg](int err) {
+        if (smsg->get_frag_param() != nullptr) {
+            param_factory->free_param(smsg->get_frag_param());
+            smsg->set_frag_param(nullptr);
+        }
+        smsg->zstrm_active = false;
+        smsg->zbuff.clear();
+        smsg->missing_params = true;
+        stats.inc(SST_RX_SPARAM_INFLATE_ERROR, 1);
+        return err;
+    };
+
+    // param id
+    auto param_id = (uint32_t *)p->_id->linked_node->tlv->value;
+    uint32_t id = be32toh(*param_id);
+    // compressed data
+    const asn1::TLVNode *tlv = p->_value->get_child(0)->linked_node->tlv;
+    // fragmentation flag (value length 1 and value 1)
+    bool frag = false;
+    if ((p->_value->get_child(1)) &&
+        (p->_value->get_child(1)->has_linked_data(in_sess))) {
+        const asn1::TLVNode *ftlv = p->_value->get_child(1)->linked_node->tlv;
+        frag = ((ftlv->value_length == 1) && (ftlv->value[0] == 1));
+    }
+    // variant param id index and type (without compression flag)
+    uint32_t index = p->_value->get_child(2)->linked_node->tlv->value[0];
+    int extra_type = p->_value->get_child(3)->linked_node->tlv->value[0] &
+                     ~ServiceParam::COMPRESSED_FLAG;
+
+    // first fragment, reuse inflate stream
+    if (!smsg->zstrm_active) {
+        zres = (smsg->zstrm_init ? inflateReset(zs) : inflateInit(zs));
+        if (zres != Z_OK)
+            return zabort(1);
+        smsg->zstrm_init = true;
+        smsg->zstrm_active = true;
+        smsg->zbuff.clear();
+    }
+
+    // inflate
+    zs->next_in = tlv->value;
+    zs->avail_in = tlv->value_length;
+    do {
+        std::size_t pos = smsg->zbuff.size();
+        smsg->zbuff.resize(pos + ZCHUNK_SZ);
+        zs->next_out = smsg->zbuff.data() + pos;
+        zs->avail_out = ZCHUNK_SZ;
+        zres = inflate(zs, Z_NO_FLUSH);
+        smsg->zbuff.resize(pos + ZCHUNK_SZ - zs->avail_out);
+        if ((zres != Z_OK) && (zres != Z_STREAM_END) && (zres != Z_BUF_ERROR))
+            return zabort(2);
+
+    } while ((zres != Z_STREAM_END) && (zs->avail_out == 0));
+
+    // last fragment must complete compressed stream
+    if (!frag && (zres != Z_STREAM_END))
+        return zabort(3);
+
+    // pass full chunks, keep the remainder for the last fragment
+    const unsigned char *d = smsg->zbuff.data();
+    std::size_t sz = smsg->zbuff.size();
+    std::size_t off = 0;
+    for (; sz - off > ServiceParam::DATA_SZ; off += ServiceParam::DATA_SZ) {
+        if (zparam_fragment(smsg,
+                            id,
+                            index,
+                            extra_type,
+                            d + off,
+                            ServiceParam::DATA_SZ,
+                            (smsg->get_frag_param() == nullptr)
+                            ? GDT_ET_SRVC_PARAM_STREAM_NEW
+                            : GDT_ET_SRVC_PARAM_STREAM_NEXT))
+            return zabort(4);
+    }
+
+    // more fragments coming
+    if (frag) {
+        smsg->zbuff.erase(smsg->zbuff.begin(), smsg->zbuff.begin() + off);
+        return 0;
+    }
+
+    // inflated data fits in a single chunk
+    if (smsg->get_frag_param() == nullptr) {
+        if (zparam_fragment(smsg,
+                            id,
+                            index,
+                            extra_type,
+                            d + off,
+                            sz - off,
+                            GDT_ET_SRVC_PARAM_STREAM_NEW))
+            return zabort(5);
+        off = sz;
+    }
+
+    // last chunk
+    if (zparam_fragment(smsg,
+                        id,
+                        index,
+                        extra_type,
+                        d + off,
+                        sz - off,
+                        GDT_ET_SRVC_PARAM_STREAM_END))
+        return zabort(6);
+
+    smsg->zstrm_active = false;
+    smsg->zbuff.clear();
+    return 0;
+}
+
 void gdt::ServiceMsgManager::setup_server(GDTSession *gdts,
                                           gdt::GDTCallbackMethod *_usr_stream_nc_hndlr,
                                           gdt::GDTCallbackMethod *_usr_stream_hndlr) {
@@ -2313,10 +2927,24 @@ void gdt::ServiceMsgManager::setup_client(GDTClient *gdtc) {
         return;
     // set end event handler
     gdtc->set_callback(gdt::GDT_ET_STREAM_NEW, &srvcs_hndlr);
+    // pipelined (single packet) messages
+    gdtc->set_callback(gdt::GDT_ET_DATAGRAM, &srvcs_dgram);
+}
+
+int gdt::ServiceMsgManager::wait_capacity(GDTClient *gdtc,
+                                          unsigned int timeout_ms) {
+    if (gdtc == nullptr)
+        return 1;
+    return gdtc->wait_out_capacity(timeout_ms);
 }
 
 gdt::ServiceMessage *gdt::ServiceMsgManager::new_smsg() {
     ServiceMessage *tmp = msg_pool.allocate_constructed();
+    // default priority and tracing
+    if (tmp != nullptr) {
+        tmp->set_priority(GDT_PRIO_NORMAL);
+        tmp->set_trace(false);
+    }
     return tmp;
 }
 
@@ -2352,6 +2980,8 @@ int gdt::ServiceMsgManager::free_smsg(ServiceMessage *msg,
 
     // clear params
     params->clear();
+    // send-local params
+    free_send_params(msg);
     // clear vpmap
     if (clear_vpmap)
         msg->vpmap.clear_params();
@@ -2359,6 +2989,8 @@ int gdt::ServiceMsgManager::free_smsg(ServiceMessage *msg,
     // if freeing smsg also
     if (!params_only) {
         msg->params.clear_params();
+        // discard unfinished compressed param
+        msg->zstrm_active = false;
         // return to pool
         int res = msg_pool.deallocate_constructed(msg);
         // result
@@ -2440,13 +3072,46 @@ int gdt::ServiceMsgManager::send(ServiceMessage *msg,
         gdt_stream->clear_callbacks();
         gdt_stream->clear_params();
         gdt_stream->set_destination(dtype, did);
+        gdt_stream->set_priority(msg->get_priority());
+        gdt_stream->set_trace(msg->get_trace());
 
         unsigned int pc;
         unsigned int bc;
         unsigned int tbc = 0;
 
-        // param map
-        std::vector<ServiceParam *> *pmap = msg->get_param_map();
+        // send list (caller's param map is never modified)
+        std::vector<ServiceParam *> *tlvs = msg->get_param_map();
+        std::vector<ServiceParam *> *pmap = &msg->stlvs;
+        free_send_params(msg);
+
+        // advertise local caps to routed end point (direct
+        // peers get them during registration)
+        if (gdtc->is_router()) {
+            uint32_t caps = htobe32(GDT_LOCAL_CAPS);
+            ServiceParam *cp = param_factory->new_param(SPT_OCTETS);
+            if (cp != nullptr) {
+                cp->reset_data_p();
+                cp->set_data(&caps, sizeof(uint32_t));
+                cp->set_id(asn1::ParameterType::_pt_mink_gdt_capabilities);
+                cp->index = 0;
+                cp->extra_type = 0;
+                msg->ztlvs.push_back(cp);
+                pmap->push_back(cp);
+            }
+        }
+
+        // compress large params into send-local copies
+        // (if supported by end point)
+        bool z = (z_threshold > 0) &&
+                 end_has_cap(gdtc, dtype, did, GDT_CAP_COMPRESSION);
+        for (unsigned int i = 0; i < tlvs->size(); i++) {
+            ServiceParam *zp = z ? compress_param((*tlvs)[i]) : nullptr;
+            if (zp != nullptr) {
+                msg->ztlvs.push_back(zp);
+                pmap->push_back(zp);
+            } else
+                pmap->push_back((*tlvs)[i]);
+        }
         pc = pmap->size();
 
         // calculate total param size (add extra 3 bytes for dual byte length
@@ -2701,6 +3366,129 @@ int gdt::ServiceMsgManager::send(ServiceMessage *msg,
     return 1;
 }
 
+int gdt::ServiceMsgManager::send_pipelined(ServiceMessage *msg,
+                                           GDTClient *gdtc,
+                                           const char *dtype,
+                                           const char *did,
+                                           gdt::GDTCallbackMethod *on_sent) {
+    if ((msg == nullptr) || (gdtc == nullptr)) return 1;
+
+    // param map
+    std::vector<ServiceParam *> *pmap = msg->get_param_map();
+
+    // check if supported by next hop and end point (caps
+    // learned from routed messages, unknown end points use
+    // regular streams) and if message fits in a single packet
+    bool single = gdtc->has_peer_cap(GDT_CAP_PIPELINING) &&
+                  end_has_cap(gdtc, dtype, did, GDT_CAP_PIPELINING);
+    unsigned int tbc = 0;
+    for (unsigned int i = 0; single && (i < pmap->size()); i++) {
+        const ServiceParam *sc_param = (*pmap)[i];
+        tbc += sc_param->data_size + 25;
+        if (sc_param->is_fragmented() || (tbc > MAX_PARAMS_SIZE))
+            single = false;
+    }
+    // regular stream
+    if (!single) return send(msg, gdtc, dtype, did, true, on_sent);
+
+    // single packet carrier
+    GDTStream *gdt_stream = gdtc->allocate_stream_pool();
+    if (gdt_stream == nullptr) {
+        gdtc->get_stats(GDT_OUTBOUND_STATS)
+            ->strm_alloc_errors.add_fetch(1);
+        return 10;
+    }
+
+    // setup stream directly
+    gdt_stream->set_client(gdtc);
+    gdt_stream->reset(true);
+    gdt_stream->clear_callbacks();
+    gdt_stream->clear_params();
+    gdt_stream->set_destination(dtype, did);
+    gdt_stream->set_priority(msg->get_priority());
+    gdt_stream->set_trace(msg->get_trace());
+
+    // create body
+    asn1::GDTMessage *gdtm = gdt_stream->get_gdt_message();
+    // prepare body
+    if (gdtm->_body != nullptr) {
+        gdtm->_body->unlink(1);
+        gdtm->_body->_service_msg->set_linked_data(1);
+
+    } else {
+        gdtm->set_body();
+        gdtm->prepare();
+    }
+    asn1::ServiceMessage *sm = gdtm->_body->_service_msg;
+    if (!sm->_params) {
+        sm->set_params();
+        asn1::prepare(sm, sm->parent_node);
+    }
+
+    // set service id
+    sm->_service_id->set_linked_data(1,
+                                     (unsigned char *)msg->get_service_idp(),
+                                     sizeof(uint32_t));
+
+    // set service action
+    sm->_service_action->set_linked_data(1,
+                                         (unsigned char *)msg->get_service_actionp(),
+                                         1);
+
+    // params
+    asn1::Parameters *params = sm->_params;
+    for (unsigned int j = 0; j < pmap->size(); j++) {
+        ServiceParam *sc_param = (*pmap)[j];
+        // check if more allocations are needed
+        if (params->get_child(j) == nullptr) {
+            params->set_child(j);
+            params->get_child(j)->set_value();
+            params->get_child(j)->_value->set_child(0);
+            params->get_child(j)->_value->set_child(1);
+            params->get_child(j)->_value->set_child(2);
+            params->get_child(j)->_value->set_child(3);
+            // prepare
+            asn1::prepare(params, params->parent_node);
+        }
+        asn1::Parameter *gp = params->get_child(j);
+        // set gdt param id, data, index and type
+        gp->_id->set_linked_data(1,
+                                 (unsigned char *)sc_param->get_idp(),
+                                 sizeof(uint32_t));
+        gp->_value->get_child(0)->set_linked_data(1,
+                                                  sc_param->data_p,
+                                                  sc_param->data_size);
+        gp->_value->get_child(1)->set_linked_data(1,
+                                                  (unsigned char *)sc_param->get_fragmentation_p(),
+                                                  1);
+        gp->_value->get_child(2)->set_linked_data(1,
+                                                  (unsigned char *)&sc_param->index,
+                                                  1);
+        gp->_value->get_child(3)->set_linked_data(1,
+                                                  (unsigned char *)&sc_param->extra_type,
+                                                  1);
+    }
+
+    // remove unused chidren
+    for (unsigned int i = pmap->size(); i < params->children.size(); i++)
+        params->get_child(i)->unlink(1);
+
+    // encode and send (stream is returned to pool when sent)
+    gdt_stream->send_stateless();
+    stats.inc(SST_TX_SMSG_PIPELINED, 1);
+
+    // data already encoded, run sent handler
+    if (on_sent != nullptr) {
+        GDTCallbackArgs cb_args;
+        cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARGS_SRVC_MSG, msg);
+        cb_args.add_arg(GDT_CB_INPUT_ARGS, GDT_CB_ARG_CLIENT, gdtc);
+        on_sent->run(&cb_args);
+    }
+
+    // ok
+    return 0;
+}
+
 void gdt::ServiceMessageAsyncDone::run(GDTCallbackArgs *args) {
     auto smsg = (gdt::ServiceMessage *)args->get_arg(gdt::GDT_CB_INPUT_ARGS,
                                                      gdt::GDT_CB_ARGS_SRVC_MSG);
@@ -109,7 +109,9 @@ namespace gdt {
         /** ServiceMessage ending, all data received */
         GDT_ET_SRVC_MSG_COMPLETE        = 19,
         /** ServiceMessage error, missing or similar */
-        GDT_ET_SRVC_MSG_ERROR           = 20
+        GDT_ET_SRVC_MSG_ERROR           = 20,
+        /** Out capacity below low watermark (after congestion) */
+        GDT_ET_OUT_QUEUE_LOW            = 21
     };
 
     /**
@@ -136,6 +138,8 @@ namespace gdt {
         GDT_SF_CONTINUE         = 1,
         /** Sequence ending */
         GDT_SF_END              = 2,
+        /** Single packet sequence, no reply */
+        GDT_SF_STATELESS_NO_REPLY = 3,
         /** Single packet sequence */
         GDT_SF_STATELESS        = 4,
         /** Sequence continuing and waiting for peer or timeout */
@@ -144,6 +148,38 @@ namespace gdt {
         GDT_SF_HEARTBEAT        = 7,
     };
 
+    /**
+     * Payload priority class (local to a connection; class is
+     * not encoded in GDT header, routed packets are scheduled
+     * as NORMAL by routingd, heartbeats as CONTROL)
+     */
+    enum GDTPriority {
+        /** Control traffic (heartbeats, registration), always sent first */
+        GDT_PRIO_CONTROL        = 0,
+        /** Regular traffic */
+        GDT_PRIO_NORMAL         = 1,
+        /** Bulk transfers */
+        GDT_PRIO_BULK           = 2,
+        /** Number of priority classes */
+        GDT_PRIO_COUNT          = 3
+    };
+
+    /**
+     * Connection capabilities (exchanged during registration)
+     */
+    enum GDTCapability {
+        /** No optional capabilities */
+        GDT_CAP_NONE            = 0x00,
+        /** Compressed ServiceMessage params */
+        GDT_CAP_COMPRESSION     = 0x01,
+        /** Pipelined (single packet) ServiceMessages */
+        GDT_CAP_PIPELINING      = 0x02
+    };
+
+    /** Capabilities advertised by local end point */
+    constexpr uint32_t GDT_LOCAL_CAPS = GDT_CAP_COMPRESSION |
+                                        GDT_CAP_PIPELINING;
+
     /**
      * Callback Arguments type
      */
@@ -413,6 +449,14 @@ namespace gdt {
         GDTStream *last_linked_side;
         /** Stream initiator */
         GDTStreamInitiatorType initiator;
+        /** Stream creation timestamp (monotonic usec) */
+        uint64_t created_ts;
+        /** Hop trace flag */
+        bool trace;
+        /** Hop trace header data (current hop, max hops; big endian) */
+        uint32_t trace_hops[2];
+        /** Hop trace origin timestamp (big endian) */
+        uint64_t trace_ts;
 
     public:
         GDTStream();
@@ -545,6 +589,19 @@ namespace gdt {
          */
         void send(bool include_body = true);
 
+        /**
+         * Generate single packet sequence header (no reply) and push
+         * to output queue; stream is not added to the list of active
+         * streams and is returned to pool when sent
+         */
+        void send_stateless();
+
+        /**
+         * Set priority class of stream payload
+         * @param[in]   prio        Priority class
+         */
+        void set_priority(GDTPriority prio);
+
         /**
          * Set client connection
          * @param[in]   _client     Pointer to client connection
@@ -646,6 +703,100 @@ namespace gdt {
          */
         void set_timeout_status(bool _status);
 
+        /**
+         * Enable or disable hop tracing; traced stream carries a list
+         * of per-hop timestamps in HopInfo header field
+         * @param[in]   _trace  Trace flag
+         */
+        void set_trace(bool _trace);
+
+        /**
+         * Get hop trace status
+         * @return  Hop trace flag
+         */
+        bool get_trace() const;
+
+    };
+
+    /** Max number of hop timestamps carried in HopInfo */
+    const unsigned int GDT_TRACE_MAX_HOPS = 16;
+
+    /**
+     * Get hop trace from GDT message; first timestamp is set by
+     * stream originator, others are appended by each routing hop
+     * @param[in]       msg         Pointer to GDT message
+     * @param[in]       session_id  GDT message session id
+     * @param[out]      ts          Output buffer (usec, CLOCK_REALTIME)
+     * @param[in,out]   count       Output buffer size/number of timestamps
+     * @return      0 for success or 1 if trace is not present
+     */
+    int get_hop_trace(asn1::GDTMessage *msg,
+                      uint64_t session_id,
+                      uint64_t *ts,
+                      unsigned int *count);
+
+    /**
+     * Log bucketed latency histogram (usec); HDR style, values are
+     * grouped by power of two and split into linear sub-buckets
+     * (max relative error 12.5%)
+     */
+    class GDTLatencyHistogram {
+    public:
+        /** Sub-bucket bits */
+        static const unsigned int SUB_BITS = 3;
+        /** Max tracked power of two (2^36 usec, ~19h) */
+        static const unsigned int MAX_EXP = 36;
+        /** Number of buckets */
+        static const unsigned int BUCKETS = (1 << SUB_BITS) +
+                                            (MAX_EXP - SUB_BITS) * (1 << SUB_BITS);
+
+        GDTLatencyHistogram() = default;
+        ~GDTLatencyHistogram() = default;
+        GDTLatencyHistogram(const GDTLatencyHistogram &o) = delete;
+        GDTLatencyHistogram& operator=(GDTLatencyHistogram& rhs);
+
+        /**
+         * Record sample
+         * @param[in]   usec    Latency in usec
+         */
+        void record(uint64_t usec);
+
+        /**
+         * Get percentile (bucket upper bound)
+         * @param[in]   permille    Percentile in 1/10 of a percent
+         *                          (500 = p50, 990 = p99, 999 = p99.9)
+         * @return      Latency in usec
+         */
+        uint64_t percentile(unsigned int permille);
+
+        /**
+         * Get number of samples
+         * @return      Number of samples
+         */
+        uint64_t get_count();
+
+        /**
+         * Get max sample
+         * @return      Max latency in usec
+         */
+        uint64_t get_max();
+
+        /**
+         * Get current monotonic time
+         * @return      Monotonic time in usec
+         */
+        static uint64_t now();
+
+    private:
+        static unsigned int bucket(uint64_t usec);
+        static uint64_t bucket_value(unsigned int idx);
+
+        /** Bucket counters */
+        mink::Atomic<uint64_t> buckets[BUCKETS];
+        /** Sample count */
+        mink::Atomic<uint64_t> count;
+        /** Max sample */
+        mink::Atomic<uint64_t> max;
     };
 
     /**
@@ -681,6 +832,20 @@ namespace gdt {
         mink::Atomic<uint64_t> strm_timeout;
         /** Stream loopback */
         mink::Atomic<uint64_t> strm_loopback;
+        /** Queue depth (payloads in out queue) */
+        mink::Atomic<uint64_t> queue_depth;
+        /** Queue depth high watermark */
+        mink::Atomic<uint64_t> queue_hwm;
+        /** Queue congestion events (high watermark reached) */
+        mink::Atomic<uint64_t> queue_congested;
+        /** Stream latency (creation to completion) */
+        GDTLatencyHistogram lat_stream;
+        /** Out queue latency (push to send) */
+        GDTLatencyHistogram lat_queue;
+        /** In processing latency (decode to callback completion) */
+        GDTLatencyHistogram lat_process;
+        /** Traced stream latency (origin to local delivery) */
+        GDTLatencyHistogram lat_trace;
 
         GDTStats() = default;
         ~GDTStats() = default;
@@ -699,6 +864,7 @@ namespace gdt {
         void process_sf_continue(GDTStream *tmp_stream, bool remove_stream = true);
         void process_sf_end(GDTStream *tmp_stream, bool remove_stream = true);
         void process_sf_stream_complete(GDTStream *tmp_stream);
+        void record_in_latency();
 
         GDTClient *gdtc;
         int res;
@@ -730,6 +896,8 @@ namespace gdt {
         asn1::TLVNode *uuid_tlv;
         char d_id[17];
         char d_type[17];
+        uint64_t ts_decode;
+        bool traced;
     };
 
     /**
@@ -879,6 +1047,8 @@ namespace gdt {
         mink::Atomic<uint8_t> active;
         /** Router capabilities flag */
         bool router;
+        /** End point capabilities */
+        mink::Atomic<uint32_t> peer_caps;
         mink::Atomic<uint8_t> registered;
         /** Stream timeout check flag */
         mink::Atomic<uint8_t> stream_timeout_check;
@@ -887,7 +1057,35 @@ namespace gdt {
         /** List of active streams */
         std::vector<GDTStream*> streams;
         mink::RingBuffer<GDTPayload*> out_queue;
+        /** CONTROL class out queue (never waits behind bulk payloads) */
+        mink::RingBuffer<GDTPayload*> ctrl_out_queue;
+        /** BULK class out queue (bulk bursts do not delay NORMAL payloads) */
+        mink::RingBuffer<GDTPayload*> bulk_out_queue;
         lockfree::SpscQ<GDTPayload> internal_out_queue;
+        /** Per priority class out queues (OUT thread only) */
+        std::deque<GDTPayload*> prio_out_queue[GDT_PRIO_COUNT];
+        /** Bytes staged per priority class queue (OUT thread only) */
+        unsigned int prio_staged[GDT_PRIO_COUNT];
+        /** DRR quantum (bytes) per priority class */
+        mink::Atomic<unsigned int> drr_quantum[GDT_PRIO_COUNT];
+        /** DRR deficit counter per priority class */
+        unsigned int drr_deficit[GDT_PRIO_COUNT];
+        /** DRR current priority class */
+        unsigned int drr_class;
+        /** DRR quantum added for current class */
+        bool drr_active;
+        /** Out capacity low watermark (queued payloads) */
+        unsigned int out_wm_low;
+        /** Out capacity high watermark (queued payloads) */
+        unsigned int out_wm_high;
+        /** Out capacity congestion flag */
+        mink::Atomic<uint8_t> out_congested;
+        /** GDT_ET_OUT_QUEUE_LOW event pending flag */
+        mink::Atomic<uint8_t> out_low_pending;
+        /** Out capacity mutex */
+        pthread_mutex_t mtx_out_cap;
+        /** Out capacity condition */
+        pthread_cond_t cond_out_cap;
         mink::Atomic<unsigned int> thread_count;
         /** Inbound thread id */
         pthread_t in_thread;
@@ -1076,6 +1274,19 @@ namespace gdt {
          */
         bool is_router() const;
 
+        /**
+         * Set capabilities advertised by end point
+         * @param[in]   _caps       Capability flags (GDTCapability)
+         */
+        void set_peer_caps(uint32_t _caps);
+
+        /**
+         * Check if end point supports capability
+         * @param[in]   cap         Capability flag
+         * @return  True if supported or False otherwise
+         */
+        bool has_peer_cap(GDTCapability cap);
+
         /**
          * Initialize threads
          */
@@ -1161,17 +1372,73 @@ namespace gdt {
 
 
         /**
-         * Push to output queue
+         * Push to output queue; CONTROL class payloads are
+         * classified here and queued separately, they are not
+         * subject to out queue backpressure
          * @param[in]   payload Pointer to GDT payload
          * @return      0 for success or -1 if error occurred
          */
         int push_out_queue(GDTPayload *payload);
 
         /**
-         * Pop from output queue
+         * Pop from output queue (CONTROL class queue first)
          */
         GDTPayload* pop_out_queue();
 
+        /**
+         * Pop from NORMAL or BULK class output queue
+         * @param[in]   prio    Priority class
+         * @return      Pointer to payload or NULL if queue is empty
+         */
+        GDTPayload* pop_out_queue(GDTPriority prio);
+
+        /**
+         * Move queued payloads to per priority class queues (up to
+         * one DRR quantum per class) and select next payload for
+         * sending; CONTROL class is always served first, other
+         * classes are served using deficit round robin (OUT thread
+         * only)
+         * @return      Pointer to payload or NULL if queues are empty
+         */
+        GDTPayload* schedule_out();
+
+        /**
+         * Set DRR weight of priority class; class gets weight *
+         * MEM_CSIZE bytes per round (ignored for CONTROL class)
+         * @param[in]   prio        Priority class
+         * @param[in]   weight      Class weight (min 1)
+         */
+        void set_prio_weight(GDTPriority prio, unsigned int weight);
+
+        /**
+         * Set out capacity watermarks; client becomes congested when
+         * number of payloads in out queue reaches high watermark and is
+         * released (GDT_ET_OUT_QUEUE_LOW event) when it drops to low
+         * watermark
+         * @param[in]   low_pct     Low watermark (% of max concurrent streams)
+         * @param[in]   high_pct    High watermark (% of max concurrent streams)
+         */
+        void set_out_watermarks(unsigned int low_pct, unsigned int high_pct);
+
+        /**
+         * Get current out queue depth
+         * @return      Number of payloads in out queue
+         */
+        unsigned int get_out_depth();
+
+        /**
+         * Check out capacity congestion flag
+         * @return      True if congested
+         */
+        bool is_out_congested();
+
+        /**
+         * Wait until client is not congested
+         * @param[in]   timeout_ms  Timeout in msec (0 for non blocking check)
+         * @return      0 if capacity is available or 1 on timeout
+         */
+        int wait_out_capacity(unsigned int timeout_ms);
+
         /**
          * Set session connection
          * @param[in]   _session    Pointer to session connection
@@ -1499,6 +1766,10 @@ namespace gdt {
         GDTStream *stream;
         /** Processed in out queue flag */
         mink::Atomic<uint8_t> out;
+        /** Priority class */
+        GDTPriority priority;
+        /** Out queue push timestamp (monotonic usec, 0 if not queued) */
+        uint64_t ts_queued;
     };
 
     /**
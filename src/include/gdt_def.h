@@ -553,6 +553,10 @@ namespace asn1 {
         static const int _pt_mink_status = 6018;
         static const int _pt_mink_status_msg = 6019;
         static const int _pt_mink_persistent_correlation = 6020;
+        static const int _pt_mink_gdt_capabilities = 6021;
+        static const int _pt_mink_sub_interval = 6022;
+        static const int _pt_mink_sub_cancel = 6023;
+        static const int _pt_mink_sub_snapshot = 6024;
         static const int _pt_mink_routing_destination = 6100;
         static const int _pt_mink_routing_source = 6101;
         static const int _pt_mink_routing_gateway = 6102;
@@ -769,9 +773,13 @@ namespace asn1 {
         HopInfo(const HopInfo &o);
         HopInfo &operator=(const HopInfo &o);
         ~HopInfo() override;
+        // optional
+        ASN1Node* create_node(unsigned int _index) override;
+        void set_hop_trace();
         // nodes
         Integer* _current_hop;
         Integer* _max_hops;
+        Octet_string* _hop_trace;
     };
 
     // ErrorCode
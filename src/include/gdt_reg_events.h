@@ -32,8 +32,10 @@ namespace gdt {
         uint32_t pm_dtype;
         uint32_t pm_did;
         uint32_t pm_router;
+        uint32_t pm_caps;
         uint32_t reg_action;
         int router_flag;
+        uint32_t caps;
         GDTClient* client;
         GDTCallbackMethod* sdone;
         mink::Atomic<uint8_t> done_signal;
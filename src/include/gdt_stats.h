@@ -111,6 +111,23 @@ namespace gdt {
         mink::Atomic<uint64_t> *sval_p;
     };
 
+    // GDTLatencyHandler
+    class GDTLatencyHandler : public GDTTrapHandler {
+    public:
+        /**
+         * Latency histogram trap
+         * @param[in]   _hist       Pointer to latency histogram
+         * @param[in]   _permille   Percentile in 1/10 of a percent,
+         *                          0 for max value
+         */
+        GDTLatencyHandler(GDTLatencyHistogram *_hist, unsigned int _permille);
+        void run() override;
+
+    private:
+        GDTLatencyHistogram *hist;
+        unsigned int permille;
+    };
+
     // GDTStatsClientCreated
     class GDTStatsClientCreated : public gdt::GDTCallbackMethod {
     public:
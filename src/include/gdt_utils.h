@@ -13,8 +13,10 @@
 
 #include <gdt.h>
 #include <map>
+#include <list>
 #include <pool.h>
 #include <mink_utils.h>
+#include <zlib.h>
 
 // types
 using gdt_vpmap_t = mink_utils::PooledVPMap<uint32_t>;
@@ -239,6 +241,8 @@ namespace gdt {
 
         /** internal data buffer size */
         static constexpr int DATA_SZ = 256;
+        /** extra type flag, param data is compressed */
+        static constexpr int COMPRESSED_FLAG = 0x80;
 
     protected:
         /** Lock mutex */
@@ -278,6 +282,8 @@ namespace gdt {
         GDTCallbackHandler cb_handler;
         int fragments;
         int fragment_index;
+        /** Compressed data buffer (reused by pooled params) */
+        std::vector<unsigned char> zbuff;
         /** Fragmentation finished, last fragment */
         static bool FRAGMENTATION_DONE;
         /** Fragmentation in progress, more fragments coming */
@@ -620,6 +626,15 @@ namespace gdt {
         GDTCallbackMethod *usr_stream_hndlr = nullptr;
     };
 
+    class ServiceDatagramHandler : public gdt::GDTCallbackMethod {
+    public:
+        ServiceDatagramHandler() = default;
+        // handler method for pipelined ServiceMessages
+        void run(gdt::GDTCallbackArgs *args) override;
+        // service message manager
+        ServiceMsgManager *smsg_m = nullptr;
+    };
+
     class ServiceMessageDone : public gdt::GDTCallbackMethod {
     public:
         ServiceMessageDone();
@@ -633,6 +648,7 @@ namespace gdt {
     public:
         void run(gdt::GDTCallbackArgs *args) override;
         ServiceMessage *smsg;
+        std::vector<ServiceParam *> *pmap;
         unsigned int pc;
         unsigned int pos;
         unsigned int pindex;
@@ -824,6 +840,31 @@ namespace gdt {
         bool set_complete(bool _is_complete);
         bool set_auto_free(bool _auto_free);
         bool get_auto_free() const;
+
+        /**
+         * Set GDT priority class used when sending this message
+         * @param[in]   prio        Priority class
+         */
+        void set_priority(GDTPriority prio);
+
+        /**
+         * Get GDT priority class
+         * @return      Priority class
+         */
+        GDTPriority get_priority() const;
+
+        /**
+         * Enable GDT hop tracing when sending this message
+         * @param[in]   _trace      Trace flag
+         */
+        void set_trace(bool _trace);
+
+        /**
+         * Get GDT hop tracing flag
+         * @return      Trace flag
+         */
+        bool get_trace() const;
+
         void set_callback(GDTEventType type, GDTCallbackMethod *cback);
         bool process_callback(GDTEventType type, GDTCallbackArgs *args);
         void clear_callbacks();
@@ -831,12 +872,21 @@ namespace gdt {
         mink_utils::ParameterMap<uint32_t, void *> params;
         mink_utils::PooledVPMap<uint32_t> vpmap;
         bool missing_params;
+        /** Received as single packet (pipelined mode) */
+        bool pipelined;
+
+        // friend with ServiceMsgManager
+        friend class ServiceMsgManager;
 
     private:
         /** IDT mapping */
         ParamIdTypeMap *idt_map;
         /** Service parameter list */
         std::vector<ServiceParam *> tlvs; /**< Service parameter list */
+        /** Send list (tlvs with send-local substitutes) */
+        std::vector<ServiceParam *> stlvs;
+        /** Send-local params (compressed copies, caps) */
+        std::vector<ServiceParam *> ztlvs;
         /** Service id */
         uint32_t service_id;
         /** Service action */
@@ -859,6 +909,18 @@ namespace gdt {
         mink::Atomic<uint32_t> recv_param_count;
         GDTCallbackHandler cb_handler;
         bool auto_free;
+        /** GDT priority class */
+        GDTPriority priority;
+        /** GDT hop trace flag */
+        bool trace;
+        /** Inflate stream for compressed params (reused by pooled messages) */
+        z_stream zstrm;
+        /** Inflate stream initialized flag */
+        bool zstrm_init;
+        /** Compressed param in progress */
+        bool zstrm_active;
+        /** Inflated data not yet delivered */
+        std::vector<unsigned char> zbuff;
     };
 
     /**
@@ -866,7 +928,11 @@ namespace gdt {
      */
     enum SrvcSatsType{
         SST_RX_SMSG_POOL_EMPTY          = 1,
-        SST_RX_SPARAM_POOL_EMPTY        = 2
+        SST_RX_SPARAM_POOL_EMPTY        = 2,
+        SST_TX_SPARAM_COMPRESSED        = 3,
+        SST_RX_SPARAM_INFLATE_ERROR     = 4,
+        SST_TX_SMSG_PIPELINED           = 5,
+        SST_RX_SMSG_PIPELINED           = 6
     };
 
     /**
@@ -944,6 +1010,39 @@ namespace gdt {
                  const char *did, bool async = false,
                  gdt::GDTCallbackMethod *on_sent = &cb_async_done);
 
+        /**
+         * Send service message in pipelined mode; message is encoded
+         * in a single stateless packet (no stream setup, no reply) and
+         * correlated by peer using _pt_mink_guid param. Falls back to
+         * regular async send() if message does not fit in a single
+         * packet or if pipelining is not supported (or not known to
+         * be supported) by next hop and end point.
+         * Delivery and routing errors are not reported back to
+         * sender; callers should use it only when requested.
+         * @param[in]   msg                     Pointer to service message
+         * @param[in]   gdtc                    Pointer to GDT client
+         * @param[in]   dtype                   Pointer to destination daemon type C string
+         * @param[in]   did                     Pointer to destination daemon id C string
+         * @param[in]   on_sent                 Pointer to message sent event handler
+         *                                      (called as soon as message is encoded)
+         * @return      0 for success or error code
+         */
+        int send_pipelined(ServiceMessage *msg, GDTClient *gdtc,
+                           const char *dtype, const char *did,
+                           gdt::GDTCallbackMethod *on_sent = &cb_async_done);
+
+        /**
+         * Wait for GDT client out capacity (backpressure); producers
+         * should call this before creating new service messages.
+         * Register GDT_ET_OUT_QUEUE_LOW handler on GDT client for
+         * non blocking notification.
+         * @param[in]   gdtc                    Pointer to GDT client
+         * @param[in]   timeout_ms              Timeout in msec (0 for non
+         *                                      blocking check)
+         * @return      0 if capacity is available or 1 on timeout
+         */
+        int wait_capacity(GDTClient *gdtc, unsigned int timeout_ms);
+
         /**
          * Sync sparam map to reflect vpmap
          * @param[in]   msg                     Pointer to service message
@@ -1001,11 +1100,121 @@ namespace gdt {
         void set_msg_err_handler(GDTCallbackMethod *hndlr);
         bool process_callback(GDTEventType type, GDTCallbackArgs *args);
 
+        /**
+         * Set param compression threshold; params larger than
+         * threshold are compressed if supported by end point
+         * @param[in]   threshold       Size in bytes (0 to disable)
+         */
+        void set_compression_threshold(unsigned int threshold);
+
+        /**
+         * Get param compression threshold
+         * @return      Size in bytes (0 if disabled)
+         */
+        unsigned int get_compression_threshold() const;
+
+        /**
+         * Inflate compressed GDT param and pass data to
+         * vpmap/param stream handlers as regular fragments
+         * @param[in]   smsg            Pointer to service message
+         * @param[in]   p               Pointer to GDT param
+         * @param[in]   in_sess         GDT session id
+         * @return      0 for success or error code
+         */
+        int process_zparam(ServiceMessage *smsg,
+                           asn1::Parameter *p,
+                           uint64_t in_sess);
+
+        /**
+         * Check if end point supports capability; next hop caps are
+         * used for direct connections, caps learned from received
+         * messages are used for routed end points
+         * @param[in]   gdtc            Pointer to next hop GDT client
+         * @param[in]   dtype           Destination daemon type
+         * @param[in]   did             Destination daemon id
+         * @param[in]   cap             Capability
+         * @return      True if supported
+         */
+        bool end_has_cap(GDTClient *gdtc,
+                         const char *dtype,
+                         const char *did,
+                         GDTCapability cap);
+
+        /**
+         * Learn end point caps from received caps param
+         * @param[in]   in_msg          Pointer to GDT message
+         * @param[in]   p               Pointer to GDT param
+         * @param[in]   in_sess         GDT session id
+         * @return      True if param was caps param
+         */
+        bool learn_end_caps(asn1::GDTMessage *in_msg,
+                            asn1::Parameter *p,
+                            uint64_t in_sess);
+
+        /**
+         * Forget learned end point caps (message without caps param)
+         * @param[in]   in_msg          Pointer to GDT message
+         * @param[in]   in_sess         GDT session id
+         */
+        void forget_end_caps(asn1::GDTMessage *in_msg,
+                             uint64_t in_sess);
+
         /** MAX parameter size constant */
         static const int MAX_PARAMS_SIZE = MEM_CSIZE - 256;
+        /** Default param compression threshold */
+        static const unsigned int COMPRESSION_THRESHOLD = 1024;
+        /** Max number of learned end point caps */
+        static const unsigned int MAX_END_CAPS = 4096;
         mink_utils::StatsManager stats;
 
     private:
+        /**
+         * Compress param data into send-local param (per-thread
+         * deflate context); original param is not modified
+         * @param[in]   param           Pointer to service param
+         * @return      Pointer to compressed param or nullptr
+         */
+        ServiceParam *compress_param(ServiceParam *param);
+
+        /**
+         * Free send-local params of previous send
+         * @param[in]   msg             Pointer to service message
+         */
+        void free_send_params(ServiceMessage *msg);
+
+        /**
+         * Pass inflated data chunk as param fragment
+         * @param[in]   smsg            Pointer to service message
+         * @param[in]   id              Param id
+         * @param[in]   index           Param index
+         * @param[in]   extra_type      Param extra type
+         * @param[in]   data            Pointer to data chunk
+         * @param[in]   size            Data chunk size
+         * @param[in]   et              Param stream event type
+         * @return      0 for success or error code
+         */
+        int zparam_fragment(ServiceMessage *smsg,
+                            uint32_t id,
+                            uint32_t index,
+                            int extra_type,
+                            const unsigned char *data,
+                            unsigned int size,
+                            GDTEventType et);
+
+        /** Param compression threshold */
+        unsigned int z_threshold;
+        /** Learned end point caps entry */
+        struct EndCaps {
+            uint32_t caps;
+            /** Position in LRU list */
+            std::list<std::string>::iterator lru;
+        };
+        /** Learned end point caps ("type:id") */
+        std::map<std::string, EndCaps> end_caps;
+        /** End points, most recently learned first */
+        std::list<std::string> end_caps_lru;
+        /** End point caps mutex */
+        pthread_mutex_t mtx_caps;
         /** Random number generator */
         mink_utils::Randomizer random_gen;
         /** Service message semaphore */
@@ -1020,6 +1229,8 @@ namespace gdt {
         ServiceStreamHandlerNew srvcs_hndlr;
         /** New client stream handler (GDT server) */
         ServiceStreamNewClient srvcs_nc;
+        /** Pipelined service message handler */
+        ServiceDatagramHandler srvcs_dgram;
         GDTCallbackHandler cb_handler;
         static ServiceMessageAsyncDone cb_async_done;
     };
@@ -17,6 +17,22 @@
 using json = nlohmann::basic_json<nlohmann::ordered_map>;
 
 namespace json_rpc {
+    // Payload encoding (selected per connection)
+    enum Encoding { ENC_JSON = 0, ENC_CBOR };
+
+    // WebSocket subprotocol for CBOR payloads
+    constexpr const char *CBOR_SUBPROTOCOL = "mink.cbor";
+
+    // Serialize using selected encoding (invalid
+    // UTF-8 in JSON text is replaced with U+FFFD)
+    std::string encode(const json &j, const Encoding enc);
+    // Parse using selected encoding; discarded
+    // value is returned on error
+    json decode(const char *data, const std::size_t len, const Encoding enc);
+    // Guess encoding from first byte (JSON text starts
+    // with '{', '[' or whitespace)
+    Encoding detect_encoding(const char *data, const std::size_t len);
+
     class JsonRpc {
     public:
         explicit JsonRpc(const json &data);
@@ -38,7 +54,11 @@ namespace json_rpc {
         const std::string &get_auth_crdts() const;
         const std::string &get_mink_dtype() const;
         const std::string *get_mink_did() const;
+        const json *get_mink_did_list() const;
         int get_mink_timeout() const;
+        int get_mink_interval() const;
+        int get_mink_unsubscribe() const;
+        bool get_mink_pipelined() const;
 
         // static methods
         static json gen_err(const int code, const std::string &msg);
@@ -65,6 +85,9 @@ namespace json_rpc {
         static const char *MINK_DID_;
         static const char *MINK_CREDENTIALS_;
         static const char *MINK_TIMEOUT_;
+        static const char *MINK_INTERVAL_;
+        static const char *MINK_UNSUBSCRIBE_;
+        static const char *MINK_PIPELINED_;
 
     private:
         // valid json rpc 2.0 message
@@ -79,6 +102,47 @@ namespace json_rpc {
         bool has_mink_did_ = false;
     };
 
+    // Reply serializer, writes "result" reply directly
+    // into caller's buffer (no json DOM); JSON text or CBOR
+    class JsonRpcWriter {
+    public:
+        explicit JsonRpcWriter(std::string &out, const Encoding enc = ENC_JSON);
+        ~JsonRpcWriter() = default;
+        JsonRpcWriter(const JsonRpcWriter &o) = delete;
+        JsonRpcWriter &operator=(const JsonRpcWriter &o) = delete;
+
+        void begin_result(const int id);
+        void add_item(const std::string &name,
+                      const char *val,
+                      const std::size_t len,
+                      const int idx);
+        void end_result();
+        // append quoted and escaped string (invalid
+        // UTF-8 is replaced with U+FFFD)
+        static void append_str(std::string &out,
+                               const char *s,
+                               const std::size_t len);
+        // CBOR item head (major type and argument)
+        static void cbor_head(std::string &out,
+                              const uint8_t major,
+                              const uint64_t arg);
+        // CBOR signed integer
+        static void cbor_int(std::string &out, const int64_t v);
+        // CBOR text string (byte string if not valid UTF-8)
+        static void cbor_str(std::string &out,
+                             const char *s,
+                             const std::size_t len);
+        // length of valid UTF-8 sequence at c[i], 0 if invalid
+        static std::size_t utf8_seq(const unsigned char *c,
+                                    const std::size_t i,
+                                    const std::size_t len);
+
+    private:
+        std::string &out_;
+        Encoding enc_;
+        bool first_ = true;
+    };
+
 } // namespace json_rpc
 
 #endif /* ifndef MINK_JSON_RPC_HNDLR_H */
@@ -22,6 +22,8 @@ namespace mink {
             EC_AUTH_FAILED          = -5,
             EC_AUTH_UNKNOWN_USER    = -6,
             EC_AUTH_USER_BANNED     = -7,
+            EC_SUB_NOT_FOUND        = -8,
+            EC_BUSY                 = -9,
             EC_UNKNOWN              = -9999
         };
     }
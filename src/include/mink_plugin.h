@@ -12,20 +12,24 @@
 #define MINK_PLUGIN
 
 #include <daemon.h>
+#include <mink_err_codes.h>
 #include <memory>
 #include <vector>
-#include <boost/signals2.hpp>
-
-/***********/
-/* Aliases */
-/***********/
-namespace bs2 = boost::signals2;
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <boost/utility/string_view.hpp>
+#include <condition_variable>
+#include <atomic>
+#include <array>
 
 namespace mink_utils {
     // types
     using Plugin_args = std::vector<std::string>;
     using Plugin_data_std = std::vector<std::map<std::string, std::string>>;
-    using Plugin_signal = bs2::signal<std::string(Plugin_data_std &)>;
 
     /**
      * Plugin function names
@@ -34,7 +38,9 @@ namespace mink_utils {
     extern std::string const PLG_TERM_FN;
     extern std::string const PLG_CMD_HNDLR;
     extern std::string const PLG_CMD_HNDLR_LOCAL;
+    extern std::string const PLG_CMD_HNDLR_ASYNC;
     extern std::string const PLG_CMD_LST;
+    extern std::string const PLG_UNLOADABLE;
 
     // fwd declaration
     struct PluginDescriptor;
@@ -71,14 +77,339 @@ namespace mink_utils {
         void *data_;
     };
 
+    // async handler result; command not supported
+    // in async mode, run sync handler instead
+    constexpr int PLG_ASYNC_NA = 2;
+
+    /**
+     * Async command completion handle; plugin calls done()
+     * exactly once (from any thread) when command has
+     * finished. Handle is freed by done()
+     */
+    class PluginCompletion {
+    public:
+        using cb_t = std::function<void(int res)>;
+
+        explicit PluginCompletion(cb_t &&cb) : cb_(std::move(cb)) {}
+        ~PluginCompletion() = default;
+        PluginCompletion(const PluginCompletion &o) = delete;
+        PluginCompletion &operator=(const PluginCompletion &o) = delete;
+
+        void done(int res) {
+            cb_(res);
+            delete this;
+        }
+
+    private:
+        cb_t cb_;
+    };
+
+    // plugin data value type
+    enum PluginValueType {
+        PVT_NONE    = 0,
+        PVT_INT     = 1,
+        PVT_DOUBLE  = 2,
+        PVT_STRING  = 3,
+        PVT_BYTES   = 4
+    };
+
+    // plugin data value (strings and bytes are not owned)
+    struct PluginValue {
+        PluginValueType type = PVT_NONE;
+        union {
+            int64_t i;
+            double d;
+        };
+        boost::string_view s;
+
+        PluginValue() : i(0) {}
+        // stringified value
+        std::string str() const;
+    };
+
+    // plugin data column
+    struct PluginColumn {
+        boost::string_view key;
+        PluginValue value;
+    };
+
+    /**
+     * Plugin-to-plugin data; rows of typed key/value columns.
+     * Columns of all rows are kept in one array, strings are
+     * copied to arena (NUL terminated) or referenced (add_ref)
+     * if caller's data outlives this object
+     */
+    class PluginData {
+    public:
+        PluginData() = default;
+        ~PluginData() = default;
+        PluginData(const PluginData &o) = delete;
+        PluginData &operator=(const PluginData &o) = delete;
+
+        // number of rows
+        std::size_t size() const { return rows_.size(); }
+        bool empty() const { return rows_.empty(); }
+        // number of columns in row r
+        std::size_t row_size(std::size_t r) const;
+        // add empty row, returns row index
+        std::size_t add_row();
+        // remove all data (arena memory is kept)
+        void clear();
+
+        /**
+         * Add column to row r
+         *
+         * @param[in]   r       Row index
+         * @param[in]   k       Column key
+         * @param[in]   v       Column value
+         * @return      0 for success, 1 if row does not exist
+         *              or key already present in row
+         */
+        int add(std::size_t r, boost::string_view k, int64_t v);
+        int add(std::size_t r, boost::string_view k, double v);
+        int add(std::size_t r, boost::string_view k, int v) {
+            return add(r, k, static_cast<int64_t>(v));
+        }
+        int add(std::size_t r,
+                boost::string_view k,
+                boost::string_view v,
+                PluginValueType t = PVT_STRING);
+        // string literal (not bool)
+        int add(std::size_t r, boost::string_view k, const char *v) {
+            return add(r, k, boost::string_view(v));
+        }
+        // zero-copy; key and value are not copied
+        int add_ref(std::size_t r,
+                    boost::string_view k,
+                    boost::string_view v,
+                    PluginValueType t = PVT_STRING);
+
+        // column c of row r (nullptr if not found)
+        const PluginColumn *get(std::size_t r, std::size_t c) const;
+        // column with key k in row r (nullptr if not found)
+        const PluginColumn *find(std::size_t r, boost::string_view k) const;
+
+        // deep copy (referenced data is copied to arena)
+        void assign(const PluginData &o);
+
+        // adapters (Plugin_data_std)
+        void from_std(const Plugin_data_std &d);
+        void to_std(Plugin_data_std &d) const;
+
+    private:
+        int insert(std::size_t r, const PluginColumn &c);
+        boost::string_view store(boost::string_view s);
+
+        static constexpr std::size_t ARENA_BLOCK_SIZE = 4096;
+
+        // columns (all rows)
+        std::vector<PluginColumn> cols_;
+        // index of first column (per row)
+        std::vector<uint32_t> rows_;
+        // arena blocks
+        std::vector<std::unique_ptr<char[]>> arena_;
+        // large strings (dedicated blocks)
+        std::vector<std::unique_ptr<char[]>> big_;
+        // free space in last block
+        char *a_ptr_ = nullptr;
+        std::size_t a_free_ = 0;
+    };
+
     // Signal handler
     class SignalHandler {
     public:
         SignalHandler() = default;
         virtual ~SignalHandler() = default;
-        virtual std::string operator()(Plugin_data_std &d) const = 0;
+        virtual std::string operator()(PluginData &d) const = 0;
+        // async delivery lane; handlers subscribed with
+        // more than one lane can be run concurrently for
+        // different lanes
+        virtual std::string run_lane(PluginData &d, std::size_t lane) const {
+            return (*this)(d);
+        }
+    };
+
+    // signal delivery mode
+    enum SignalDelivery {
+        // handler runs on emitting thread
+        SD_SYNC     = 0,
+        // handler runs in signal worker pool (data is copied)
+        SD_ASYNC    = 1
+    };
+
+    // async queue policy (queue full)
+    enum SignalPolicy {
+        // drop oldest queued event
+        SP_DROP_OLD = 0,
+        // drop new event
+        SP_DROP_NEW = 1,
+        // keep only the latest undelivered event
+        SP_COALESCE = 2
     };
 
+    // signal subscription options
+    struct SignalOpts {
+        SignalDelivery mode = SD_SYNC;
+        SignalPolicy policy = SP_DROP_OLD;
+        std::size_t qsize = 256;
+        // async lanes (queue and worker slot each); events
+        // with the same order key value use the same lane
+        // and are delivered in order
+        std::size_t lanes = 1;
+        // order key (column of first row); lanes are
+        // selected round-robin if empty
+        std::string order_key;
+    };
+
+    // signal stats
+    struct SignalStats {
+        std::string name;
+        std::size_t subs = 0;
+        uint64_t emitted = 0;
+        uint64_t delivered = 0;
+        uint64_t dropped = 0;
+        uint64_t coalesced = 0;
+    };
+
+    // async delivery lane
+    struct SignalLane {
+        // executor key
+        int id = 0;
+        // lane index
+        std::size_t idx = 0;
+        // async queue
+        std::mutex mtx;
+        std::deque<std::unique_ptr<PluginData>> q;
+        bool scheduled = false;
+    };
+
+    // signal subscriber
+    struct SignalSubscriber {
+        SignalHandler *h = nullptr;
+        SignalOpts opts;
+        // plugin that registered handler
+        std::shared_ptr<PluginDescriptor> owner;
+        // async lanes
+        std::vector<std::unique_ptr<SignalLane>> lanes;
+        // round-robin lane selection
+        std::atomic<std::size_t> rr{0};
+    };
+
+    // interned signal; subscriber list is replaced on
+    // registration (copy-on-write), emit is lock-free
+    struct Signal {
+        using subs_t = std::vector<std::shared_ptr<SignalSubscriber>>;
+        std::string name;
+        std::shared_ptr<const subs_t> subs;
+        std::atomic<uint64_t> emitted{0};
+        std::atomic<uint64_t> delivered{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> coalesced{0};
+    };
+
+
+    /** Command executor stats (per command id) */
+    struct CmdExecStats {
+        /** Command id */
+        int cmd_id = 0;
+        /** Queued tasks */
+        std::size_t depth = 0;
+        /** Running tasks */
+        std::size_t active = 0;
+        /** Completed tasks */
+        uint64_t done = 0;
+        /** Rejected tasks (queue full) */
+        uint64_t rejected = 0;
+        /** Average latency (queued + exec, usec) */
+        uint64_t lat_avg = 0;
+        /** Max latency (usec) */
+        uint64_t lat_max = 0;
+    };
+
+    /**
+     * Bounded command executor; fixed number of workers and
+     * one bounded queue per command id. Idle workers take
+     * tasks from ready queues in round-robin order, and one
+     * command cannot occupy more than max_active workers,
+     * so slow commands do not starve the fast ones.
+     */
+    class CmdExecutor {
+    public:
+        using task_t = std::function<void()>;
+
+        CmdExecutor() = default;
+        ~CmdExecutor();
+        CmdExecutor(const CmdExecutor &o) = delete;
+        CmdExecutor &operator=(const CmdExecutor &o) = delete;
+
+        /**
+         * Start workers
+         *
+         * @param[in]   workers     Number of worker threads
+         * @param[in]   qsize       Max queued tasks per command
+         * @param[in]   max_active  Max workers per command
+         *                          (0 = workers - 1)
+         * @return      0 for success
+         */
+        int start(std::size_t workers,
+                  std::size_t qsize,
+                  std::size_t max_active = 0);
+
+        /**
+         * Stop workers (running tasks are completed,
+         * queued tasks are discarded and their cancel
+         * handlers are called)
+         */
+        void stop();
+
+        /**
+         * Queue task
+         *
+         * @param[in]   cmd_id  Command id
+         * @param[in]   t       Task
+         * @param[in]   cancel  Called instead of task if task
+         *                      is discarded by stop (optional)
+         * @return      0 for success, 1 if rejected (queue
+         *              full or executor not running)
+         */
+        int submit(int cmd_id, task_t &&t, task_t &&cancel = nullptr);
+
+        /**
+         * Get stats
+         *
+         * @param[out]  out     Stats for each command id
+         */
+        void stats(std::vector<CmdExecStats> &out);
+
+    private:
+        using clock_t = std::chrono::steady_clock;
+        struct Task {
+            task_t t;
+            task_t cancel;
+            clock_t::time_point ts;
+        };
+        struct CmdQueue {
+            std::deque<Task> q;
+            std::size_t active = 0;
+            bool ready = false;
+            CmdExecStats st;
+            uint64_t lat_sum = 0;
+        };
+
+        void run();
+        void schedule(int cmd_id, CmdQueue &cq);
+
+        /** Queues (per command id) */
+        std::map<int, CmdQueue> queues;
+        /** Command ids with runnable tasks */
+        std::deque<int> ready;
+        std::vector<std::thread> workers;
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::size_t qsize = 0;
+        std::size_t max_active = 0;
+        bool active = false;
+    };
 
     /** MINK plugin manager */
     class PluginManager {
@@ -115,6 +446,26 @@ namespace mink_utils {
                                         int cmd_id,
                                         PluginInputData &data);
 
+        /**
+         * Plugin async cmd handler (optional); handler must
+         * not block, request is finished later by calling
+         * done() on completion handle
+         *
+         * @param[in]       pm      Pointer to MINK plugin manager
+         * @param[in]       pd      Pointer to plugin descriptor
+         * @param[in]       hk      MINK daemon hook
+         * @param[in,out]   data    Custom data
+         * @param[in]       c       Completion handle
+         * @return          0 if accepted (done() will be called),
+         *                  PLG_ASYNC_NA to use sync handler or
+         *                  error code (done() will not be called)
+         */
+        using plg_cmd_hndlr_async_t = int (*)(PluginManager *pm,
+                                              PluginDescriptor *pd,
+                                              int cmd_id,
+                                              PluginInputData &data,
+                                              PluginCompletion *c);
+
 
         PluginManager() = default;
         PluginManager(const PluginManager &o) = delete;
@@ -132,13 +483,35 @@ namespace mink_utils {
          PluginDescriptor *load(const std::string &fpath);
 
         /**
-         * Unload plugin; call plugin's terminate method and
-         * remove from list of active plugins
+         * Unload plugin; detach hooks and signal handlers, wait
+         * for in-flight commands, call plugin's terminate method
+         * and unmap plugin (only plugins exporting UNLOADABLE)
          *
          * @param[in]   pd          Pointer to plugin descriptor
-         * @return      0 for success or error
+         * @return      0 for success, 1 if not found, 2 if not
+         *              unloadable, 3 if still busy after timeout
+         *              (plugin is re-attached and keeps running)
          */
         int unload(PluginDescriptor *pd);
+        // file path variant
+        int unload(const std::string &fpath);
+
+        /**
+         * Reload plugin (or load if not loaded yet)
+         *
+         * @param[in]   fpath       Plugin file path
+         * @return      0 for success, unload error, 4 if
+         *              new version cannot be loaded or 5 if
+         *              old image is still mapped (old version
+         *              is re-initialised and keeps running)
+         */
+        int reload(const std::string &fpath);
+
+        // check if plugin is loaded
+        bool is_loaded(const std::string &fpath);
+
+        // command ids with attached plugins
+        void commands(std::vector<int> &out);
 
         /**
          * Run plugin hook
@@ -153,20 +526,120 @@ namespace mink_utils {
         // rvalue variant for data argument
         int run(int cmd_id, PluginInputData &&data, bool is_local = false);
 
-        // register signal handler
-        int register_signal(const std::string &s, SignalHandler *h);
-        // process signal
-        std::string process_signal(const std::string &s, Plugin_data_std &d);
+        /**
+         * Run plugin hook asynchronously; plugin's async handler
+         * is used if implemented, otherwise sync handler is
+         * queued in command executor
+         *
+         * @param[in]   cmd_id  Command id
+         * @param[in]   data    Custom data (input/output)
+         * @param[in]   cb      Completion callback (plugin
+         *                      result), called from any thread
+         *
+         * @return      0 if accepted (cb will be called),
+         *              EC_BUSY if executor queue is full or
+         *              error code (cb will not be called)
+         */
+        int run_async(int cmd_id,
+                      PluginInputData data,
+                      PluginCompletion::cb_t &&cb);
+
+        /**
+         * Get signal id (signal is created if needed); ids
+         * are stable, emitters should resolve them once
+         *
+         * @param[in]   s       Signal name
+         * @return      signal id or -1 if signal table is full
+         */
+        int signal_id(const std::string &s);
+
+        /**
+         * Register signal handler
+         *
+         * @param[in]   s       Signal name
+         * @param[in]   h       Signal handler (not owned)
+         * @param[in]   opts    Delivery options
+         * @return      0 for success
+         */
+        int register_signal(const std::string &s,
+                            SignalHandler *h,
+                            const SignalOpts &opts = SignalOpts());
+
+        /**
+         * Process signal; sync handlers are run on calling
+         * thread, async handlers get a copy of data
+         *
+         * @param[in]       sid     Signal id
+         * @param[in,out]   d       Signal data
+         * @return          result of last sync handler
+         */
+        std::string process_signal(int sid, PluginData &d);
+        // signal name variant (id lookup)
+        std::string process_signal(const std::string &s, PluginData &d);
+
+        // signal stats
+        void signal_stats(std::vector<SignalStats> &out);
+
+        // limits
+        static constexpr int MAX_SIGNALS = 64;
+        static constexpr std::size_t SIG_WORKERS = 2;
+        static constexpr std::size_t SIG_BATCH = 32;
+        static constexpr std::chrono::seconds UNLOAD_TIMEOUT{30};
+
+        /**
+         * Queue command for execution in command executor
+         * (executor must be started by daemon)
+         *
+         * @param[in]   cmd_id  Command id
+         * @param[in]   t       Task
+         * @param[in]   cancel  Called if task is discarded
+         *                      on executor stop (optional)
+         * @return      0 for success, 1 if rejected
+         */
+        int submit(int cmd_id,
+                   CmdExecutor::task_t &&t,
+                   CmdExecutor::task_t &&cancel = nullptr);
+
+        /** Command executor */
+        CmdExecutor exec;
 
     private:
         /** Pointer to MINK daemon descriptor */
         mink::DaemonDescriptor *dd = nullptr;
+        using hooks_t = std::map<int, std::shared_ptr<PluginDescriptor>>;
+        using sig_subs_t = std::vector<std::pair<int, std::shared_ptr<SignalSubscriber>>>;
+        // remove signal handlers registered by plugin
+        // (removed handlers are optionally returned)
+        void sig_remove(const PluginDescriptor *pd, sig_subs_t *out = nullptr);
+        // re-attach signal handlers removed by sig_remove
+        void sig_restore(const sig_subs_t &subs);
+
         /** List of loaded plugins */
-        std::vector<PluginDescriptor*> plgs;
-        /** List of hooks and plugins attached to them */
-        std::map<int, PluginDescriptor*> hooks;
-        /** Signals */
-        std::map<std::string, Plugin_signal> signals;
+        std::vector<std::shared_ptr<PluginDescriptor>> plgs;
+        /** List of hooks and plugins attached to them (replaced
+         *  on load/unload, readers use snapshot) */
+        std::shared_ptr<const hooks_t> hooks;
+        /** Load/unload lock */
+        std::mutex plg_mtx;
+        // async signal delivery
+        void sig_enqueue(Signal &sig,
+                         const std::shared_ptr<SignalSubscriber> &sub,
+                         const PluginData &d);
+        void sig_drain(Signal &sig,
+                       std::shared_ptr<SignalSubscriber> sub,
+                       SignalLane *ln);
+        SignalLane &sig_lane(SignalSubscriber &sub, const PluginData &d);
+
+        /** Signals (indexed by id) */
+        std::array<Signal, MAX_SIGNALS> signals;
+        /** Signal name to id */
+        std::map<std::string, int> sig_ids;
+        /** Signal registration lock */
+        std::mutex sig_mtx;
+        /** Number of async lanes (executor keys) */
+        int sig_sub_cnt = 0;
+        /** Async signal workers (one key per lane) */
+        CmdExecutor sig_exec;
     };
 
     /**
@@ -183,10 +656,17 @@ namespace mink_utils {
         PluginManager::plg_cmd_hndlr_t cmdh;
         /** Plugin cmd handler method (local) */
         PluginManager::plg_cmd_hndlr_t cmdh_l;
+        /** Plugin cmd handler method (async) */
+        PluginManager::plg_cmd_hndlr_async_t cmdh_a;
         /** Plugin terminate method */
         PluginManager::plg_term_t termh;
         /** Custom data filled by plugin */
         void *data;
+        /** Commands (hooks) */
+        std::vector<int> cmds;
+        /** Plugin can be unmapped (terminate stops all
+         *  plugin threads) */
+        bool unloadable = false;
     };
 
 
@@ -13,6 +13,12 @@
 
 #include <sqlite3.h>
 #include <string>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <tuple>
+#include <unordered_map>
+#include <sys/stat.h>
 #include <mink_utils.h>
 
 namespace mink_db {
@@ -29,6 +35,8 @@ namespace mink_db {
         USER_CMD_SPECIFIC_AUTH
     };
 
+    class SqliteManager;
+
     // Command specific auth base class
     class CmdSpecificAuth {
     public:
@@ -37,13 +45,22 @@ namespace mink_db {
         CmdSpecificAuth(const CmdSpecificAuth &o) = delete;
         CmdSpecificAuth &operator=(const CmdSpecificAuth &o) = delete;
         // cmd handlers implemented in derived classes
-        virtual bool do_auth(sqlite3 *db, const vpmap &vp) = 0;
+        virtual bool do_auth(SqliteManager &dbm, const vpmap &vp) = 0;
+        // auth cache key (empty = do not cache)
+        virtual std::string cache_key(const vpmap &vp) = 0;
     };
 
     // CMD_UBUS_CALL (7) cmd specific auth class
     class CmdUbusAuth : public CmdSpecificAuth {
     public:
-        bool do_auth(sqlite3 *db, const vpmap &vp);
+        bool do_auth(SqliteManager &dbm, const vpmap &vp);
+        std::string cache_key(const vpmap &vp);
+    };
+
+    // cached auth decision
+    struct AuthCacheEntry {
+        std::tuple<int, int, int> res;
+        uint64_t ts;
     };
 
     // sqlite manager
@@ -59,6 +76,12 @@ namespace mink_db {
         bool cmd_specific_auth(const vpmap &vp, const std::string &u);
         std::tuple<int, int, int> user_auth(const std::string &u, const std::string &p);
         void connect(const std::string &db_f);
+        // prepared statement (call with stmt lock held)
+        sqlite3_stmt *get_stmt(QueryType qt);
+        void release_stmt(sqlite3_stmt *stmt);
+        // auth cache
+        void set_auth_cache_ttl(uint32_t ttl_msec);
+        void auth_cache_clear();
 
         // static constants
         static const char *SQL_USER_AUTH;
@@ -68,11 +91,39 @@ namespace mink_db {
         static const char *SQL_USER_CMD_AUTH;
         static const char *SQL_USER_CMD_SPECIFIC_AUTH;
 
+        // default auth cache ttl
+        static constexpr uint32_t AUTH_CACHE_TTL = 60000;
+        // max number of cached decisions
+        static constexpr std::size_t AUTH_CACHE_MAX = 10000;
+        // db file check interval
+        static constexpr uint32_t DB_CHECK_INTERVAL = 1000;
+
     private:
         void create_cmd_spec_hndlrs();
+        void close();
+        void check_reopen();
+        void check_db_file(uint64_t now);
+        void gen_cache_salt();
+        bool cache_get(const std::string &k, std::tuple<int, int, int> &res);
+        void cache_set(const std::string &k, const std::tuple<int, int, int> &res);
 
         sqlite3 *db = nullptr;
+        std::string db_file;
         std::map<int, CmdSpecificAuth *> cmd_spec_auth_map;
+        // prepared statements
+        std::mutex stmt_mtx;
+        std::map<QueryType, sqlite3_stmt *> stmts;
+        // auth cache
+        std::mutex cache_mtx;
+        std::unordered_map<std::string, AuthCacheEntry> auth_cache;
+        uint32_t cache_ttl = AUTH_CACHE_TTL;
+        // random salt for password hashes in cache keys
+        std::string cache_salt;
+        // db file state (cache invalidation)
+        uint64_t db_chk_ts = 0;
+        struct stat db_st = {};
+        struct stat db_wal_st = {};
+        std::atomic_bool db_replaced{false};
     };
 }
 
@@ -6,25 +6,26 @@
 #include "gdt.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace gdt_grpc {
 
 static const char* SysagentGrpcService_method_names[] = {
   "/gdt_grpc.SysagentGrpcService/GetCpuStats",
   "/gdt_grpc.SysagentGrpcService/GetSysinfo",
   "/gdt_grpc.SysagentGrpcService/GetData",
+  "/gdt_grpc.SysagentGrpcService/Subscribe",
 };
 
 std::unique_ptr< SysagentGrpcService::Stub> SysagentGrpcService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -37,6 +38,7 @@ SysagentGrpcService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>
   : channel_(channel), rpcmethod_GetCpuStats_(SysagentGrpcService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetSysinfo_(SysagentGrpcService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetData_(SysagentGrpcService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Subscribe_(SysagentGrpcService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status SysagentGrpcService::Stub::GetCpuStats(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::gdt_grpc::CommonReply* response) {
@@ -108,6 +110,22 @@ void SysagentGrpcService::Stub::async::GetData(::grpc::ClientContext* context, c
   return result;
 }
 
+::grpc::ClientReader< ::gdt_grpc::CommonReply>* SysagentGrpcService::Stub::SubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::gdt_grpc::CommonReply>::Create(channel_.get(), rpcmethod_Subscribe_, context, request);
+}
+
+void SysagentGrpcService::Stub::async::Subscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::grpc::ClientReadReactor< ::gdt_grpc::CommonReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::gdt_grpc::CommonReply>::Create(stub_->channel_.get(), stub_->rpcmethod_Subscribe_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>* SysagentGrpcService::Stub::AsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::gdt_grpc::CommonReply>::Create(channel_.get(), cq, rpcmethod_Subscribe_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>* SysagentGrpcService::Stub::PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::gdt_grpc::CommonReply>::Create(channel_.get(), cq, rpcmethod_Subscribe_, context, request, false, nullptr);
+}
+
 SysagentGrpcService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       SysagentGrpcService_method_names[0],
@@ -139,6 +157,16 @@ SysagentGrpcService::Service::Service() {
              ::gdt_grpc::CommonReply* resp) {
                return service->GetData(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      SysagentGrpcService_method_names[3],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< SysagentGrpcService::Service, ::gdt_grpc::CommonRequest, ::gdt_grpc::CommonReply>(
+          [](SysagentGrpcService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::gdt_grpc::CommonRequest* req,
+             ::grpc::ServerWriter<::gdt_grpc::CommonReply>* writer) {
+               return service->Subscribe(ctx, req, writer);
+             }, this)));
 }
 
 SysagentGrpcService::Service::~Service() {
@@ -165,6 +193,13 @@ SysagentGrpcService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status SysagentGrpcService::Service::Subscribe(::grpc::ServerContext* context, const ::gdt_grpc::CommonRequest* request, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace gdt_grpc
 
@@ -17,23 +17,23 @@
 #include "gdt.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace gdt_grpc {
 
@@ -74,6 +74,17 @@ class SysagentGrpcService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::gdt_grpc::CommonReply>> PrepareAsyncGetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::gdt_grpc::CommonReply>>(PrepareAsyncGetDataRaw(context, request, cq));
     }
+    // periodic get data (changes are streamed
+    // until call is cancelled)
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::gdt_grpc::CommonReply>> Subscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::gdt_grpc::CommonReply>>(SubscribeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>> AsyncSubscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>>(AsyncSubscribeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>> PrepareAsyncSubscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>>(PrepareAsyncSubscribeRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -86,6 +97,9 @@ class SysagentGrpcService final {
       // generic get data
       virtual void GetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // periodic get data (changes are streamed
+      // until call is cancelled)
+      virtual void Subscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::grpc::ClientReadReactor< ::gdt_grpc::CommonReply>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -97,6 +111,9 @@ class SysagentGrpcService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::gdt_grpc::CommonReply>* PrepareAsyncGetSysinfoRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::gdt_grpc::CommonReply>* AsyncGetDataRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::gdt_grpc::CommonReply>* PrepareAsyncGetDataRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::gdt_grpc::CommonReply>* SubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>* AsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::gdt_grpc::CommonReply>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -122,6 +139,15 @@ class SysagentGrpcService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::gdt_grpc::CommonReply>> PrepareAsyncGetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::gdt_grpc::CommonReply>>(PrepareAsyncGetDataRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::gdt_grpc::CommonReply>> Subscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::gdt_grpc::CommonReply>>(SubscribeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>> AsyncSubscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>>(AsyncSubscribeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>> PrepareAsyncSubscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>>(PrepareAsyncSubscribeRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -131,6 +157,7 @@ class SysagentGrpcService final {
       void GetSysinfo(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response, std::function<void(::grpc::Status)>) override;
       void GetData(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Subscribe(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest* request, ::grpc::ClientReadReactor< ::gdt_grpc::CommonReply>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -148,9 +175,13 @@ class SysagentGrpcService final {
     ::grpc::ClientAsyncResponseReader< ::gdt_grpc::CommonReply>* PrepareAsyncGetSysinfoRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::gdt_grpc::CommonReply>* AsyncGetDataRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::gdt_grpc::CommonReply>* PrepareAsyncGetDataRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::gdt_grpc::CommonReply>* SubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request) override;
+    ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>* AsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::gdt_grpc::CommonReply>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, const ::gdt_grpc::CommonRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetCpuStats_;
     const ::grpc::internal::RpcMethod rpcmethod_GetSysinfo_;
     const ::grpc::internal::RpcMethod rpcmethod_GetData_;
+    const ::grpc::internal::RpcMethod rpcmethod_Subscribe_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -164,6 +195,9 @@ class SysagentGrpcService final {
     virtual ::grpc::Status GetSysinfo(::grpc::ServerContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response);
     // generic get data
     virtual ::grpc::Status GetData(::grpc::ServerContext* context, const ::gdt_grpc::CommonRequest* request, ::gdt_grpc::CommonReply* response);
+    // periodic get data (changes are streamed
+    // until call is cancelled)
+    virtual ::grpc::Status Subscribe(::grpc::ServerContext* context, const ::gdt_grpc::CommonRequest* request, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetCpuStats : public BaseClass {
@@ -225,7 +259,27 @@ class SysagentGrpcService final {
       ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetCpuStats<WithAsyncMethod_GetSysinfo<WithAsyncMethod_GetData<Service > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Subscribe() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribe(::grpc::ServerContext* context, ::gdt_grpc::CommonRequest* request, ::grpc::ServerAsyncWriter< ::gdt_grpc::CommonReply>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetCpuStats<WithAsyncMethod_GetSysinfo<WithAsyncMethod_GetData<WithAsyncMethod_Subscribe<Service > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GetCpuStats : public BaseClass {
    private:
@@ -307,7 +361,29 @@ class SysagentGrpcService final {
     virtual ::grpc::ServerUnaryReactor* GetData(
       ::grpc::CallbackServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::gdt_grpc::CommonReply* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GetCpuStats<WithCallbackMethod_GetSysinfo<WithCallbackMethod_GetData<Service > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Subscribe() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::gdt_grpc::CommonRequest, ::gdt_grpc::CommonReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::gdt_grpc::CommonRequest* request) { return this->Subscribe(context, request); }));
+    }
+    ~WithCallbackMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::gdt_grpc::CommonReply>* Subscribe(
+      ::grpc::CallbackServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetCpuStats<WithCallbackMethod_GetSysinfo<WithCallbackMethod_GetData<WithCallbackMethod_Subscribe<Service > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetCpuStats : public BaseClass {
@@ -361,6 +437,23 @@ class SysagentGrpcService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Subscribe() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetCpuStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -421,6 +514,26 @@ class SysagentGrpcService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Subscribe() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribe(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GetCpuStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -487,6 +600,28 @@ class SysagentGrpcService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Subscribe() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->Subscribe(context, request); }));
+    }
+    ~WithRawCallbackMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* Subscribe(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetCpuStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -568,8 +703,35 @@ class SysagentGrpcService final {
     virtual ::grpc::Status StreamedGetData(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::gdt_grpc::CommonRequest,::gdt_grpc::CommonReply>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_GetCpuStats<WithStreamedUnaryMethod_GetSysinfo<WithStreamedUnaryMethod_GetData<Service > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetCpuStats<WithStreamedUnaryMethod_GetSysinfo<WithStreamedUnaryMethod_GetData<Service > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_Subscribe() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::gdt_grpc::CommonRequest, ::gdt_grpc::CommonReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::gdt_grpc::CommonRequest, ::gdt_grpc::CommonReply>* streamer) {
+                       return this->StreamedSubscribe(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, const ::gdt_grpc::CommonRequest* /*request*/, ::grpc::ServerWriter< ::gdt_grpc::CommonReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribe(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::gdt_grpc::CommonRequest,::gdt_grpc::CommonReply>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_Subscribe<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_GetCpuStats<WithStreamedUnaryMethod_GetSysinfo<WithStreamedUnaryMethod_GetData<WithSplitStreamingMethod_Subscribe<Service > > > > StreamedService;
 };
 
 }  // namespace gdt_grpc
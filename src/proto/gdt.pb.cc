@@ -16,153 +16,168 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace gdt_grpc {
-constexpr CommonRequest::CommonRequest(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : header_(nullptr)
-  , body_(nullptr){}
+PROTOBUF_CONSTEXPR CommonRequest::CommonRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.body_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct CommonRequestDefaultTypeInternal {
-  constexpr CommonRequestDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR CommonRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~CommonRequestDefaultTypeInternal() {}
   union {
     CommonRequest _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CommonRequestDefaultTypeInternal _CommonRequest_default_instance_;
-constexpr CommonReply::CommonReply(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : header_(nullptr)
-  , body_(nullptr){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommonRequestDefaultTypeInternal _CommonRequest_default_instance_;
+PROTOBUF_CONSTEXPR CommonReply::CommonReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.body_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct CommonReplyDefaultTypeInternal {
-  constexpr CommonReplyDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR CommonReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~CommonReplyDefaultTypeInternal() {}
   union {
     CommonReply _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT CommonReplyDefaultTypeInternal _CommonReply_default_instance_;
-constexpr EndPointDescriptor::EndPointDescriptor(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : type_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , id_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommonReplyDefaultTypeInternal _CommonReply_default_instance_;
+PROTOBUF_CONSTEXPR EndPointDescriptor::EndPointDescriptor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct EndPointDescriptorDefaultTypeInternal {
-  constexpr EndPointDescriptorDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR EndPointDescriptorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~EndPointDescriptorDefaultTypeInternal() {}
   union {
     EndPointDescriptor _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT EndPointDescriptorDefaultTypeInternal _EndPointDescriptor_default_instance_;
-constexpr Header::Header(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : source_(nullptr)
-  , destination_(nullptr){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EndPointDescriptorDefaultTypeInternal _EndPointDescriptor_default_instance_;
+PROTOBUF_CONSTEXPR Header::Header(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.source_)*/nullptr
+  , /*decltype(_impl_.destination_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct HeaderDefaultTypeInternal {
-  constexpr HeaderDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR HeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~HeaderDefaultTypeInternal() {}
   union {
     Header _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT HeaderDefaultTypeInternal _Header_default_instance_;
-constexpr Body_Param::Body_Param(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : value_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , id_(0)
-  , index_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeaderDefaultTypeInternal _Header_default_instance_;
+PROTOBUF_CONSTEXPR Body_Param::Body_Param(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct Body_ParamDefaultTypeInternal {
-  constexpr Body_ParamDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR Body_ParamDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~Body_ParamDefaultTypeInternal() {}
   union {
     Body_Param _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT Body_ParamDefaultTypeInternal _Body_Param_default_instance_;
-constexpr Body::Body(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : params_()
-  , service_id_(0)
-{}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Body_ParamDefaultTypeInternal _Body_Param_default_instance_;
+PROTOBUF_CONSTEXPR Body::Body(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.params_)*/{}
+  , /*decltype(_impl_.service_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct BodyDefaultTypeInternal {
-  constexpr BodyDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR BodyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~BodyDefaultTypeInternal() {}
   union {
     Body _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BodyDefaultTypeInternal _Body_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BodyDefaultTypeInternal _Body_default_instance_;
 }  // namespace gdt_grpc
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_gdt_2eproto[6];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_gdt_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_gdt_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_gdt_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_gdt_2eproto[3];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_gdt_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_gdt_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_gdt_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonRequest, body_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonRequest, _impl_.body_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonReply, header_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonReply, body_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonReply, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::CommonReply, _impl_.body_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::EndPointDescriptor, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::EndPointDescriptor, type_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::EndPointDescriptor, id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::EndPointDescriptor, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::EndPointDescriptor, _impl_.id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::Header, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Header, source_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Header, destination_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Header, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Header, _impl_.destination_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, id_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, index_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body_Param, _impl_.value_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body, service_id_),
-  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body, params_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body, _impl_.service_id_),
+  PROTOBUF_FIELD_OFFSET(::gdt_grpc::Body, _impl_.params_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::gdt_grpc::CommonRequest)},
-  { 7, -1, sizeof(::gdt_grpc::CommonReply)},
-  { 14, -1, sizeof(::gdt_grpc::EndPointDescriptor)},
-  { 21, -1, sizeof(::gdt_grpc::Header)},
-  { 28, -1, sizeof(::gdt_grpc::Body_Param)},
-  { 36, -1, sizeof(::gdt_grpc::Body)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::gdt_grpc::CommonRequest)},
+  { 8, -1, -1, sizeof(::gdt_grpc::CommonReply)},
+  { 16, -1, -1, sizeof(::gdt_grpc::EndPointDescriptor)},
+  { 24, -1, -1, sizeof(::gdt_grpc::Header)},
+  { 32, -1, -1, sizeof(::gdt_grpc::Body_Param)},
+  { 41, -1, -1, sizeof(::gdt_grpc::Body)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_CommonRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_CommonReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_EndPointDescriptor_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_Header_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_Body_Param_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::gdt_grpc::_Body_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::gdt_grpc::_CommonRequest_default_instance_._instance,
+  &::gdt_grpc::_CommonReply_default_instance_._instance,
+  &::gdt_grpc::_EndPointDescriptor_default_instance_._instance,
+  &::gdt_grpc::_Header_default_instance_._instance,
+  &::gdt_grpc::_Body_Param_default_instance_._instance,
+  &::gdt_grpc::_Body_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_gdt_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -201,70 +216,73 @@ const char descriptor_table_protodef_gdt_2eproto[] PROTOBUF_SECTION_VARIABLE(pro
   "L_RICH_RULE\020\036\022\030\n\024CMD_SYSD_FWLD_RELOAD\020\037\022"
   "\030\n\024CMD_MODBUS_WRITE_BIT\020 \022\030\n\024CMD_MODBUS_"
   "READ_BITS\020!\022\026\n\022CMD_NDPI_GET_STATS\020\"\022\024\n\020C"
-  "MD_MQTT_PUBLISH\020#\022\020\n\014CMD_LUA_CALL\020$*\305\014\n\r"
+  "MD_MQTT_PUBLISH\020#\022\020\n\014CMD_LUA_CALL\020$*\224\r\n\r"
   "ParameterType\022\025\n\021UNKNWON_PARAMETER\020\000\022\022\n\r"
   "PT_MINK_DTYPE\020\360.\022\020\n\013PT_MINK_DID\020\361.\022\022\n\rPT"
   "_MINK_ERROR\020\200/\022\026\n\021PT_MINK_ERROR_MSG\020\201/\022\023"
   "\n\016PT_MINK_STATUS\020\202/\022\027\n\022PT_MINK_STATUS_MS"
   "G\020\203/\022#\n\036PT_MINK_PERSISTENT_CORRELATION\020\204"
-  "/\022\030\n\023PT_CPU_USER_PERCENT\020\250F\022\030\n\023PT_CPU_NI"
-  "CE_PERCENT\020\251F\022\032\n\025PT_CPU_SYSTEM_PERCENT\020\252"
-  "F\022\031\n\024PT_SI_LOAD_AVG_1_MIN\020\253F\022\031\n\024PT_SI_LO"
-  "AD_AVG_5_MIN\020\254F\022\032\n\025PT_SI_LOAD_AVG_15_MIN"
-  "\020\255F\022\024\n\017PT_SI_MEM_TOTAL\020\256F\022\023\n\016PT_SI_MEM_F"
-  "REE\020\257F\022\026\n\021PT_SI_MEM_BUFFERS\020\260F\022\031\n\024PT_SI_"
-  "MEM_SWAP_TOTAL\020\261F\022\030\n\023PT_SI_MEM_SWAP_FREE"
-  "\020\262F\022\031\n\024PT_SI_MEM_HIGH_TOTAL\020\263F\022\030\n\023PT_SI_"
-  "MEM_HIGH_FREE\020\264F\022\030\n\023PT_SI_MEM_UNIT_SIZE\020"
-  "\265F\022\020\n\013PT_MI_TOTAL\020\266F\022\017\n\nPT_MI_FREE\020\267F\022\022\n"
-  "\rPT_MI_BUFFERS\020\270F\022\021\n\014PT_MI_CACHED\020\271F\022\023\n\016"
-  "PT_UNM_SYSNAME\020\272F\022\024\n\017PT_UNM_NODENAME\020\273F\022"
-  "\023\n\016PT_UNM_RELEASE\020\274F\022\023\n\016PT_UNM_VERSION\020\275"
-  "F\022\023\n\016PT_UNM_MACHINE\020\276F\022\016\n\tPT_PL_CMD\020\277F\022\016"
-  "\n\tPT_PL_TID\020\300F\022\017\n\nPT_PL_PPID\020\301F\022\023\n\016PT_PL"
-  "_RESIDENT\020\302F\022\020\n\013PT_PL_UTIME\020\303F\022\020\n\013PT_PL_"
-  "STIME\020\304F\022\026\n\021PT_OWRT_UBUS_PATH\020\305F\022\030\n\023PT_O"
-  "WRT_UBUS_METHOD\020\306F\022\025\n\020PT_OWRT_UBUS_ARG\020\307"
-  "F\022\030\n\023PT_OWRT_UBUS_RESULT\020\310F\022\021\n\014PT_SHELL_"
-  "CMD\020\311F\022\024\n\017PT_SHELL_STDOUT\020\312F\022\024\n\017PT_SHELL"
-  "_STDERR\020\313F\022\027\n\022PT_SHELL_EXIT_CODE\020\314F\022\017\n\nP"
-  "T_SP_TYPE\020\315F\022\017\n\nPT_SP_PATH\020\316F\022\022\n\rPT_SP_P"
-  "AYLOAD\020\317F\022\017\n\nPT_FU_DATA\020\320F\022\020\n\013PT_FU_FSIZ"
-  "E\020\321F\022\022\n\rPT_SL_LOGLINE\020\322F\022\017\n\nPT_SL_PORT\020\323"
-  "F\022\017\n\nPT_RE_PORT\020\324F\022\016\n\tPT_NET_IP\020\325F\022\020\n\013PT"
-  "_NET_PORT\020\326F\022\023\n\016PT_CG2_GRP_CFG\020\327F\022\024\n\017PT_"
-  "SYSD_SERVICE\020\330F\022\021\n\014PT_SYSD_PATH\020\331F\022\026\n\021PT"
-  "_SYSD_INTERFACE\020\332F\022\023\n\016PT_SYSD_METHOD\020\333F\022"
-  "\026\n\021PT_SYSD_SIGNATURE\020\334F\022\035\n\030PT_SYSD_RESUL"
-  "T_SIGNATURE\020\335F\022\021\n\014PT_SYSD_ARGS\020\336F\022\023\n\016PT_"
-  "SYSD_RESULT\020\337F\022\021\n\014PT_SYSD_DUMP\020\340F\022\026\n\021PT_"
-  "SYSD_FWLD_ZONE\020\341F\022\026\n\021PT_SYSD_FWLD_RULE\020\342"
-  "F\022\031\n\024PT_MODBUS_CONNECTION\020\343F\022\023\n\016PT_MODBU"
-  "S_ADDR\020\344F\022\023\n\016PT_MODBUS_BITS\020\345F\022\021\n\014PT_MOD"
-  "BUS_NB\020\346F\022\017\n\nPT_NDPI_IF\020\347F\022\017\n\nPT_LUA_ARG"
-  "\020\350F2\323\001\n\023SysagentGrpcService\022\?\n\013GetCpuSta"
-  "ts\022\027.gdt_grpc.CommonRequest\032\025.gdt_grpc.C"
-  "ommonReply\"\000\022>\n\nGetSysinfo\022\027.gdt_grpc.Co"
-  "mmonRequest\032\025.gdt_grpc.CommonReply\"\000\022;\n\007"
-  "GetData\022\027.gdt_grpc.CommonRequest\032\025.gdt_g"
-  "rpc.CommonReply\"\000B\032\n\006io.gdtB\010GDTProtoP\001\242"
-  "\002\003GDTb\006proto3"
+  "/\022\031\n\024PT_MINK_SUB_INTERVAL\020\206/\022\027\n\022PT_MINK_"
+  "SUB_CANCEL\020\207/\022\031\n\024PT_MINK_SUB_SNAPSHOT\020\210/"
+  "\022\030\n\023PT_CPU_USER_PERCENT\020\250F\022\030\n\023PT_CPU_NIC"
+  "E_PERCENT\020\251F\022\032\n\025PT_CPU_SYSTEM_PERCENT\020\252F"
+  "\022\031\n\024PT_SI_LOAD_AVG_1_MIN\020\253F\022\031\n\024PT_SI_LOA"
+  "D_AVG_5_MIN\020\254F\022\032\n\025PT_SI_LOAD_AVG_15_MIN\020"
+  "\255F\022\024\n\017PT_SI_MEM_TOTAL\020\256F\022\023\n\016PT_SI_MEM_FR"
+  "EE\020\257F\022\026\n\021PT_SI_MEM_BUFFERS\020\260F\022\031\n\024PT_SI_M"
+  "EM_SWAP_TOTAL\020\261F\022\030\n\023PT_SI_MEM_SWAP_FREE\020"
+  "\262F\022\031\n\024PT_SI_MEM_HIGH_TOTAL\020\263F\022\030\n\023PT_SI_M"
+  "EM_HIGH_FREE\020\264F\022\030\n\023PT_SI_MEM_UNIT_SIZE\020\265"
+  "F\022\020\n\013PT_MI_TOTAL\020\266F\022\017\n\nPT_MI_FREE\020\267F\022\022\n\r"
+  "PT_MI_BUFFERS\020\270F\022\021\n\014PT_MI_CACHED\020\271F\022\023\n\016P"
+  "T_UNM_SYSNAME\020\272F\022\024\n\017PT_UNM_NODENAME\020\273F\022\023"
+  "\n\016PT_UNM_RELEASE\020\274F\022\023\n\016PT_UNM_VERSION\020\275F"
+  "\022\023\n\016PT_UNM_MACHINE\020\276F\022\016\n\tPT_PL_CMD\020\277F\022\016\n"
+  "\tPT_PL_TID\020\300F\022\017\n\nPT_PL_PPID\020\301F\022\023\n\016PT_PL_"
+  "RESIDENT\020\302F\022\020\n\013PT_PL_UTIME\020\303F\022\020\n\013PT_PL_S"
+  "TIME\020\304F\022\026\n\021PT_OWRT_UBUS_PATH\020\305F\022\030\n\023PT_OW"
+  "RT_UBUS_METHOD\020\306F\022\025\n\020PT_OWRT_UBUS_ARG\020\307F"
+  "\022\030\n\023PT_OWRT_UBUS_RESULT\020\310F\022\021\n\014PT_SHELL_C"
+  "MD\020\311F\022\024\n\017PT_SHELL_STDOUT\020\312F\022\024\n\017PT_SHELL_"
+  "STDERR\020\313F\022\027\n\022PT_SHELL_EXIT_CODE\020\314F\022\017\n\nPT"
+  "_SP_TYPE\020\315F\022\017\n\nPT_SP_PATH\020\316F\022\022\n\rPT_SP_PA"
+  "YLOAD\020\317F\022\017\n\nPT_FU_DATA\020\320F\022\020\n\013PT_FU_FSIZE"
+  "\020\321F\022\022\n\rPT_SL_LOGLINE\020\322F\022\017\n\nPT_SL_PORT\020\323F"
+  "\022\017\n\nPT_RE_PORT\020\324F\022\016\n\tPT_NET_IP\020\325F\022\020\n\013PT_"
+  "NET_PORT\020\326F\022\023\n\016PT_CG2_GRP_CFG\020\327F\022\024\n\017PT_S"
+  "YSD_SERVICE\020\330F\022\021\n\014PT_SYSD_PATH\020\331F\022\026\n\021PT_"
+  "SYSD_INTERFACE\020\332F\022\023\n\016PT_SYSD_METHOD\020\333F\022\026"
+  "\n\021PT_SYSD_SIGNATURE\020\334F\022\035\n\030PT_SYSD_RESULT"
+  "_SIGNATURE\020\335F\022\021\n\014PT_SYSD_ARGS\020\336F\022\023\n\016PT_S"
+  "YSD_RESULT\020\337F\022\021\n\014PT_SYSD_DUMP\020\340F\022\026\n\021PT_S"
+  "YSD_FWLD_ZONE\020\341F\022\026\n\021PT_SYSD_FWLD_RULE\020\342F"
+  "\022\031\n\024PT_MODBUS_CONNECTION\020\343F\022\023\n\016PT_MODBUS"
+  "_ADDR\020\344F\022\023\n\016PT_MODBUS_BITS\020\345F\022\021\n\014PT_MODB"
+  "US_NB\020\346F\022\017\n\nPT_NDPI_IF\020\347F\022\017\n\nPT_LUA_ARG\020"
+  "\350F2\224\002\n\023SysagentGrpcService\022\?\n\013GetCpuStat"
+  "s\022\027.gdt_grpc.CommonRequest\032\025.gdt_grpc.Co"
+  "mmonReply\"\000\022>\n\nGetSysinfo\022\027.gdt_grpc.Com"
+  "monRequest\032\025.gdt_grpc.CommonReply\"\000\022;\n\007G"
+  "etData\022\027.gdt_grpc.CommonRequest\032\025.gdt_gr"
+  "pc.CommonReply\"\000\022\?\n\tSubscribe\022\027.gdt_grpc"
+  ".CommonRequest\032\025.gdt_grpc.CommonReply\"\0000"
+  "\001B\032\n\006io.gdtB\010GDTProtoP\001\242\002\003GDTb\006proto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_gdt_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_gdt_2eproto = {
-  false, false, 3293, descriptor_table_protodef_gdt_2eproto, "gdt.proto", 
-  &descriptor_table_gdt_2eproto_once, nullptr, 0, 6,
-  schemas, file_default_instances, TableStruct_gdt_2eproto::offsets,
-  file_level_metadata_gdt_2eproto, file_level_enum_descriptors_gdt_2eproto, file_level_service_descriptors_gdt_2eproto,
+static ::_pbi::once_flag descriptor_table_gdt_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_gdt_2eproto = {
+    false, false, 3437, descriptor_table_protodef_gdt_2eproto,
+    "gdt.proto",
+    &descriptor_table_gdt_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_gdt_2eproto::offsets,
+    file_level_metadata_gdt_2eproto, file_level_enum_descriptors_gdt_2eproto,
+    file_level_service_descriptors_gdt_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK ::PROTOBUF_NAMESPACE_ID::Metadata
-descriptor_table_gdt_2eproto_metadata_getter(int index) {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gdt_2eproto);
-  return descriptor_table_gdt_2eproto.file_level_metadata[index];
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_gdt_2eproto_getter() {
+  return &descriptor_table_gdt_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_gdt_2eproto(&descriptor_table_gdt_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_gdt_2eproto(&descriptor_table_gdt_2eproto);
 namespace gdt_grpc {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Body_ServiceId_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gdt_2eproto);
@@ -280,13 +298,13 @@ bool Body_ServiceId_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr Body_ServiceId Body::UNKNOWN_SERVICE_ID;
 constexpr Body_ServiceId Body::SYSAGENT;
 constexpr Body_ServiceId Body::ServiceId_MIN;
 constexpr Body_ServiceId Body::ServiceId_MAX;
 constexpr int Body::ServiceId_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SysagentCommand_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gdt_2eproto);
   return file_level_enum_descriptors_gdt_2eproto[1];
@@ -350,6 +368,9 @@ bool ParameterType_IsValid(int value) {
     case 6018:
     case 6019:
     case 6020:
+    case 6022:
+    case 6023:
+    case 6024:
     case 9000:
     case 9001:
     case 9002:
@@ -432,147 +453,150 @@ class CommonRequest::_Internal {
 
 const ::gdt_grpc::Header&
 CommonRequest::_Internal::header(const CommonRequest* msg) {
-  return *msg->header_;
+  return *msg->_impl_.header_;
 }
 const ::gdt_grpc::Body&
 CommonRequest::_Internal::body(const CommonRequest* msg) {
-  return *msg->body_;
+  return *msg->_impl_.body_;
 }
-CommonRequest::CommonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+CommonRequest::CommonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.CommonRequest)
 }
 CommonRequest::CommonRequest(const CommonRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommonRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.body_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
-    header_ = new ::gdt_grpc::Header(*from.header_);
-  } else {
-    header_ = nullptr;
+    _this->_impl_.header_ = new ::gdt_grpc::Header(*from._impl_.header_);
   }
   if (from._internal_has_body()) {
-    body_ = new ::gdt_grpc::Body(*from.body_);
-  } else {
-    body_ = nullptr;
+    _this->_impl_.body_ = new ::gdt_grpc::Body(*from._impl_.body_);
   }
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.CommonRequest)
 }
 
-void CommonRequest::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&header_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&body_) -
-    reinterpret_cast<char*>(&header_)) + sizeof(body_));
+inline void CommonRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.body_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 CommonRequest::~CommonRequest() {
   // @@protoc_insertion_point(destructor:gdt_grpc.CommonRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CommonRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete body_;
+inline void CommonRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+  if (this != internal_default_instance()) delete _impl_.body_;
 }
 
-void CommonRequest::ArenaDtor(void* object) {
-  CommonRequest* _this = reinterpret_cast< CommonRequest* >(object);
-  (void)_this;
-}
-void CommonRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void CommonRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void CommonRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.CommonRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  if (GetArena() == nullptr && body_ != nullptr) {
-    delete body_;
+  _impl_.header_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.body_ != nullptr) {
+    delete _impl_.body_;
   }
-  body_ = nullptr;
+  _impl_.body_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CommonRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* CommonRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .gdt_grpc.Header header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .gdt_grpc.Body body = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_body(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CommonRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* CommonRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.CommonRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .gdt_grpc.Header header = 1;
-  if (this->has_header()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_header()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::header(this), target, stream);
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
   // .gdt_grpc.Body body = 2;
-  if (this->has_body()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_body()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::body(this), target, stream);
+      InternalWriteMessage(2, _Internal::body(this),
+        _Internal::body(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.CommonRequest)
@@ -583,68 +607,51 @@ size_t CommonRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.CommonRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .gdt_grpc.Header header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
   // .gdt_grpc.Body body = 2;
-  if (this->has_body()) {
+  if (this->_internal_has_body()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *body_);
+        *_impl_.body_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CommonRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.CommonRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CommonRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CommonRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.CommonRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.CommonRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommonRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommonRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommonRequest::GetClassData() const { return &_class_data_; }
 
-void CommonRequest::MergeFrom(const CommonRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.CommonRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void CommonRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommonRequest*>(&to_msg);
+  auto& from = static_cast<const CommonRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.CommonRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_header()) {
-    _internal_mutable_header()->::gdt_grpc::Header::MergeFrom(from._internal_header());
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::gdt_grpc::Header::MergeFrom(
+        from._internal_header());
   }
-  if (from.has_body()) {
-    _internal_mutable_body()->::gdt_grpc::Body::MergeFrom(from._internal_body());
+  if (from._internal_has_body()) {
+    _this->_internal_mutable_body()->::gdt_grpc::Body::MergeFrom(
+        from._internal_body());
   }
-}
-
-void CommonRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.CommonRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CommonRequest::CopyFrom(const CommonRequest& from) {
@@ -660,20 +667,21 @@ bool CommonRequest::IsInitialized() const {
 
 void CommonRequest::InternalSwap(CommonRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CommonRequest, body_)
-      + sizeof(CommonRequest::body_)
-      - PROTOBUF_FIELD_OFFSET(CommonRequest, header_)>(
-          reinterpret_cast<char*>(&header_),
-          reinterpret_cast<char*>(&other->header_));
+      PROTOBUF_FIELD_OFFSET(CommonRequest, _impl_.body_)
+      + sizeof(CommonRequest::_impl_.body_)
+      - PROTOBUF_FIELD_OFFSET(CommonRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata CommonRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class CommonReply::_Internal {
@@ -684,147 +692,150 @@ class CommonReply::_Internal {
 
 const ::gdt_grpc::Header&
 CommonReply::_Internal::header(const CommonReply* msg) {
-  return *msg->header_;
+  return *msg->_impl_.header_;
 }
 const ::gdt_grpc::Body&
 CommonReply::_Internal::body(const CommonReply* msg) {
-  return *msg->body_;
+  return *msg->_impl_.body_;
 }
-CommonReply::CommonReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+CommonReply::CommonReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.CommonReply)
 }
 CommonReply::CommonReply(const CommonReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommonReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.body_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_header()) {
-    header_ = new ::gdt_grpc::Header(*from.header_);
-  } else {
-    header_ = nullptr;
+    _this->_impl_.header_ = new ::gdt_grpc::Header(*from._impl_.header_);
   }
   if (from._internal_has_body()) {
-    body_ = new ::gdt_grpc::Body(*from.body_);
-  } else {
-    body_ = nullptr;
+    _this->_impl_.body_ = new ::gdt_grpc::Body(*from._impl_.body_);
   }
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.CommonReply)
 }
 
-void CommonReply::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&header_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&body_) -
-    reinterpret_cast<char*>(&header_)) + sizeof(body_));
+inline void CommonReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.body_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 CommonReply::~CommonReply() {
   // @@protoc_insertion_point(destructor:gdt_grpc.CommonReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CommonReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete header_;
-  if (this != internal_default_instance()) delete body_;
+inline void CommonReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+  if (this != internal_default_instance()) delete _impl_.body_;
 }
 
-void CommonReply::ArenaDtor(void* object) {
-  CommonReply* _this = reinterpret_cast< CommonReply* >(object);
-  (void)_this;
-}
-void CommonReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void CommonReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void CommonReply::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.CommonReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  if (GetArena() == nullptr && body_ != nullptr) {
-    delete body_;
+  _impl_.header_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.body_ != nullptr) {
+    delete _impl_.body_;
   }
-  body_ = nullptr;
+  _impl_.body_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CommonReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* CommonReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .gdt_grpc.Header header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .gdt_grpc.Body body = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_body(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CommonReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* CommonReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.CommonReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .gdt_grpc.Header header = 1;
-  if (this->has_header()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_header()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::header(this), target, stream);
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
   // .gdt_grpc.Body body = 2;
-  if (this->has_body()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_body()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::body(this), target, stream);
+      InternalWriteMessage(2, _Internal::body(this),
+        _Internal::body(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.CommonReply)
@@ -835,68 +846,51 @@ size_t CommonReply::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.CommonReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .gdt_grpc.Header header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
   // .gdt_grpc.Body body = 2;
-  if (this->has_body()) {
+  if (this->_internal_has_body()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *body_);
+        *_impl_.body_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CommonReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.CommonReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CommonReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CommonReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.CommonReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.CommonReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommonReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommonReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommonReply::GetClassData() const { return &_class_data_; }
 
-void CommonReply::MergeFrom(const CommonReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.CommonReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void CommonReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommonReply*>(&to_msg);
+  auto& from = static_cast<const CommonReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.CommonReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_header()) {
-    _internal_mutable_header()->::gdt_grpc::Header::MergeFrom(from._internal_header());
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::gdt_grpc::Header::MergeFrom(
+        from._internal_header());
   }
-  if (from.has_body()) {
-    _internal_mutable_body()->::gdt_grpc::Body::MergeFrom(from._internal_body());
+  if (from._internal_has_body()) {
+    _this->_internal_mutable_body()->::gdt_grpc::Body::MergeFrom(
+        from._internal_body());
   }
-}
-
-void CommonReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.CommonReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CommonReply::CopyFrom(const CommonReply& from) {
@@ -912,141 +906,167 @@ bool CommonReply::IsInitialized() const {
 
 void CommonReply::InternalSwap(CommonReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CommonReply, body_)
-      + sizeof(CommonReply::body_)
-      - PROTOBUF_FIELD_OFFSET(CommonReply, header_)>(
-          reinterpret_cast<char*>(&header_),
-          reinterpret_cast<char*>(&other->header_));
+      PROTOBUF_FIELD_OFFSET(CommonReply, _impl_.body_)
+      + sizeof(CommonReply::_impl_.body_)
+      - PROTOBUF_FIELD_OFFSET(CommonReply, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata CommonReply::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class EndPointDescriptor::_Internal {
  public:
 };
 
-EndPointDescriptor::EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+EndPointDescriptor::EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.EndPointDescriptor)
 }
 EndPointDescriptor::EndPointDescriptor(const EndPointDescriptor& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EndPointDescriptor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_type().empty()) {
-    type_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_type(), 
-      GetArena());
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
   }
-  id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_id().empty()) {
-    id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_id(), 
-      GetArena());
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.EndPointDescriptor)
 }
 
-void EndPointDescriptor::SharedCtor() {
-type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void EndPointDescriptor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EndPointDescriptor::~EndPointDescriptor() {
   // @@protoc_insertion_point(destructor:gdt_grpc.EndPointDescriptor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void EndPointDescriptor::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  type_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void EndPointDescriptor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_.Destroy();
+  _impl_.id_.Destroy();
 }
 
-void EndPointDescriptor::ArenaDtor(void* object) {
-  EndPointDescriptor* _this = reinterpret_cast< EndPointDescriptor* >(object);
-  (void)_this;
-}
-void EndPointDescriptor::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EndPointDescriptor::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void EndPointDescriptor::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.EndPointDescriptor)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  type_.ClearToEmpty();
-  id_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EndPointDescriptor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EndPointDescriptor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string type = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "gdt_grpc.EndPointDescriptor.type"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "gdt_grpc.EndPointDescriptor.type"));
+        } else
+          goto handle_unusual;
         continue;
       // string id = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "gdt_grpc.EndPointDescriptor.id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "gdt_grpc.EndPointDescriptor.id"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* EndPointDescriptor::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* EndPointDescriptor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.EndPointDescriptor)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string type = 1;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1056,7 +1076,7 @@ failure:
   }
 
   // string id = 2;
-  if (this->id().size() > 0) {
+  if (!this->_internal_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1066,7 +1086,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.EndPointDescriptor)
@@ -1077,68 +1097,49 @@ size_t EndPointDescriptor::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.EndPointDescriptor)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string type = 1;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_type());
   }
 
   // string id = 2;
-  if (this->id().size() > 0) {
+  if (!this->_internal_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_id());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EndPointDescriptor::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.EndPointDescriptor)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EndPointDescriptor* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EndPointDescriptor>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.EndPointDescriptor)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.EndPointDescriptor)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EndPointDescriptor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EndPointDescriptor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EndPointDescriptor::GetClassData() const { return &_class_data_; }
 
-void EndPointDescriptor::MergeFrom(const EndPointDescriptor& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.EndPointDescriptor)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void EndPointDescriptor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EndPointDescriptor*>(&to_msg);
+  auto& from = static_cast<const EndPointDescriptor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.EndPointDescriptor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.type().size() > 0) {
-    _internal_set_type(from._internal_type());
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.id().size() > 0) {
-    _internal_set_id(from._internal_id());
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
   }
-}
-
-void EndPointDescriptor::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.EndPointDescriptor)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EndPointDescriptor::CopyFrom(const EndPointDescriptor& from) {
@@ -1154,16 +1155,25 @@ bool EndPointDescriptor::IsInitialized() const {
 
 void EndPointDescriptor::InternalSwap(EndPointDescriptor* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  type_.Swap(&other->type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  id_.Swap(&other->id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EndPointDescriptor::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[2]);
 }
 
-
 // ===================================================================
 
 class Header::_Internal {
@@ -1174,147 +1184,150 @@ class Header::_Internal {
 
 const ::gdt_grpc::EndPointDescriptor&
 Header::_Internal::source(const Header* msg) {
-  return *msg->source_;
+  return *msg->_impl_.source_;
 }
 const ::gdt_grpc::EndPointDescriptor&
 Header::_Internal::destination(const Header* msg) {
-  return *msg->destination_;
+  return *msg->_impl_.destination_;
 }
-Header::Header(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Header::Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.Header)
 }
 Header::Header(const Header& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Header* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.source_){nullptr}
+    , decltype(_impl_.destination_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_source()) {
-    source_ = new ::gdt_grpc::EndPointDescriptor(*from.source_);
-  } else {
-    source_ = nullptr;
+    _this->_impl_.source_ = new ::gdt_grpc::EndPointDescriptor(*from._impl_.source_);
   }
   if (from._internal_has_destination()) {
-    destination_ = new ::gdt_grpc::EndPointDescriptor(*from.destination_);
-  } else {
-    destination_ = nullptr;
+    _this->_impl_.destination_ = new ::gdt_grpc::EndPointDescriptor(*from._impl_.destination_);
   }
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.Header)
 }
 
-void Header::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&source_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&destination_) -
-    reinterpret_cast<char*>(&source_)) + sizeof(destination_));
+inline void Header::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.source_){nullptr}
+    , decltype(_impl_.destination_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Header::~Header() {
   // @@protoc_insertion_point(destructor:gdt_grpc.Header)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Header::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete source_;
-  if (this != internal_default_instance()) delete destination_;
+inline void Header::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.source_;
+  if (this != internal_default_instance()) delete _impl_.destination_;
 }
 
-void Header::ArenaDtor(void* object) {
-  Header* _this = reinterpret_cast< Header* >(object);
-  (void)_this;
-}
-void Header::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Header::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Header::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.Header)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && source_ != nullptr) {
-    delete source_;
+  if (GetArenaForAllocation() == nullptr && _impl_.source_ != nullptr) {
+    delete _impl_.source_;
   }
-  source_ = nullptr;
-  if (GetArena() == nullptr && destination_ != nullptr) {
-    delete destination_;
+  _impl_.source_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.destination_ != nullptr) {
+    delete _impl_.destination_;
   }
-  destination_ = nullptr;
+  _impl_.destination_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Header::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Header::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .gdt_grpc.EndPointDescriptor source = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_source(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .gdt_grpc.EndPointDescriptor destination = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_destination(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Header::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Header::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.Header)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .gdt_grpc.EndPointDescriptor source = 1;
-  if (this->has_source()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_source()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::source(this), target, stream);
+      InternalWriteMessage(1, _Internal::source(this),
+        _Internal::source(this).GetCachedSize(), target, stream);
   }
 
   // .gdt_grpc.EndPointDescriptor destination = 2;
-  if (this->has_destination()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_destination()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::destination(this), target, stream);
+      InternalWriteMessage(2, _Internal::destination(this),
+        _Internal::destination(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.Header)
@@ -1325,68 +1338,51 @@ size_t Header::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.Header)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .gdt_grpc.EndPointDescriptor source = 1;
-  if (this->has_source()) {
+  if (this->_internal_has_source()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *source_);
+        *_impl_.source_);
   }
 
   // .gdt_grpc.EndPointDescriptor destination = 2;
-  if (this->has_destination()) {
+  if (this->_internal_has_destination()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *destination_);
+        *_impl_.destination_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Header::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.Header)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Header* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Header>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.Header)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.Header)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Header::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Header::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Header::GetClassData() const { return &_class_data_; }
 
-void Header::MergeFrom(const Header& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Header)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Header::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Header*>(&to_msg);
+  auto& from = static_cast<const Header&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Header)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_source()) {
-    _internal_mutable_source()->::gdt_grpc::EndPointDescriptor::MergeFrom(from._internal_source());
+  if (from._internal_has_source()) {
+    _this->_internal_mutable_source()->::gdt_grpc::EndPointDescriptor::MergeFrom(
+        from._internal_source());
   }
-  if (from.has_destination()) {
-    _internal_mutable_destination()->::gdt_grpc::EndPointDescriptor::MergeFrom(from._internal_destination());
+  if (from._internal_has_destination()) {
+    _this->_internal_mutable_destination()->::gdt_grpc::EndPointDescriptor::MergeFrom(
+        from._internal_destination());
   }
-}
-
-void Header::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.Header)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Header::CopyFrom(const Header& from) {
@@ -1402,160 +1398,179 @@ bool Header::IsInitialized() const {
 
 void Header::InternalSwap(Header* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Header, destination_)
-      + sizeof(Header::destination_)
-      - PROTOBUF_FIELD_OFFSET(Header, source_)>(
-          reinterpret_cast<char*>(&source_),
-          reinterpret_cast<char*>(&other->source_));
+      PROTOBUF_FIELD_OFFSET(Header, _impl_.destination_)
+      + sizeof(Header::_impl_.destination_)
+      - PROTOBUF_FIELD_OFFSET(Header, _impl_.source_)>(
+          reinterpret_cast<char*>(&_impl_.source_),
+          reinterpret_cast<char*>(&other->_impl_.source_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Header::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[3]);
 }
 
-
 // ===================================================================
 
 class Body_Param::_Internal {
  public:
 };
 
-Body_Param::Body_Param(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Body_Param::Body_Param(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.Body.Param)
 }
 Body_Param::Body_Param(const Body_Param& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Body_Param* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_value(), 
-      GetArena());
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&index_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(index_));
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.index_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.index_));
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.Body.Param)
 }
 
-void Body_Param::SharedCtor() {
-value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&id_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&index_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(index_));
+inline void Body_Param::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){0}
+    , decltype(_impl_.index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Body_Param::~Body_Param() {
   // @@protoc_insertion_point(destructor:gdt_grpc.Body.Param)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Body_Param::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Body_Param::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
 }
 
-void Body_Param::ArenaDtor(void* object) {
-  Body_Param* _this = reinterpret_cast< Body_Param* >(object);
-  (void)_this;
-}
-void Body_Param::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Body_Param::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Body_Param::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.Body.Param)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  value_.ClearToEmpty();
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&index_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(index_));
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.index_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.index_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Body_Param::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Body_Param::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 index = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string value = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "gdt_grpc.Body.Param.value"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "gdt_grpc.Body.Param.value"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Body_Param::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Body_Param::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.Body.Param)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 id = 1;
-  if (this->id() != 0) {
+  if (this->_internal_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_id(), target);
   }
 
   // int32 index = 2;
-  if (this->index() != 0) {
+  if (this->_internal_index() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_index(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_index(), target);
   }
 
   // string value = 3;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1565,7 +1580,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.Body.Param)
@@ -1576,78 +1591,55 @@ size_t Body_Param::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.Body.Param)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string value = 3;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_value());
   }
 
   // int32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_id());
   }
 
   // int32 index = 2;
-  if (this->index() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_index());
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Body_Param::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.Body.Param)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Body_Param* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Body_Param>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.Body.Param)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.Body.Param)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Body_Param::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Body_Param::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Body_Param::GetClassData() const { return &_class_data_; }
 
-void Body_Param::MergeFrom(const Body_Param& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Body.Param)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Body_Param::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Body_Param*>(&to_msg);
+  auto& from = static_cast<const Body_Param&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Body.Param)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.value().size() > 0) {
-    _internal_set_value(from._internal_value());
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
   }
-  if (from.id() != 0) {
-    _internal_set_id(from._internal_id());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-  if (from.index() != 0) {
-    _internal_set_index(from._internal_index());
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
   }
-}
-
-void Body_Param::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.Body.Param)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Body_Param::CopyFrom(const Body_Param& from) {
@@ -1663,95 +1655,110 @@ bool Body_Param::IsInitialized() const {
 
 void Body_Param::InternalSwap(Body_Param* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Body_Param, index_)
-      + sizeof(Body_Param::index_)
-      - PROTOBUF_FIELD_OFFSET(Body_Param, id_)>(
-          reinterpret_cast<char*>(&id_),
-          reinterpret_cast<char*>(&other->id_));
+      PROTOBUF_FIELD_OFFSET(Body_Param, _impl_.index_)
+      + sizeof(Body_Param::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(Body_Param, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Body_Param::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[4]);
 }
 
-
 // ===================================================================
 
 class Body::_Internal {
  public:
 };
 
-Body::Body(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  params_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Body::Body(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:gdt_grpc.Body)
 }
 Body::Body(const Body& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      params_(from.params_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Body* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){from._impl_.params_}
+    , decltype(_impl_.service_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  service_id_ = from.service_id_;
+  _this->_impl_.service_id_ = from._impl_.service_id_;
   // @@protoc_insertion_point(copy_constructor:gdt_grpc.Body)
 }
 
-void Body::SharedCtor() {
-service_id_ = 0;
+inline void Body::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.params_){arena}
+    , decltype(_impl_.service_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Body::~Body() {
   // @@protoc_insertion_point(destructor:gdt_grpc.Body)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Body::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Body::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.params_.~RepeatedPtrField();
 }
 
-void Body::ArenaDtor(void* object) {
-  Body* _this = reinterpret_cast< Body* >(object);
-  (void)_this;
-}
-void Body::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Body::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Body::Clear() {
 // @@protoc_insertion_point(message_clear_start:gdt_grpc.Body)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  params_.Clear();
-  service_id_ = 0;
+  _impl_.params_.Clear();
+  _impl_.service_id_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Body::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Body::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .gdt_grpc.Body.ServiceId service_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_service_id(static_cast<::gdt_grpc::Body_ServiceId>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .gdt_grpc.Body.Param params = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1759,53 +1766,55 @@ const char* Body::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inter
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Body::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Body::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:gdt_grpc.Body)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .gdt_grpc.Body.ServiceId service_id = 1;
-  if (this->service_id() != 0) {
+  if (this->_internal_service_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_service_id(), target);
   }
 
   // repeated .gdt_grpc.Body.Param params = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_params_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_params_size()); i < n; i++) {
+    const auto& repfield = this->_internal_params(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_params(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:gdt_grpc.Body)
@@ -1816,65 +1825,46 @@ size_t Body::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:gdt_grpc.Body)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .gdt_grpc.Body.Param params = 2;
   total_size += 1UL * this->_internal_params_size();
-  for (const auto& msg : this->params_) {
+  for (const auto& msg : this->_impl_.params_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .gdt_grpc.Body.ServiceId service_id = 1;
-  if (this->service_id() != 0) {
+  if (this->_internal_service_id() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_service_id());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_service_id());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Body::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:gdt_grpc.Body)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Body* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Body>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:gdt_grpc.Body)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:gdt_grpc.Body)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Body::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Body::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Body::GetClassData() const { return &_class_data_; }
 
-void Body::MergeFrom(const Body& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Body)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Body::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Body*>(&to_msg);
+  auto& from = static_cast<const Body&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:gdt_grpc.Body)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  params_.MergeFrom(from.params_);
-  if (from.service_id() != 0) {
-    _internal_set_service_id(from._internal_service_id());
+  _this->_impl_.params_.MergeFrom(from._impl_.params_);
+  if (from._internal_service_id() != 0) {
+    _this->_internal_set_service_id(from._internal_service_id());
   }
-}
-
-void Body::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:gdt_grpc.Body)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Body::CopyFrom(const Body& from) {
@@ -1890,35 +1880,42 @@ bool Body::IsInitialized() const {
 
 void Body::InternalSwap(Body* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  params_.InternalSwap(&other->params_);
-  swap(service_id_, other->service_id_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.params_.InternalSwap(&other->_impl_.params_);
+  swap(_impl_.service_id_, other->_impl_.service_id_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Body::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gdt_2eproto_getter, &descriptor_table_gdt_2eproto_once,
+      file_level_metadata_gdt_2eproto[5]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace gdt_grpc
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::gdt_grpc::CommonRequest* Arena::CreateMaybeMessage< ::gdt_grpc::CommonRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::CommonRequest*
+Arena::CreateMaybeMessage< ::gdt_grpc::CommonRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::CommonRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::gdt_grpc::CommonReply* Arena::CreateMaybeMessage< ::gdt_grpc::CommonReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::CommonReply*
+Arena::CreateMaybeMessage< ::gdt_grpc::CommonReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::CommonReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::gdt_grpc::EndPointDescriptor* Arena::CreateMaybeMessage< ::gdt_grpc::EndPointDescriptor >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::EndPointDescriptor*
+Arena::CreateMaybeMessage< ::gdt_grpc::EndPointDescriptor >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::EndPointDescriptor >(arena);
 }
-template<> PROTOBUF_NOINLINE ::gdt_grpc::Header* Arena::CreateMaybeMessage< ::gdt_grpc::Header >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::Header*
+Arena::CreateMaybeMessage< ::gdt_grpc::Header >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::Header >(arena);
 }
-template<> PROTOBUF_NOINLINE ::gdt_grpc::Body_Param* Arena::CreateMaybeMessage< ::gdt_grpc::Body_Param >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::Body_Param*
+Arena::CreateMaybeMessage< ::gdt_grpc::Body_Param >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::Body_Param >(arena);
 }
-template<> PROTOBUF_NOINLINE ::gdt_grpc::Body* Arena::CreateMaybeMessage< ::gdt_grpc::Body >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::gdt_grpc::Body*
+Arena::CreateMaybeMessage< ::gdt_grpc::Body >(Arena* arena) {
   return Arena::CreateMessageInternal< ::gdt_grpc::Body >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -25,6 +25,9 @@ namespace gdt_grpc {
       PT_MINK_STATUS = 6018,
       PT_MINK_STATUS_MSG = 6019,
       PT_MINK_PERSISTENT_CORRELATION = 6020,
+      PT_MINK_SUB_INTERVAL = 6022,
+      PT_MINK_SUB_CANCEL = 6023,
+      PT_MINK_SUB_SNAPSHOT = 6024,
       PT_CPU_USER_PERCENT = 9000,
       PT_CPU_NICE_PERCENT = 9001,
       PT_CPU_SYSTEM_PERCENT = 9002,
@@ -100,6 +103,9 @@ namespace gdt_grpc {
       {PT_MINK_STATUS, "PT_MINK_STATUS"}, 
       {PT_MINK_STATUS_MSG, "PT_MINK_STATUS_MSG"}, 
       {PT_MINK_PERSISTENT_CORRELATION, "PT_MINK_PERSISTENT_CORRELATION"}, 
+      {PT_MINK_SUB_INTERVAL, "PT_MINK_SUB_INTERVAL"}, 
+      {PT_MINK_SUB_CANCEL, "PT_MINK_SUB_CANCEL"}, 
+      {PT_MINK_SUB_SNAPSHOT, "PT_MINK_SUB_SNAPSHOT"}, 
       {PT_CPU_USER_PERCENT, "PT_CPU_USER_PERCENT"}, 
       {PT_CPU_NICE_PERCENT, "PT_CPU_NICE_PERCENT"}, 
       {PT_CPU_SYSTEM_PERCENT, "PT_CPU_SYSTEM_PERCENT"}, 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3015000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3015008 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,18 +42,9 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_gdt_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_gdt_2eproto;
-::PROTOBUF_NAMESPACE_ID::Metadata descriptor_table_gdt_2eproto_metadata_getter(int index);
 namespace gdt_grpc {
 class Body;
 struct BodyDefaultTypeInternal;
@@ -88,8 +78,8 @@ namespace gdt_grpc {
 enum Body_ServiceId : int {
   Body_ServiceId_UNKNOWN_SERVICE_ID = 0,
   Body_ServiceId_SYSAGENT = 47,
-  Body_ServiceId_Body_ServiceId_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Body_ServiceId_Body_ServiceId_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  Body_ServiceId_Body_ServiceId_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Body_ServiceId_Body_ServiceId_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Body_ServiceId_IsValid(int value);
 constexpr Body_ServiceId Body_ServiceId_ServiceId_MIN = Body_ServiceId_UNKNOWN_SERVICE_ID;
@@ -148,8 +138,8 @@ enum SysagentCommand : int {
   CMD_NDPI_GET_STATS = 34,
   CMD_MQTT_PUBLISH = 35,
   CMD_LUA_CALL = 36,
-  SysagentCommand_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  SysagentCommand_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  SysagentCommand_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SysagentCommand_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool SysagentCommand_IsValid(int value);
 constexpr SysagentCommand SysagentCommand_MIN = UNKNWON_COMMAND;
@@ -179,6 +169,9 @@ enum ParameterType : int {
   PT_MINK_STATUS = 6018,
   PT_MINK_STATUS_MSG = 6019,
   PT_MINK_PERSISTENT_CORRELATION = 6020,
+  PT_MINK_SUB_INTERVAL = 6022,
+  PT_MINK_SUB_CANCEL = 6023,
+  PT_MINK_SUB_SNAPSHOT = 6024,
   PT_CPU_USER_PERCENT = 9000,
   PT_CPU_NICE_PERCENT = 9001,
   PT_CPU_SYSTEM_PERCENT = 9002,
@@ -244,8 +237,8 @@ enum ParameterType : int {
   PT_MODBUS_NB = 9062,
   PT_NDPI_IF = 9063,
   PT_LUA_ARG = 9064,
-  ParameterType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  ParameterType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  ParameterType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ParameterType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ParameterType_IsValid(int value);
 constexpr ParameterType ParameterType_MIN = UNKNWON_PARAMETER;
@@ -268,12 +261,12 @@ inline bool ParameterType_Parse(
 }
 // ===================================================================
 
-class CommonRequest PROTOBUF_FINAL :
+class CommonRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.CommonRequest) */ {
  public:
   inline CommonRequest() : CommonRequest(nullptr) {}
-  virtual ~CommonRequest();
-  explicit constexpr CommonRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~CommonRequest() override;
+  explicit PROTOBUF_CONSTEXPR CommonRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CommonRequest(const CommonRequest& from);
   CommonRequest(CommonRequest&& from) noexcept
@@ -286,8 +279,13 @@ class CommonRequest PROTOBUF_FINAL :
     return *this;
   }
   inline CommonRequest& operator=(CommonRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -298,10 +296,10 @@ class CommonRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const CommonRequest& default_instance() {
     return *internal_default_instance();
@@ -318,7 +316,12 @@ class CommonRequest PROTOBUF_FINAL :
   }
   inline void Swap(CommonRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -326,55 +329,53 @@ class CommonRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CommonRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CommonRequest* New() const final {
-    return CreateMaybeMessage<CommonRequest>(nullptr);
-  }
-
-  CommonRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CommonRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CommonRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CommonRequest& from);
-  void MergeFrom(const CommonRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommonRequest& from) {
+    CommonRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CommonRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.CommonRequest";
   }
   protected:
-  explicit CommonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CommonRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -391,7 +392,7 @@ class CommonRequest PROTOBUF_FINAL :
   public:
   void clear_header();
   const ::gdt_grpc::Header& header() const;
-  ::gdt_grpc::Header* release_header();
+  PROTOBUF_NODISCARD ::gdt_grpc::Header* release_header();
   ::gdt_grpc::Header* mutable_header();
   void set_allocated_header(::gdt_grpc::Header* header);
   private:
@@ -409,7 +410,7 @@ class CommonRequest PROTOBUF_FINAL :
   public:
   void clear_body();
   const ::gdt_grpc::Body& body() const;
-  ::gdt_grpc::Body* release_body();
+  PROTOBUF_NODISCARD ::gdt_grpc::Body* release_body();
   ::gdt_grpc::Body* mutable_body();
   void set_allocated_body(::gdt_grpc::Body* body);
   private:
@@ -427,19 +428,22 @@ class CommonRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::gdt_grpc::Header* header_;
-  ::gdt_grpc::Body* body_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::gdt_grpc::Header* header_;
+    ::gdt_grpc::Body* body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CommonReply PROTOBUF_FINAL :
+class CommonReply final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.CommonReply) */ {
  public:
   inline CommonReply() : CommonReply(nullptr) {}
-  virtual ~CommonReply();
-  explicit constexpr CommonReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~CommonReply() override;
+  explicit PROTOBUF_CONSTEXPR CommonReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CommonReply(const CommonReply& from);
   CommonReply(CommonReply&& from) noexcept
@@ -452,8 +456,13 @@ class CommonReply PROTOBUF_FINAL :
     return *this;
   }
   inline CommonReply& operator=(CommonReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -464,10 +473,10 @@ class CommonReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const CommonReply& default_instance() {
     return *internal_default_instance();
@@ -484,7 +493,12 @@ class CommonReply PROTOBUF_FINAL :
   }
   inline void Swap(CommonReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -492,55 +506,53 @@ class CommonReply PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(CommonReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CommonReply* New() const final {
-    return CreateMaybeMessage<CommonReply>(nullptr);
-  }
-
-  CommonReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  CommonReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CommonReply>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CommonReply& from);
-  void MergeFrom(const CommonReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommonReply& from) {
+    CommonReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(CommonReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.CommonReply";
   }
   protected:
-  explicit CommonReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CommonReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -557,7 +569,7 @@ class CommonReply PROTOBUF_FINAL :
   public:
   void clear_header();
   const ::gdt_grpc::Header& header() const;
-  ::gdt_grpc::Header* release_header();
+  PROTOBUF_NODISCARD ::gdt_grpc::Header* release_header();
   ::gdt_grpc::Header* mutable_header();
   void set_allocated_header(::gdt_grpc::Header* header);
   private:
@@ -575,7 +587,7 @@ class CommonReply PROTOBUF_FINAL :
   public:
   void clear_body();
   const ::gdt_grpc::Body& body() const;
-  ::gdt_grpc::Body* release_body();
+  PROTOBUF_NODISCARD ::gdt_grpc::Body* release_body();
   ::gdt_grpc::Body* mutable_body();
   void set_allocated_body(::gdt_grpc::Body* body);
   private:
@@ -593,19 +605,22 @@ class CommonReply PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::gdt_grpc::Header* header_;
-  ::gdt_grpc::Body* body_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::gdt_grpc::Header* header_;
+    ::gdt_grpc::Body* body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EndPointDescriptor PROTOBUF_FINAL :
+class EndPointDescriptor final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.EndPointDescriptor) */ {
  public:
   inline EndPointDescriptor() : EndPointDescriptor(nullptr) {}
-  virtual ~EndPointDescriptor();
-  explicit constexpr EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~EndPointDescriptor() override;
+  explicit PROTOBUF_CONSTEXPR EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EndPointDescriptor(const EndPointDescriptor& from);
   EndPointDescriptor(EndPointDescriptor&& from) noexcept
@@ -618,8 +633,13 @@ class EndPointDescriptor PROTOBUF_FINAL :
     return *this;
   }
   inline EndPointDescriptor& operator=(EndPointDescriptor&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -630,10 +650,10 @@ class EndPointDescriptor PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const EndPointDescriptor& default_instance() {
     return *internal_default_instance();
@@ -650,7 +670,12 @@ class EndPointDescriptor PROTOBUF_FINAL :
   }
   inline void Swap(EndPointDescriptor* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -658,55 +683,53 @@ class EndPointDescriptor PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(EndPointDescriptor* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EndPointDescriptor* New() const final {
-    return CreateMaybeMessage<EndPointDescriptor>(nullptr);
-  }
-
-  EndPointDescriptor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EndPointDescriptor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EndPointDescriptor>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EndPointDescriptor& from);
-  void MergeFrom(const EndPointDescriptor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EndPointDescriptor& from) {
+    EndPointDescriptor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EndPointDescriptor* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.EndPointDescriptor";
   }
   protected:
-  explicit EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit EndPointDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -719,32 +742,28 @@ class EndPointDescriptor PROTOBUF_FINAL :
   // string type = 1;
   void clear_type();
   const std::string& type() const;
-  void set_type(const std::string& value);
-  void set_type(std::string&& value);
-  void set_type(const char* value);
-  void set_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_type();
-  std::string* release_type();
+  PROTOBUF_NODISCARD std::string* release_type();
   void set_allocated_type(std::string* type);
   private:
   const std::string& _internal_type() const;
-  void _internal_set_type(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
   std::string* _internal_mutable_type();
   public:
 
   // string id = 2;
   void clear_id();
   const std::string& id() const;
-  void set_id(const std::string& value);
-  void set_id(std::string&& value);
-  void set_id(const char* value);
-  void set_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_id();
-  std::string* release_id();
+  PROTOBUF_NODISCARD std::string* release_id();
   void set_allocated_id(std::string* id);
   private:
   const std::string& _internal_id() const;
-  void _internal_set_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
   std::string* _internal_mutable_id();
   public:
 
@@ -755,19 +774,22 @@ class EndPointDescriptor PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Header PROTOBUF_FINAL :
+class Header final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.Header) */ {
  public:
   inline Header() : Header(nullptr) {}
-  virtual ~Header();
-  explicit constexpr Header(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~Header() override;
+  explicit PROTOBUF_CONSTEXPR Header(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Header(const Header& from);
   Header(Header&& from) noexcept
@@ -780,8 +802,13 @@ class Header PROTOBUF_FINAL :
     return *this;
   }
   inline Header& operator=(Header&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -792,10 +819,10 @@ class Header PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const Header& default_instance() {
     return *internal_default_instance();
@@ -812,7 +839,12 @@ class Header PROTOBUF_FINAL :
   }
   inline void Swap(Header* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -820,55 +852,53 @@ class Header PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Header* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Header* New() const final {
-    return CreateMaybeMessage<Header>(nullptr);
-  }
-
-  Header* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Header* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Header>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Header& from);
-  void MergeFrom(const Header& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Header& from) {
+    Header::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Header* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.Header";
   }
   protected:
-  explicit Header(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -885,7 +915,7 @@ class Header PROTOBUF_FINAL :
   public:
   void clear_source();
   const ::gdt_grpc::EndPointDescriptor& source() const;
-  ::gdt_grpc::EndPointDescriptor* release_source();
+  PROTOBUF_NODISCARD ::gdt_grpc::EndPointDescriptor* release_source();
   ::gdt_grpc::EndPointDescriptor* mutable_source();
   void set_allocated_source(::gdt_grpc::EndPointDescriptor* source);
   private:
@@ -903,7 +933,7 @@ class Header PROTOBUF_FINAL :
   public:
   void clear_destination();
   const ::gdt_grpc::EndPointDescriptor& destination() const;
-  ::gdt_grpc::EndPointDescriptor* release_destination();
+  PROTOBUF_NODISCARD ::gdt_grpc::EndPointDescriptor* release_destination();
   ::gdt_grpc::EndPointDescriptor* mutable_destination();
   void set_allocated_destination(::gdt_grpc::EndPointDescriptor* destination);
   private:
@@ -921,19 +951,22 @@ class Header PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::gdt_grpc::EndPointDescriptor* source_;
-  ::gdt_grpc::EndPointDescriptor* destination_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::gdt_grpc::EndPointDescriptor* source_;
+    ::gdt_grpc::EndPointDescriptor* destination_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Body_Param PROTOBUF_FINAL :
+class Body_Param final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.Body.Param) */ {
  public:
   inline Body_Param() : Body_Param(nullptr) {}
-  virtual ~Body_Param();
-  explicit constexpr Body_Param(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~Body_Param() override;
+  explicit PROTOBUF_CONSTEXPR Body_Param(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Body_Param(const Body_Param& from);
   Body_Param(Body_Param&& from) noexcept
@@ -946,8 +979,13 @@ class Body_Param PROTOBUF_FINAL :
     return *this;
   }
   inline Body_Param& operator=(Body_Param&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -958,10 +996,10 @@ class Body_Param PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const Body_Param& default_instance() {
     return *internal_default_instance();
@@ -978,7 +1016,12 @@ class Body_Param PROTOBUF_FINAL :
   }
   inline void Swap(Body_Param* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -986,55 +1029,53 @@ class Body_Param PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Body_Param* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Body_Param* New() const final {
-    return CreateMaybeMessage<Body_Param>(nullptr);
-  }
-
-  Body_Param* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Body_Param* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Body_Param>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Body_Param& from);
-  void MergeFrom(const Body_Param& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Body_Param& from) {
+    Body_Param::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Body_Param* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.Body.Param";
   }
   protected:
-  explicit Body_Param(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Body_Param(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1048,35 +1089,33 @@ class Body_Param PROTOBUF_FINAL :
   // string value = 3;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
   // int32 id = 1;
   void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_id() const;
-  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
   public:
 
   // int32 index = 2;
   void clear_index();
-  ::PROTOBUF_NAMESPACE_ID::int32 index() const;
-  void set_index(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t index() const;
+  void set_index(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_index() const;
-  void _internal_set_index(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:gdt_grpc.Body.Param)
@@ -1086,20 +1125,23 @@ class Body_Param PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  ::PROTOBUF_NAMESPACE_ID::int32 index_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int32_t id_;
+    int32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Body PROTOBUF_FINAL :
+class Body final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:gdt_grpc.Body) */ {
  public:
   inline Body() : Body(nullptr) {}
-  virtual ~Body();
-  explicit constexpr Body(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~Body() override;
+  explicit PROTOBUF_CONSTEXPR Body(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Body(const Body& from);
   Body(Body&& from) noexcept
@@ -1112,8 +1154,13 @@ class Body PROTOBUF_FINAL :
     return *this;
   }
   inline Body& operator=(Body&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1124,10 +1171,10 @@ class Body PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const Body& default_instance() {
     return *internal_default_instance();
@@ -1144,7 +1191,12 @@ class Body PROTOBUF_FINAL :
   }
   inline void Swap(Body* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1152,55 +1204,53 @@ class Body PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Body* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Body* New() const final {
-    return CreateMaybeMessage<Body>(nullptr);
-  }
-
-  Body* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Body* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Body>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Body& from);
-  void MergeFrom(const Body& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Body& from) {
+    Body::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Body* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "gdt_grpc.Body";
   }
   protected:
-  explicit Body(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Body(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_gdt_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1276,9 +1326,12 @@ class Body PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::gdt_grpc::Body_Param > params_;
-  int service_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::gdt_grpc::Body_Param > params_;
+    int service_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gdt_2eproto;
 };
 // ===================================================================
@@ -1294,19 +1347,19 @@ class Body PROTOBUF_FINAL :
 
 // .gdt_grpc.Header header = 1;
 inline bool CommonRequest::_internal_has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
 inline bool CommonRequest::has_header() const {
   return _internal_has_header();
 }
 inline void CommonRequest::clear_header() {
-  if (GetArena() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
 inline const ::gdt_grpc::Header& CommonRequest::_internal_header() const {
-  const ::gdt_grpc::Header* p = header_;
+  const ::gdt_grpc::Header* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::Header&>(
       ::gdt_grpc::_Header_default_instance_);
 }
@@ -1316,10 +1369,10 @@ inline const ::gdt_grpc::Header& CommonRequest::header() const {
 }
 inline void CommonRequest::unsafe_arena_set_allocated_header(
     ::gdt_grpc::Header* header) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
   }
-  header_ = header;
+  _impl_.header_ = header;
   if (header) {
     
   } else {
@@ -1329,40 +1382,47 @@ inline void CommonRequest::unsafe_arena_set_allocated_header(
 }
 inline ::gdt_grpc::Header* CommonRequest::release_header() {
   
-  ::gdt_grpc::Header* temp = header_;
-  header_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::Header* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::Header* CommonRequest::unsafe_arena_release_header() {
   // @@protoc_insertion_point(field_release:gdt_grpc.CommonRequest.header)
   
-  ::gdt_grpc::Header* temp = header_;
-  header_ = nullptr;
+  ::gdt_grpc::Header* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::Header* CommonRequest::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::Header>(GetArena());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::Header>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  return header_;
+  return _impl_.header_;
 }
 inline ::gdt_grpc::Header* CommonRequest::mutable_header() {
+  ::gdt_grpc::Header* _msg = _internal_mutable_header();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.CommonRequest.header)
-  return _internal_mutable_header();
+  return _msg;
 }
 inline void CommonRequest::set_allocated_header(::gdt_grpc::Header* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(header);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -1371,25 +1431,25 @@ inline void CommonRequest::set_allocated_header(::gdt_grpc::Header* header) {
   } else {
     
   }
-  header_ = header;
+  _impl_.header_ = header;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.CommonRequest.header)
 }
 
 // .gdt_grpc.Body body = 2;
 inline bool CommonRequest::_internal_has_body() const {
-  return this != internal_default_instance() && body_ != nullptr;
+  return this != internal_default_instance() && _impl_.body_ != nullptr;
 }
 inline bool CommonRequest::has_body() const {
   return _internal_has_body();
 }
 inline void CommonRequest::clear_body() {
-  if (GetArena() == nullptr && body_ != nullptr) {
-    delete body_;
+  if (GetArenaForAllocation() == nullptr && _impl_.body_ != nullptr) {
+    delete _impl_.body_;
   }
-  body_ = nullptr;
+  _impl_.body_ = nullptr;
 }
 inline const ::gdt_grpc::Body& CommonRequest::_internal_body() const {
-  const ::gdt_grpc::Body* p = body_;
+  const ::gdt_grpc::Body* p = _impl_.body_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::Body&>(
       ::gdt_grpc::_Body_default_instance_);
 }
@@ -1399,10 +1459,10 @@ inline const ::gdt_grpc::Body& CommonRequest::body() const {
 }
 inline void CommonRequest::unsafe_arena_set_allocated_body(
     ::gdt_grpc::Body* body) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(body_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.body_);
   }
-  body_ = body;
+  _impl_.body_ = body;
   if (body) {
     
   } else {
@@ -1412,40 +1472,47 @@ inline void CommonRequest::unsafe_arena_set_allocated_body(
 }
 inline ::gdt_grpc::Body* CommonRequest::release_body() {
   
-  ::gdt_grpc::Body* temp = body_;
-  body_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::Body* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::Body* CommonRequest::unsafe_arena_release_body() {
   // @@protoc_insertion_point(field_release:gdt_grpc.CommonRequest.body)
   
-  ::gdt_grpc::Body* temp = body_;
-  body_ = nullptr;
+  ::gdt_grpc::Body* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::Body* CommonRequest::_internal_mutable_body() {
   
-  if (body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::Body>(GetArena());
-    body_ = p;
+  if (_impl_.body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::Body>(GetArenaForAllocation());
+    _impl_.body_ = p;
   }
-  return body_;
+  return _impl_.body_;
 }
 inline ::gdt_grpc::Body* CommonRequest::mutable_body() {
+  ::gdt_grpc::Body* _msg = _internal_mutable_body();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.CommonRequest.body)
-  return _internal_mutable_body();
+  return _msg;
 }
 inline void CommonRequest::set_allocated_body(::gdt_grpc::Body* body) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete body_;
+    delete _impl_.body_;
   }
   if (body) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(body);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(body);
     if (message_arena != submessage_arena) {
       body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, body, submessage_arena);
@@ -1454,7 +1521,7 @@ inline void CommonRequest::set_allocated_body(::gdt_grpc::Body* body) {
   } else {
     
   }
-  body_ = body;
+  _impl_.body_ = body;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.CommonRequest.body)
 }
 
@@ -1464,19 +1531,19 @@ inline void CommonRequest::set_allocated_body(::gdt_grpc::Body* body) {
 
 // .gdt_grpc.Header header = 1;
 inline bool CommonReply::_internal_has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
 inline bool CommonReply::has_header() const {
   return _internal_has_header();
 }
 inline void CommonReply::clear_header() {
-  if (GetArena() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
 inline const ::gdt_grpc::Header& CommonReply::_internal_header() const {
-  const ::gdt_grpc::Header* p = header_;
+  const ::gdt_grpc::Header* p = _impl_.header_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::Header&>(
       ::gdt_grpc::_Header_default_instance_);
 }
@@ -1486,10 +1553,10 @@ inline const ::gdt_grpc::Header& CommonReply::header() const {
 }
 inline void CommonReply::unsafe_arena_set_allocated_header(
     ::gdt_grpc::Header* header) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
   }
-  header_ = header;
+  _impl_.header_ = header;
   if (header) {
     
   } else {
@@ -1499,40 +1566,47 @@ inline void CommonReply::unsafe_arena_set_allocated_header(
 }
 inline ::gdt_grpc::Header* CommonReply::release_header() {
   
-  ::gdt_grpc::Header* temp = header_;
-  header_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::Header* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::Header* CommonReply::unsafe_arena_release_header() {
   // @@protoc_insertion_point(field_release:gdt_grpc.CommonReply.header)
   
-  ::gdt_grpc::Header* temp = header_;
-  header_ = nullptr;
+  ::gdt_grpc::Header* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::Header* CommonReply::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::Header>(GetArena());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::Header>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  return header_;
+  return _impl_.header_;
 }
 inline ::gdt_grpc::Header* CommonReply::mutable_header() {
+  ::gdt_grpc::Header* _msg = _internal_mutable_header();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.CommonReply.header)
-  return _internal_mutable_header();
+  return _msg;
 }
 inline void CommonReply::set_allocated_header(::gdt_grpc::Header* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(header);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -1541,25 +1615,25 @@ inline void CommonReply::set_allocated_header(::gdt_grpc::Header* header) {
   } else {
     
   }
-  header_ = header;
+  _impl_.header_ = header;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.CommonReply.header)
 }
 
 // .gdt_grpc.Body body = 2;
 inline bool CommonReply::_internal_has_body() const {
-  return this != internal_default_instance() && body_ != nullptr;
+  return this != internal_default_instance() && _impl_.body_ != nullptr;
 }
 inline bool CommonReply::has_body() const {
   return _internal_has_body();
 }
 inline void CommonReply::clear_body() {
-  if (GetArena() == nullptr && body_ != nullptr) {
-    delete body_;
+  if (GetArenaForAllocation() == nullptr && _impl_.body_ != nullptr) {
+    delete _impl_.body_;
   }
-  body_ = nullptr;
+  _impl_.body_ = nullptr;
 }
 inline const ::gdt_grpc::Body& CommonReply::_internal_body() const {
-  const ::gdt_grpc::Body* p = body_;
+  const ::gdt_grpc::Body* p = _impl_.body_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::Body&>(
       ::gdt_grpc::_Body_default_instance_);
 }
@@ -1569,10 +1643,10 @@ inline const ::gdt_grpc::Body& CommonReply::body() const {
 }
 inline void CommonReply::unsafe_arena_set_allocated_body(
     ::gdt_grpc::Body* body) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(body_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.body_);
   }
-  body_ = body;
+  _impl_.body_ = body;
   if (body) {
     
   } else {
@@ -1582,40 +1656,47 @@ inline void CommonReply::unsafe_arena_set_allocated_body(
 }
 inline ::gdt_grpc::Body* CommonReply::release_body() {
   
-  ::gdt_grpc::Body* temp = body_;
-  body_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::Body* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::Body* CommonReply::unsafe_arena_release_body() {
   // @@protoc_insertion_point(field_release:gdt_grpc.CommonReply.body)
   
-  ::gdt_grpc::Body* temp = body_;
-  body_ = nullptr;
+  ::gdt_grpc::Body* temp = _impl_.body_;
+  _impl_.body_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::Body* CommonReply::_internal_mutable_body() {
   
-  if (body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::Body>(GetArena());
-    body_ = p;
+  if (_impl_.body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::Body>(GetArenaForAllocation());
+    _impl_.body_ = p;
   }
-  return body_;
+  return _impl_.body_;
 }
 inline ::gdt_grpc::Body* CommonReply::mutable_body() {
+  ::gdt_grpc::Body* _msg = _internal_mutable_body();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.CommonReply.body)
-  return _internal_mutable_body();
+  return _msg;
 }
 inline void CommonReply::set_allocated_body(::gdt_grpc::Body* body) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete body_;
+    delete _impl_.body_;
   }
   if (body) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(body);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(body);
     if (message_arena != submessage_arena) {
       body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, body, submessage_arena);
@@ -1624,7 +1705,7 @@ inline void CommonReply::set_allocated_body(::gdt_grpc::Body* body) {
   } else {
     
   }
-  body_ = body;
+  _impl_.body_ = body;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.CommonReply.body)
 }
 
@@ -1634,53 +1715,38 @@ inline void CommonReply::set_allocated_body(::gdt_grpc::Body* body) {
 
 // string type = 1;
 inline void EndPointDescriptor::clear_type() {
-  type_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
 }
 inline const std::string& EndPointDescriptor::type() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.EndPointDescriptor.type)
   return _internal_type();
 }
-inline void EndPointDescriptor::set_type(const std::string& value) {
-  _internal_set_type(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EndPointDescriptor::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:gdt_grpc.EndPointDescriptor.type)
 }
 inline std::string* EndPointDescriptor::mutable_type() {
+  std::string* _s = _internal_mutable_type();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.EndPointDescriptor.type)
-  return _internal_mutable_type();
+  return _s;
 }
 inline const std::string& EndPointDescriptor::_internal_type() const {
-  return type_.Get();
+  return _impl_.type_.Get();
 }
 inline void EndPointDescriptor::_internal_set_type(const std::string& value) {
   
-  type_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void EndPointDescriptor::set_type(std::string&& value) {
-  
-  type_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:gdt_grpc.EndPointDescriptor.type)
-}
-inline void EndPointDescriptor::set_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  type_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:gdt_grpc.EndPointDescriptor.type)
-}
-inline void EndPointDescriptor::set_type(const char* value,
-    size_t size) {
-  
-  type_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:gdt_grpc.EndPointDescriptor.type)
+  _impl_.type_.Set(value, GetArenaForAllocation());
 }
 inline std::string* EndPointDescriptor::_internal_mutable_type() {
   
-  return type_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EndPointDescriptor::release_type() {
   // @@protoc_insertion_point(field_release:gdt_grpc.EndPointDescriptor.type)
-  return type_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.type_.Release();
 }
 inline void EndPointDescriptor::set_allocated_type(std::string* type) {
   if (type != nullptr) {
@@ -1688,60 +1754,49 @@ inline void EndPointDescriptor::set_allocated_type(std::string* type) {
   } else {
     
   }
-  type_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), type,
-      GetArena());
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.EndPointDescriptor.type)
 }
 
 // string id = 2;
 inline void EndPointDescriptor::clear_id() {
-  id_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
 }
 inline const std::string& EndPointDescriptor::id() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.EndPointDescriptor.id)
   return _internal_id();
 }
-inline void EndPointDescriptor::set_id(const std::string& value) {
-  _internal_set_id(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EndPointDescriptor::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:gdt_grpc.EndPointDescriptor.id)
 }
 inline std::string* EndPointDescriptor::mutable_id() {
+  std::string* _s = _internal_mutable_id();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.EndPointDescriptor.id)
-  return _internal_mutable_id();
+  return _s;
 }
 inline const std::string& EndPointDescriptor::_internal_id() const {
-  return id_.Get();
+  return _impl_.id_.Get();
 }
 inline void EndPointDescriptor::_internal_set_id(const std::string& value) {
   
-  id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void EndPointDescriptor::set_id(std::string&& value) {
-  
-  id_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:gdt_grpc.EndPointDescriptor.id)
-}
-inline void EndPointDescriptor::set_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:gdt_grpc.EndPointDescriptor.id)
-}
-inline void EndPointDescriptor::set_id(const char* value,
-    size_t size) {
-  
-  id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:gdt_grpc.EndPointDescriptor.id)
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
 inline std::string* EndPointDescriptor::_internal_mutable_id() {
   
-  return id_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* EndPointDescriptor::release_id() {
   // @@protoc_insertion_point(field_release:gdt_grpc.EndPointDescriptor.id)
-  return id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.id_.Release();
 }
 inline void EndPointDescriptor::set_allocated_id(std::string* id) {
   if (id != nullptr) {
@@ -1749,8 +1804,12 @@ inline void EndPointDescriptor::set_allocated_id(std::string* id) {
   } else {
     
   }
-  id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), id,
-      GetArena());
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.EndPointDescriptor.id)
 }
 
@@ -1760,19 +1819,19 @@ inline void EndPointDescriptor::set_allocated_id(std::string* id) {
 
 // .gdt_grpc.EndPointDescriptor source = 1;
 inline bool Header::_internal_has_source() const {
-  return this != internal_default_instance() && source_ != nullptr;
+  return this != internal_default_instance() && _impl_.source_ != nullptr;
 }
 inline bool Header::has_source() const {
   return _internal_has_source();
 }
 inline void Header::clear_source() {
-  if (GetArena() == nullptr && source_ != nullptr) {
-    delete source_;
+  if (GetArenaForAllocation() == nullptr && _impl_.source_ != nullptr) {
+    delete _impl_.source_;
   }
-  source_ = nullptr;
+  _impl_.source_ = nullptr;
 }
 inline const ::gdt_grpc::EndPointDescriptor& Header::_internal_source() const {
-  const ::gdt_grpc::EndPointDescriptor* p = source_;
+  const ::gdt_grpc::EndPointDescriptor* p = _impl_.source_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::EndPointDescriptor&>(
       ::gdt_grpc::_EndPointDescriptor_default_instance_);
 }
@@ -1782,10 +1841,10 @@ inline const ::gdt_grpc::EndPointDescriptor& Header::source() const {
 }
 inline void Header::unsafe_arena_set_allocated_source(
     ::gdt_grpc::EndPointDescriptor* source) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(source_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.source_);
   }
-  source_ = source;
+  _impl_.source_ = source;
   if (source) {
     
   } else {
@@ -1795,40 +1854,47 @@ inline void Header::unsafe_arena_set_allocated_source(
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::release_source() {
   
-  ::gdt_grpc::EndPointDescriptor* temp = source_;
-  source_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::EndPointDescriptor* temp = _impl_.source_;
+  _impl_.source_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::unsafe_arena_release_source() {
   // @@protoc_insertion_point(field_release:gdt_grpc.Header.source)
   
-  ::gdt_grpc::EndPointDescriptor* temp = source_;
-  source_ = nullptr;
+  ::gdt_grpc::EndPointDescriptor* temp = _impl_.source_;
+  _impl_.source_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::_internal_mutable_source() {
   
-  if (source_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::EndPointDescriptor>(GetArena());
-    source_ = p;
+  if (_impl_.source_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::EndPointDescriptor>(GetArenaForAllocation());
+    _impl_.source_ = p;
   }
-  return source_;
+  return _impl_.source_;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::mutable_source() {
+  ::gdt_grpc::EndPointDescriptor* _msg = _internal_mutable_source();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.Header.source)
-  return _internal_mutable_source();
+  return _msg;
 }
 inline void Header::set_allocated_source(::gdt_grpc::EndPointDescriptor* source) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete source_;
+    delete _impl_.source_;
   }
   if (source) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(source);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(source);
     if (message_arena != submessage_arena) {
       source = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, source, submessage_arena);
@@ -1837,25 +1903,25 @@ inline void Header::set_allocated_source(::gdt_grpc::EndPointDescriptor* source)
   } else {
     
   }
-  source_ = source;
+  _impl_.source_ = source;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.Header.source)
 }
 
 // .gdt_grpc.EndPointDescriptor destination = 2;
 inline bool Header::_internal_has_destination() const {
-  return this != internal_default_instance() && destination_ != nullptr;
+  return this != internal_default_instance() && _impl_.destination_ != nullptr;
 }
 inline bool Header::has_destination() const {
   return _internal_has_destination();
 }
 inline void Header::clear_destination() {
-  if (GetArena() == nullptr && destination_ != nullptr) {
-    delete destination_;
+  if (GetArenaForAllocation() == nullptr && _impl_.destination_ != nullptr) {
+    delete _impl_.destination_;
   }
-  destination_ = nullptr;
+  _impl_.destination_ = nullptr;
 }
 inline const ::gdt_grpc::EndPointDescriptor& Header::_internal_destination() const {
-  const ::gdt_grpc::EndPointDescriptor* p = destination_;
+  const ::gdt_grpc::EndPointDescriptor* p = _impl_.destination_;
   return p != nullptr ? *p : reinterpret_cast<const ::gdt_grpc::EndPointDescriptor&>(
       ::gdt_grpc::_EndPointDescriptor_default_instance_);
 }
@@ -1865,10 +1931,10 @@ inline const ::gdt_grpc::EndPointDescriptor& Header::destination() const {
 }
 inline void Header::unsafe_arena_set_allocated_destination(
     ::gdt_grpc::EndPointDescriptor* destination) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(destination_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.destination_);
   }
-  destination_ = destination;
+  _impl_.destination_ = destination;
   if (destination) {
     
   } else {
@@ -1878,40 +1944,47 @@ inline void Header::unsafe_arena_set_allocated_destination(
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::release_destination() {
   
-  ::gdt_grpc::EndPointDescriptor* temp = destination_;
-  destination_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::gdt_grpc::EndPointDescriptor* temp = _impl_.destination_;
+  _impl_.destination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::unsafe_arena_release_destination() {
   // @@protoc_insertion_point(field_release:gdt_grpc.Header.destination)
   
-  ::gdt_grpc::EndPointDescriptor* temp = destination_;
-  destination_ = nullptr;
+  ::gdt_grpc::EndPointDescriptor* temp = _impl_.destination_;
+  _impl_.destination_ = nullptr;
   return temp;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::_internal_mutable_destination() {
   
-  if (destination_ == nullptr) {
-    auto* p = CreateMaybeMessage<::gdt_grpc::EndPointDescriptor>(GetArena());
-    destination_ = p;
+  if (_impl_.destination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::gdt_grpc::EndPointDescriptor>(GetArenaForAllocation());
+    _impl_.destination_ = p;
   }
-  return destination_;
+  return _impl_.destination_;
 }
 inline ::gdt_grpc::EndPointDescriptor* Header::mutable_destination() {
+  ::gdt_grpc::EndPointDescriptor* _msg = _internal_mutable_destination();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.Header.destination)
-  return _internal_mutable_destination();
+  return _msg;
 }
 inline void Header::set_allocated_destination(::gdt_grpc::EndPointDescriptor* destination) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete destination_;
+    delete _impl_.destination_;
   }
   if (destination) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(destination);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(destination);
     if (message_arena != submessage_arena) {
       destination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, destination, submessage_arena);
@@ -1920,7 +1993,7 @@ inline void Header::set_allocated_destination(::gdt_grpc::EndPointDescriptor* de
   } else {
     
   }
-  destination_ = destination;
+  _impl_.destination_ = destination;
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.Header.destination)
 }
 
@@ -1930,93 +2003,78 @@ inline void Header::set_allocated_destination(::gdt_grpc::EndPointDescriptor* de
 
 // int32 id = 1;
 inline void Body_Param::clear_id() {
-  id_ = 0;
+  _impl_.id_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Body_Param::_internal_id() const {
-  return id_;
+inline int32_t Body_Param::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Body_Param::id() const {
+inline int32_t Body_Param::id() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.Body.Param.id)
   return _internal_id();
 }
-inline void Body_Param::_internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Body_Param::_internal_set_id(int32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
 }
-inline void Body_Param::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Body_Param::set_id(int32_t value) {
   _internal_set_id(value);
   // @@protoc_insertion_point(field_set:gdt_grpc.Body.Param.id)
 }
 
 // int32 index = 2;
 inline void Body_Param::clear_index() {
-  index_ = 0;
+  _impl_.index_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Body_Param::_internal_index() const {
-  return index_;
+inline int32_t Body_Param::_internal_index() const {
+  return _impl_.index_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 Body_Param::index() const {
+inline int32_t Body_Param::index() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.Body.Param.index)
   return _internal_index();
 }
-inline void Body_Param::_internal_set_index(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Body_Param::_internal_set_index(int32_t value) {
   
-  index_ = value;
+  _impl_.index_ = value;
 }
-inline void Body_Param::set_index(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void Body_Param::set_index(int32_t value) {
   _internal_set_index(value);
   // @@protoc_insertion_point(field_set:gdt_grpc.Body.Param.index)
 }
 
 // string value = 3;
 inline void Body_Param::clear_value() {
-  value_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& Body_Param::value() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.Body.Param.value)
   return _internal_value();
 }
-inline void Body_Param::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Body_Param::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:gdt_grpc.Body.Param.value)
 }
 inline std::string* Body_Param::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:gdt_grpc.Body.Param.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& Body_Param::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void Body_Param::_internal_set_value(const std::string& value) {
   
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Body_Param::set_value(std::string&& value) {
-  
-  value_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:gdt_grpc.Body.Param.value)
-}
-inline void Body_Param::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:gdt_grpc.Body.Param.value)
-}
-inline void Body_Param::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:gdt_grpc.Body.Param.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Body_Param::_internal_mutable_value() {
   
-  return value_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Body_Param::release_value() {
   // @@protoc_insertion_point(field_release:gdt_grpc.Body.Param.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void Body_Param::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -2024,8 +2082,12 @@ inline void Body_Param::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:gdt_grpc.Body.Param.value)
 }
 
@@ -2035,10 +2097,10 @@ inline void Body_Param::set_allocated_value(std::string* value) {
 
 // .gdt_grpc.Body.ServiceId service_id = 1;
 inline void Body::clear_service_id() {
-  service_id_ = 0;
+  _impl_.service_id_ = 0;
 }
 inline ::gdt_grpc::Body_ServiceId Body::_internal_service_id() const {
-  return static_cast< ::gdt_grpc::Body_ServiceId >(service_id_);
+  return static_cast< ::gdt_grpc::Body_ServiceId >(_impl_.service_id_);
 }
 inline ::gdt_grpc::Body_ServiceId Body::service_id() const {
   // @@protoc_insertion_point(field_get:gdt_grpc.Body.service_id)
@@ -2046,7 +2108,7 @@ inline ::gdt_grpc::Body_ServiceId Body::service_id() const {
 }
 inline void Body::_internal_set_service_id(::gdt_grpc::Body_ServiceId value) {
   
-  service_id_ = value;
+  _impl_.service_id_ = value;
 }
 inline void Body::set_service_id(::gdt_grpc::Body_ServiceId value) {
   _internal_set_service_id(value);
@@ -2055,41 +2117,42 @@ inline void Body::set_service_id(::gdt_grpc::Body_ServiceId value) {
 
 // repeated .gdt_grpc.Body.Param params = 2;
 inline int Body::_internal_params_size() const {
-  return params_.size();
+  return _impl_.params_.size();
 }
 inline int Body::params_size() const {
   return _internal_params_size();
 }
 inline void Body::clear_params() {
-  params_.Clear();
+  _impl_.params_.Clear();
 }
 inline ::gdt_grpc::Body_Param* Body::mutable_params(int index) {
   // @@protoc_insertion_point(field_mutable:gdt_grpc.Body.params)
-  return params_.Mutable(index);
+  return _impl_.params_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::gdt_grpc::Body_Param >*
 Body::mutable_params() {
   // @@protoc_insertion_point(field_mutable_list:gdt_grpc.Body.params)
-  return &params_;
+  return &_impl_.params_;
 }
 inline const ::gdt_grpc::Body_Param& Body::_internal_params(int index) const {
-  return params_.Get(index);
+  return _impl_.params_.Get(index);
 }
 inline const ::gdt_grpc::Body_Param& Body::params(int index) const {
   // @@protoc_insertion_point(field_get:gdt_grpc.Body.params)
   return _internal_params(index);
 }
 inline ::gdt_grpc::Body_Param* Body::_internal_add_params() {
-  return params_.Add();
+  return _impl_.params_.Add();
 }
 inline ::gdt_grpc::Body_Param* Body::add_params() {
+  ::gdt_grpc::Body_Param* _add = _internal_add_params();
   // @@protoc_insertion_point(field_add:gdt_grpc.Body.params)
-  return _internal_add_params();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::gdt_grpc::Body_Param >&
 Body::params() const {
   // @@protoc_insertion_point(field_list:gdt_grpc.Body.params)
-  return params_;
+  return _impl_.params_;
 }
 
 #ifdef __GNUC__
@@ -54,6 +54,47 @@ void EVHbeatCleanup::run(gdt::GDTCallbackArgs *args) {
 }
 #endif
 
+// Convert GDT reply to gRPC reply
+static void smsg_to_reply(gdt::ServiceMessage *smsg,
+                          const mink_utils::VariantParam *vp_src_type,
+                          const mink_utils::VariantParam *vp_src_id,
+                          gdt_grpc::CommonReply *rpl){
+    // header
+    gdt_grpc::Header *hdr = rpl->mutable_header();
+    gdt_grpc::Body *bdy = rpl->mutable_body();
+    // set header
+    hdr->mutable_source()->set_id(static_cast<char*>(*vp_src_id));
+    hdr->mutable_source()->set_type(static_cast<char*>(*vp_src_type));
+    
+    // set params
+    mink_utils::PooledVPMap<uint32_t>::it_t it = smsg->vpmap.get_begin();
+    // loop param map
+    for(; it != smsg->vpmap.get_end(); it++){
+        // pointer type is used for long params
+        if(it->second.get_type() == mink_utils::DPT_POINTER){
+            auto data = static_cast<data_vec_t *>((void *)it->second);
+            std::string s(reinterpret_cast<char *>(data->data()), data->size());
+            // new grpc param
+            gdt_grpc::Body::Param *p = bdy->add_params();
+            p->set_id(it->first.key);
+            p->set_index(it->first.index);
+            p->set_value(s);
+            delete data;
+            continue;
+        }
+        // skip non-string params
+        if(it->second.get_type() != mink_utils::DPT_STRING) continue;
+        // new grpc param
+        gdt_grpc::Body::Param *p = bdy->add_params();
+        p->set_id(it->first.key);
+        p->set_index(it->first.index);
+        p->set_value(static_cast<char*>(it->second));
+
+        std::cout << it->first.key << " - " << (char*)it->second << std::endl;
+
+    }
+}
+
 void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     std::cout << "EVSrvcMsgRecv::run" << std::endl;
     gdt::ServiceMessage* smsg = args->get<gdt::ServiceMessage>(gdt::GDT_CB_INPUT_ARGS, 
@@ -100,6 +141,13 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     
     std::cout << "GUIDD found!!!" << std::endl;
 
+    // persistent correlation (subscription push)
+    const mink_utils::VariantParam *vp_p_guid =
+        smsg->vpget(asn1::ParameterType::_pt_mink_persistent_correlation);
+    // subscription dropped by source (final push)
+    const mink_utils::VariantParam *vp_cancel =
+        smsg->vpget(asn1::ParameterType::_pt_mink_sub_cancel);
+
     // correlate guid
     dd->cmap.lock();
     mink_utils::Guid guid;
@@ -107,54 +155,52 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     GrpcPayload **pld = dd->cmap.get(guid);
     if(!pld){
         dd->cmap.unlock();
+        // stale subscription, stop sampling
+        if (vp_p_guid && !vp_cancel)
+            dd->sub_cancel(guid,
+                           static_cast<char *>(*vp_src_type),
+                           static_cast<char *>(*vp_src_id));
         return;
     }
 
     // call data pointer
-    RPCBase *c = (*pld)->cdata;
+    GrpcPayload *p = *pld;
+    RPCBase *c = p->cdata;
+
+    // streaming call; keep correlation, reply is queued
+    // while cmap is locked (call can be released
+    // concurrently)
+    if (vp_p_guid && c->streaming()) {
+        // no more pushes, end the stream
+        if (vp_cancel) {
+            dd->cmap.remove(guid);
+            c->expire();
+            dd->cmap.unlock();
+            dd->cpool.deallocate_constructed(p);
+            return;
+        }
+        p->persistent = true;
+        dd->cmap.update_ts(guid);
+        gdt_grpc::CommonReply rpl;
+        smsg_to_reply(smsg, vp_src_type, vp_src_id, &rpl);
+        c->push(std::move(rpl));
+        dd->cmap.unlock();
+        return;
+    }
+
     // update ts
     dd->cmap.update_ts(guid);
     dd->cmap.remove(guid);
     // unlock
     dd->cmap.unlock();
+    // dealloc
+    dd->cpool.deallocate_constructed(p);
 
 
     std::cout << "GUIDD correlated!!!" << std::endl;
 
-    // header
-    gdt_grpc::Header *hdr = c->reply_.mutable_header();
-    gdt_grpc::Body *bdy = c->reply_.mutable_body();
-    // set header
-    hdr->mutable_source()->set_id(static_cast<char*>(*vp_src_id));
-    hdr->mutable_source()->set_type(static_cast<char*>(*vp_src_type));
-    
-    // set params
-    mink_utils::PooledVPMap<uint32_t>::it_t it = smsg->vpmap.get_begin();
-    // loop param map
-    for(; it != smsg->vpmap.get_end(); it++){
-        // pointer type is used for long params
-        if(it->second.get_type() == mink_utils::DPT_POINTER){
-            auto data = static_cast<data_vec_t *>((void *)it->second);
-            std::string s(reinterpret_cast<char *>(data->data()), data->size());
-            // new grpc param
-            gdt_grpc::Body::Param *p = bdy->add_params();
-            p->set_id(it->first.key);
-            p->set_index(it->first.index);
-            p->set_value(s);
-            delete data;
-            continue;
-        }
-        // skip non-string params
-        if(it->second.get_type() != mink_utils::DPT_STRING) continue;
-        // new grpc param
-        gdt_grpc::Body::Param *p = bdy->add_params();
-        p->set_id(it->first.key);
-        p->set_index(it->first.index);
-        p->set_value(static_cast<char*>(it->second));
-
-        std::cout << it->first.key << " - " << (char*)it->second << std::endl;
-
-    }
+    // convert reply
+    smsg_to_reply(smsg, vp_src_type, vp_src_id, &c->reply_);
     
     // send grpc reply
     c->status_ = RPCBase::FINISH;
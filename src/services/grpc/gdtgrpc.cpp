@@ -45,9 +45,23 @@ void RPCBase::proceed(){
     std::cout << "Calldata:proceed: " << this << std::endl;
 }
 
+void RPCBase::expire(){
+    status_ = FINISH;
+    responder_.Finish(reply_, grpc::Status(grpc::ABORTED, ""), this);
+}
+
+bool RPCBase::streaming() const {
+    return false;
+}
+
+void RPCBase::push(gdt_grpc::CommonReply &&rpl){
+    // unary calls are replied to directly
+}
+
 bool RPCBase::gdt_push(const gdt_grpc::CommonRequest &req, 
                         RPCBase *data,
-                        uint32_t cmd_id) const {
+                        uint32_t cmd_id,
+                        mink_utils::Guid *guid) const {
 
     auto dd = static_cast<GrpcdDescriptor*>(mink::CURRENT_DAEMON);
     // local routing daemon pointer
@@ -59,7 +73,7 @@ bool RPCBase::gdt_push(const gdt_grpc::CommonRequest &req,
     // randomizer
     mink_utils::Randomizer rand;
     // tmp guid
-    uint8_t guid[16];
+    uint8_t tmp_guid[16];
 
     // *********************************************
     // ************ push via GDT *******************
@@ -144,8 +158,9 @@ bool RPCBase::gdt_push(const gdt_grpc::CommonRequest &req,
     // set correlation payload data
     pld->cdata = data;
     // generate guid
-    rand.generate(guid, 16);
-    pld->guid.set(guid);
+    rand.generate(tmp_guid, 16);
+    pld->guid.set(tmp_guid);
+    if (guid) *guid = pld->guid;
     msg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, 
                           pld->guid.data(), 
                           16);
@@ -153,6 +168,7 @@ bool RPCBase::gdt_push(const gdt_grpc::CommonRequest &req,
     // sync vpmap
     if (dd->gdtsmm->vpmap_sparam_sync(msg, pmap) != 0) {
         // TODO stats
+        dd->cpool.deallocate_constructed(pld);
         dd->gdtsmm->free_smsg(msg);
         return false;
     }
@@ -161,23 +177,51 @@ bool RPCBase::gdt_push(const gdt_grpc::CommonRequest &req,
     std::string dest_id = hdr.destination().id();
     std::cout << "DESTINATIN ID: " << dest_id << std::endl;
 
+    // guid copy (pld is owned by cmap after set)
+    mink_utils::Guid guid_c = pld->guid;
+
+    // save to correlarion map (before sending, pipelined
+    // replies can arrive before send returns)
+    dd->cmap.lock();
+    dd->cmap.set(pld->guid, pld);
+    dd->cmap.unlock();
+
+    // pipelined mode is opt-in via "mink-pipelined" client
+    // metadata (stateless-no-reply, routing errors are not reported)
+    const auto &md = data->ctx_.client_metadata();
+    auto md_it = md.find("mink-pipelined");
+    bool pipelined = (md_it != md.end()) &&
+                     (md_it->second == "1" || md_it->second == "true");
+
     // send service message
-    int r = dd->gdtsmm->send(msg, 
+    const char *did = (!dest_id.empty() ? dest_id.c_str() : nullptr);
+    int r;
+    if (pipelined)
+        r = dd->gdtsmm->send_pipelined(msg, 
+                                       gdtc, 
+                                       hdr.destination().type().c_str(), 
+                                       did,
+                                       &dd->ev_srvcm_tx);
+    else
+        r = dd->gdtsmm->send(msg, 
                              gdtc, 
                              hdr.destination().type().c_str(), 
-                             (!dest_id.empty() ? dest_id.c_str() : nullptr),
+                             did,
                              true, 
                              &dd->ev_srvcm_tx);
     if (r) {
         // TODO stats
+        dd->cmap.lock();
+        dd->cmap.remove(pld->guid);
+        dd->cmap.unlock();
+        dd->cpool.deallocate_constructed(pld);
         dd->gdtsmm->free_smsg(msg);
         return false;
     }
 
-    // save to correlarion map
-    dd->cmap.lock();
-    dd->cmap.set(pld->guid, pld);
-    dd->cmap.unlock();
+    // start timeout (reply may have already arrived,
+    // expired guid will not be found in cmap)
+    dd->rpc_timer.add(guid_c, dd->cmap.get_timeout() * 1000);
 
     return true;
 }
@@ -273,13 +317,186 @@ void GetDataCall::proceed() {
     }
 }
 
+/*****************/
+/* SubscribeCall */
+/*****************/
+SubscribeCall::SubscribeCall(gdt_grpc::SysagentGrpcService::AsyncService *service,
+                             grpc::ServerCompletionQueue *cq): RPCBase(service, cq),
+                                                               writer_(&ctx_),
+                                                               done_tag_(this) {
+    proceed();
+}
+
+void SubscribeCall::proceed() {
+    // status_ is also set by finish() from GDT thread
+    std::unique_lock<std::mutex> l(mtx_);
+    if (status_ == CREATE) {
+        status_ = PROCESS;
+        l.unlock();
+        // client cancel notification (before call starts)
+        ctx_.AsyncNotifyWhenDone(&done_tag_);
+        service_->RequestSubscribe(&ctx_, 
+                                   &request_, 
+                                   &writer_, 
+                                   cq_, 
+                                   cq_,
+                                   this);
+
+    } else if (status_ == PROCESS) {
+        // command id
+        uint32_t cmd_id = 0;
+        // verify header and interval
+        if (!verify(request_, &cmd_id) || !has_interval()) {
+            finish(grpc::Status(grpc::INVALID_ARGUMENT, ""));
+            l.unlock();
+            // serve new clients
+            new SubscribeCall(service_, cq_);
+            return;
+        }
+        // write completions from now on
+        status_ = STREAM;
+        l.unlock();
+        // serve new clients
+        new SubscribeCall(service_, cq_);
+        // subscribe via GDT (replies are pushed
+        // from GDT callback)
+        if (!gdt_push(request_, this, cmd_id, &guid_)) {
+            l.lock();
+            finish(grpc::Status(grpc::ABORTED, ""));
+            return;
+        }
+        subscribed_ = true;
+
+    } else if (status_ == STREAM) {
+        l.unlock();
+        // write completed
+        write_next();
+
+    } else {
+        GPR_ASSERT(status_ == FINISH);
+        l.unlock();
+        finished_ = true;
+        // done notification is always delivered
+        // after the call is finished
+        if (done_) release();
+    }
+}
+
+void SubscribeCall::expire(){
+    // no data received from sysagentd (or
+    // subscription dropped by sysagentd)
+    std::unique_lock<std::mutex> l(mtx_);
+    finish(grpc::Status(grpc::ABORTED, ""));
+}
+
+bool SubscribeCall::streaming() const {
+    return true;
+}
+
+void SubscribeCall::push(gdt_grpc::CommonReply &&rpl){
+    std::unique_lock<std::mutex> l(mtx_);
+    if (finishing_) return;
+    // one write at a time
+    if (writing_) {
+        // slow client; deltas cannot be dropped
+        // so the stream is ended instead
+        if (queue_.size() >= MAX_QUEUE) {
+            finish(grpc::Status(grpc::RESOURCE_EXHAUSTED, ""));
+            return;
+        }
+        queue_.push_back(std::move(rpl));
+        return;
+    }
+    writing_ = true;
+    reply_ = std::move(rpl);
+    writer_.Write(reply_, this);
+}
+
+bool SubscribeCall::has_interval() const {
+    const gdt_grpc::Body &bdy = request_.body();
+    for (int i = 0; i < bdy.params_size(); i++) {
+        if (bdy.params(i).id() == asn1::ParameterType::_pt_mink_sub_interval)
+            return true;
+    }
+    return false;
+}
+
+void SubscribeCall::write_next(){
+    std::unique_lock<std::mutex> l(mtx_);
+    writing_ = false;
+    // client gone
+    if (!ok_) {
+        finish(grpc::Status::CANCELLED);
+        return;
+    }
+    // finish was postponed
+    if (finishing_) {
+        finish(fin_status_);
+        return;
+    }
+    if (queue_.empty()) return;
+    writing_ = true;
+    reply_ = std::move(queue_.front());
+    queue_.pop_front();
+    writer_.Write(reply_, this);
+}
+
+// Finish stream after pending write (mtx_ locked)
+void SubscribeCall::finish(const grpc::Status &st){
+    if (!finishing_) {
+        finishing_ = true;
+        fin_status_ = st;
+    }
+    if (writing_ || status_ == FINISH) return;
+    status_ = FINISH;
+    writer_.Finish(fin_status_, this);
+}
+
+void SubscribeCall::done(){
+    done_ = true;
+    // client cancelled or deadline exceeded
+    if (ctx_.IsCancelled()) {
+        std::unique_lock<std::mutex> l(mtx_);
+        finish(grpc::Status::CANCELLED);
+    }
+    if (finished_) release();
+}
+
+void SubscribeCall::release(){
+    if (subscribed_) {
+        auto dd = static_cast<GrpcdDescriptor*>(mink::CURRENT_DAEMON);
+        // stop GDT pushes (reply handler pushes
+        // while holding cmap lock)
+        GrpcPayload *pld = nullptr;
+        dd->cmap.lock();
+        GrpcPayload **p = dd->cmap.get(guid_);
+        if (p) {
+            pld = *p;
+            dd->cmap.remove(guid_);
+        }
+        dd->cmap.unlock();
+        if (pld) dd->cpool.deallocate_constructed(pld);
+
+        // stop sampling on sysagentd
+        const gdt_grpc::Header &hdr = request_.header();
+        const std::string &dest_id = hdr.destination().id();
+        dd->sub_cancel(guid_,
+                       hdr.destination().type().c_str(),
+                       (!dest_id.empty() ? dest_id.c_str() : nullptr));
+    }
+    delete this;
+}
+
 /*****************/
 /* GdtGrpcServer */
 /*****************/
+GdtGrpcServer::GdtGrpcServer(int cq_nr) : cq_nr_(cq_nr > 0 ? cq_nr : 1) {}
+
 GdtGrpcServer::~GdtGrpcServer(){
     server_->Shutdown();
     // Always shutdown the completion queue after the server.
-    cq_->Shutdown();
+    for (auto &cq : cqs_)
+        cq->Shutdown();
 }
 
 void GdtGrpcServer::run(){
@@ -291,35 +508,105 @@ void GdtGrpcServer::run(){
     // Register "service_" as the instance through which we'll communicate with
     // clients. In this case it corresponds to an *asynchronous* service.
     builder.RegisterService(&service_);
-    // Get hold of the completion queue used for the asynchronous communication
-    // with the gRPC runtime.
-    cq_ = builder.AddCompletionQueue();
+    // Get hold of the completion queues used for the asynchronous
+    // communication with the gRPC runtime.
+    for (int i = 0; i < cq_nr_; i++)
+        cqs_.emplace_back(builder.AddCompletionQueue());
     // Finally assemble the server.
     server_ = builder.BuildAndStart();
     std::cout << "Server listening on " << server_address << std::endl;
+    mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                              "Starting gRPC server with [%d] completion queues",
+                              cq_nr_);
+
+    // one thread per completion queue
+    std::vector<std::thread> v;
+    v.reserve(cq_nr_ - 1);
+    for (int i = 1; i < cq_nr_; i++)
+        v.emplace_back(&GdtGrpcServer::handle_rpcs, this, cqs_[i].get());
+
     // proceed to the server's main loop.
-    handle_rpcs();
+    handle_rpcs(cqs_[0].get());
+
+    // wait for cq threads
+    for (auto &t : v)
+        t.join();
 }
 
-void GdtGrpcServer::handle_rpcs() {
-    auto dd = static_cast<GrpcdDescriptor*>(mink::CURRENT_DAEMON);
+void GdtGrpcServer::handle_rpcs(grpc::ServerCompletionQueue *cq) {
     // Spawn a new RPCBase instance to serve new clients.
-    new GetDataCall(&service_, cq_.get());
+    new GetDataCall(&service_, cq);
+    new SubscribeCall(&service_, cq);
     void *tag; // uniquely identifies a request.
     bool ok;
-    while (true) {
-        // Block waiting to read the next event from the completion queue. The
-        // event is uniquely identified by its tag, which in this case is the
-        // memory address of a RPCBase instance.
-        // The return value of Next should always be checked. This return value
-        // tells us whether there is any kind of event or cq_ is shutting down.
-        GPR_ASSERT(cq_->Next(&tag, &ok));
-
-        auto call = static_cast<RPCBase*>(tag);
+    // Block waiting to read the next event from the completion queue. The
+    // event is uniquely identified by its tag, which in this case is the
+    // memory address of a RPCBase instance.
+    // The return value of Next should always be checked. This return value
+    // tells us whether there is any kind of event or cq is shutting down.
+    while (cq->Next(&tag, &ok)) {
+        auto call = static_cast<RPCTag*>(tag);
+        call->ok_ = ok;
         call->proceed();
-        // process timeout
-        dd->cmap_process_timeout();
     }
 }
 
+/************/
+/* RPCTimer */
+/************/
+RPCTimer::~RPCTimer(){
+    stop();
+}
+
+void RPCTimer::start(const std::function<void(const mink_utils::Guid &)> &f){
+    std::unique_lock<std::mutex> l(mtx);
+    if (active)
+        return;
+    on_expire = f;
+    active = true;
+    th = std::thread(&RPCTimer::run, this);
+}
 
+void RPCTimer::stop(){
+    std::unique_lock<std::mutex> l(mtx);
+    if (!active)
+        return;
+    active = false;
+    l.unlock();
+    cv.notify_one();
+    th.join();
+}
+
+void RPCTimer::add(const mink_utils::Guid &guid, uint32_t tmt_msec){
+    std::unique_lock<std::mutex> l(mtx);
+    auto dl = clock_t::now() + std::chrono::milliseconds(tmt_msec);
+    // wake timer thread only if new deadline is the earliest
+    bool wake = heap.empty() || dl < heap.top().first;
+    heap.emplace(dl, guid);
+    l.unlock();
+    if (wake)
+        cv.notify_one();
+}
+
+void RPCTimer::run(){
+    std::unique_lock<std::mutex> l(mtx);
+    while (active) {
+        // nothing scheduled
+        if (heap.empty()) {
+            cv.wait(l);
+            continue;
+        }
+        // wait for earliest deadline (or new earlier entry)
+        auto dl = heap.top().first;
+        if (clock_t::now() < dl) {
+            cv.wait_until(l, dl);
+            continue;
+        }
+        // expired
+        mink_utils::Guid g = heap.top().second;
+        heap.pop();
+        l.unlock();
+        on_expire(g);
+        l.lock();
+    }
+}
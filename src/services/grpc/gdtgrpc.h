@@ -14,9 +14,27 @@
 #include <grpcpp/impl/codegen/status_code_enum.h>
 #include <grpcpp/grpcpp.h>
 #include <gdt.grpc.pb.h>
+#include <mink_utils.h>
+#include <queue>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+
+// Completion queue tag
+class RPCTag {
+public:
+    virtual ~RPCTag() = default;
+    virtual void proceed() = 0;
+
+    // event status (set by completion queue loop)
+    bool ok_ = true;
+};
 
 // Class encompasing the state and logic needed to serve a request.
-class RPCBase {
+class RPCBase: public RPCTag {
 public:
     // Take in the "service" instance (in this case representing an
     // asynchronous server) and the completion queue "cq" used for
@@ -25,11 +43,18 @@ public:
              grpc::ServerCompletionQueue *cq);
     virtual ~RPCBase();
 
-    virtual void proceed();
+    void proceed() override;
+    // call timeout (cmap locked)
+    virtual void expire();
+    // streaming calls accept more than one reply
+    virtual bool streaming() const;
+    // streamed reply (cmap locked)
+    virtual void push(gdt_grpc::CommonReply &&rpl);
     bool verify(const gdt_grpc::CommonRequest &req, uint32_t *cmd_id) const;
     bool gdt_push(const gdt_grpc::CommonRequest &req, 
                   RPCBase *data,
-                  uint32_t cmd_id) const;
+                  uint32_t cmd_id,
+                  mink_utils::Guid *guid = nullptr) const;
 
     // The means of communication with the gRPC runtime for an asynchronous
     // server.
@@ -51,7 +76,7 @@ public:
     grpc::ServerAsyncResponseWriter<gdt_grpc::CommonReply> responder_;
 
     // Let's implement a tiny state machine with the following states.
-    enum CallStatus { CREATE, PROCESS, FINISH };
+    enum CallStatus { CREATE, PROCESS, STREAM, FINISH };
     CallStatus status_; // The current serving state.
 };
 
@@ -63,21 +88,102 @@ public:
     void proceed() override;
 };
 
+// Subscription (server streaming); GDT replies are queued
+// and written to client one at a time
+class SubscribeCall: public RPCBase {
+public:
+    SubscribeCall(gdt_grpc::SysagentGrpcService::AsyncService *service,
+                  grpc::ServerCompletionQueue *cq);
+
+    void proceed() override;
+    void expire() override;
+    bool streaming() const override;
+    void push(gdt_grpc::CommonReply &&rpl) override;
+
+    // max queued replies (slow client)
+    static constexpr std::size_t MAX_QUEUE = 64;
+
+private:
+    // call done notification (client cancel)
+    class DoneTag: public RPCTag {
+    public:
+        explicit DoneTag(SubscribeCall *c) : call(c) {}
+        void proceed() override { call->done(); }
+
+        SubscribeCall *call;
+    };
+
+    bool has_interval() const;
+    void write_next();
+    void finish(const grpc::Status &st);
+    void done();
+    void release();
+
+    grpc::ServerAsyncWriter<gdt_grpc::CommonReply> writer_;
+    DoneTag done_tag_;
+    // pending replies and write state (mtx_)
+    std::deque<gdt_grpc::CommonReply> queue_;
+    std::mutex mtx_;
+    grpc::Status fin_status_;
+    bool writing_ = false;
+    bool finishing_ = false;
+    // subscription guid
+    mink_utils::Guid guid_;
+    bool subscribed_ = false;
+    // cq thread only
+    bool finished_ = false;
+    bool done_ = false;
+};
+
 class GdtGrpcServer final {
 public:
+    explicit GdtGrpcServer(int cq_nr = 1);
     ~GdtGrpcServer();
     // There is no shutdown handling in this code.
     void run(); 
 
 private:
-    // This can be run in multiple threads if needed.
-    void handle_rpcs();
+    // Each completion queue is served by its own thread
+    void handle_rpcs(grpc::ServerCompletionQueue *cq);
 
-    std::unique_ptr<grpc::ServerCompletionQueue> cq_;
+    int cq_nr_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
     gdt_grpc::SysagentGrpcService::AsyncService service_;
     std::unique_ptr<grpc::Server> server_;
 };
 
+// Call timeouts; deadlines are kept in a min-heap,
+// only expired entries are processed
+class RPCTimer {
+public:
+    RPCTimer() = default;
+    ~RPCTimer();
+    RPCTimer(const RPCTimer &o) = delete;
+    RPCTimer &operator=(const RPCTimer &o) = delete;
+
+    void start(const std::function<void(const mink_utils::Guid &)> &f);
+    void stop();
+    void add(const mink_utils::Guid &guid, uint32_t tmt_msec);
+
+private:
+    using clock_t = std::chrono::steady_clock;
+    using entry_t = std::pair<clock_t::time_point, mink_utils::Guid>;
+    struct EntryCmp {
+        bool operator()(const entry_t &a, const entry_t &b) const {
+            return a.first > b.first;
+        }
+    };
+
+    void run();
+
+    std::priority_queue<entry_t, std::vector<entry_t>, EntryCmp> heap;
+    std::function<void(const mink_utils::Guid &)> on_expire;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::thread th;
+    bool active = false;
+};
+
 
 
 #endif /* ifndef GRPC_GDT_H */
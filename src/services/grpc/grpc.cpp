@@ -10,6 +10,7 @@
 
 #include <getopt.h>
 #include <regex>
+#include <thread>
 #include "grpc.h"
 
 GrpcdDescriptor::GrpcdDescriptor(const char *_type,
@@ -30,6 +31,9 @@ GrpcdDescriptor::GrpcdDescriptor(const char *_type,
     dparams.set_int(2, 1000);
     // --gdt-sparam-pool
     dparams.set_int(3, 5000);
+    // --grpc-cq
+    unsigned int hw_th = std::thread::hardware_concurrency();
+    dparams.set_int(4, (hw_th > 0 ? hw_th : 1));
 }
 
 GrpcdDescriptor::~GrpcdDescriptor(){
@@ -58,11 +62,16 @@ void GrpcdDescriptor::print_help(){
     std::cout
         << " --gdt-stimeout\tGDT Stream timeout in seconds\t\t(default = 5)"
         << std::endl;
+    std::cout << std::endl;
+    std::cout << "gRPC Options:" << std::endl;
+    std::cout << "=============" << std::endl;
+    std::cout << " --grpc-cq		Number of completion queues/threads	(default = CPU count)"
+              << std::endl;
 
 }
 
-int GrpcdDescriptor::init_grpc() const {
-    GdtGrpcServer s;
+int GrpcdDescriptor::init_grpc() {
+    GdtGrpcServer s(dparams.get_pval<int>(4));
     s.run();
     return 0;
 }
@@ -78,6 +87,8 @@ void GrpcdDescriptor::init(){
     mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
                               "Setting correlation pool size to [%d]...",
                                cpool.get_chunk_count());
+    // call timeouts
+    rpc_timer.start([this](const mink_utils::Guid &g) { cmap_expire(g); });
     if(init_grpc()){
         // log
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR, "Cannot start gRPC server");
@@ -92,6 +103,7 @@ void GrpcdDescriptor::process_args(int argc, char **argv){
     int option_index = 0;
     struct option long_options[] = {{"gdt-streams", required_argument, 0, 0},
                                     {"gdt-stimeout", required_argument, 0, 0},
+                                    {"grpc-cq", required_argument, 0, 0},
                                     {0, 0, 0, 0}};
 
     if (argc < 5) {
@@ -117,6 +129,16 @@ void GrpcdDescriptor::process_args(int argc, char **argv){
                 dparams.set_int(1, atoi(optarg));
                 break;
 
+            // grpc-cq
+            case 2:
+                if (atoi(optarg) < 1) {
+                    std::cout << "ERROR: Invalid number of completion queues!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(4, atoi(optarg));
+                break;
+
             default:
                 break;
             }
@@ -247,35 +269,72 @@ void GrpcdDescriptor::terminate(){
 }
 
 
-void GrpcdDescriptor::cmap_process_timeout(){
+void GrpcdDescriptor::cmap_expire(const mink_utils::Guid &guid){
     // lock
     cmap.lock();
-    // current ts
-    time_t now = time(nullptr);
-    // loop
-    for (auto it = cmap.begin(), it_next = it; it != cmap.end();
-         it = it_next) {
-        // next
-        ++it_next;
-
-        // calculate timeout
-        if(now - it->second.ts <= it->second.data_timeout) continue;
-        // payload
-        GrpcPayload *pld = it->second.data;
-        // remove from list
-        cmap.remove(it);
-        // call data pointer
-        RPCBase *c = pld->cdata;
-        // send grpc reply
-        c->status_ = RPCBase::FINISH;
-        c->responder_.Finish(c->reply_, grpc::Status(grpc::ABORTED, ""), c);
-
-        std::cout << "!! TIMEOUT!!: " << c << std::endl;
-        // dealloc
-        cpool.deallocate_constructed(pld);
-
-
+    // already replied
+    GrpcPayload **p = cmap.get(guid);
+    if (!p) {
+        cmap.unlock();
+        return;
+    }
+    // payload
+    GrpcPayload *pld = *p;
+    // streaming call already replied to
+    if (pld->persistent) {
+        cmap.unlock();
+        return;
     }
+    // remove from list
+    cmap.remove(guid);
+
+    // call data pointer
+    RPCBase *c = pld->cdata;
+    // send grpc reply (with cmap locked; streaming
+    // calls can be released concurrently)
+    c->expire();
     // unlock
     cmap.unlock();
+
+    std::cout << "!! TIMEOUT!!: " << c << std::endl;
+    // dealloc
+    cpool.deallocate_constructed(pld);
+}
+
+int GrpcdDescriptor::sub_cancel(const mink_utils::Guid &guid,
+                                const char *dtype,
+                                const char *did){
+    // get new router if connection broken
+    if (!(rtrd_gdtc && rtrd_gdtc->is_registered()))
+        rtrd_gdtc = gdts->get_registered_client("routingd");
+    gdt::GDTClient *gdtc = rtrd_gdtc;
+    if (!gdtc)
+        return 1;
+
+    // allocate new service message
+    gdt::ServiceMessage *msg = gdtsmm->new_smsg();
+    if (!msg)
+        return 1;
+
+    // cancel request, no reply
+    msg->set_service_id(asn1::ServiceId::_sid_sysagent);
+    msg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, guid.data(), 16);
+    msg->vpmap.set_int(asn1::ParameterType::_pt_mink_sub_cancel, 1);
+    msg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type,
+                        get_daemon_type());
+    msg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id,
+                        get_daemon_id());
+
+    // sync vpmap
+    if (gdtsmm->vpmap_sparam_sync(msg, nullptr) != 0) {
+        gdtsmm->free_smsg(msg);
+        return 1;
+    }
+
+    // send service message (pipelined)
+    if (gdtsmm->send_pipelined(msg, gdtc, dtype, did, &ev_srvcm_tx)) {
+        gdtsmm->free_smsg(msg);
+        return 1;
+    }
+    return 0;
 }
@@ -42,6 +42,8 @@ using pmap_t = mink_utils::VariantParamMap<uint32_t>;
 struct GrpcPayload {
     mink_utils::Guid guid;
     RPCBase *cdata;
+    // streaming call, more replies follow
+    bool persistent = false;
 };
 
 // routing daemon descriptor definition
@@ -55,10 +57,13 @@ public:
     void process_args(int argc, char **argv) override;
     void print_help() override;
     void init_gdt();
-    int init_grpc() const;
+    int init_grpc();
     void init();
     void terminate() override;
-    void cmap_process_timeout();
+    void cmap_expire(const mink_utils::Guid &guid);
+    int sub_cancel(const mink_utils::Guid &guid,
+                   const char *dtype,
+                   const char *did);
 
     // config daemons
     std::vector<std::string *> rtrd_lst;
@@ -86,6 +91,8 @@ public:
     mink_utils::CorrelationMap<GrpcPayload*> cmap;
     // grpc payload pool
     memory::Pool<GrpcPayload, true> cpool;
+    // call timeouts
+    RPCTimer rpc_timer;
 
 #ifdef MINK_ENABLE_CONFIGD
     int init_cfg(bool _proc_cfg);
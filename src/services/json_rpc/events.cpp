@@ -13,10 +13,16 @@
 #include <daemon.h>
 #include <atomic.h>
 #include <gdt.pb.enums_only.h>
+#include <string.h>
 #include <zlib.h>
 
 using data_vec_t = std::vector<uint8_t>;
 
+// unknown param name
+static const std::string NA_PNAME = "n/a";
+// max size of legacy inflated param
+static const std::size_t LEGACY_ZLIB_MAX = 64 * 1024 * 1024;
+
 #ifdef MINK_ENABLE_CONFIGD
 EVHbeatMissed::EVHbeatMissed(mink::Atomic<uint8_t> *_activity_flag): activity_flag(_activity_flag) {}
 
@@ -58,7 +64,10 @@ void EVHbeatCleanup::run(gdt::GDTCallbackArgs *args) {
 
 static void handle_error(const mink_utils::VariantParam *vp_err,
                          int id,
-                         std::shared_ptr<WebSocketBase> &ws){
+                         std::shared_ptr<WebSocketBase> &ws,
+                         const std::shared_ptr<JrpcAggregate> &agg,
+                         std::size_t agg_idx,
+                         bool req_done){
     int ec = mink::error::EC_UNKNOWN;
     try {
         if (vp_err)
@@ -67,64 +76,68 @@ static void handle_error(const mink_utils::VariantParam *vp_err,
         // nothing for now
     }
     // create json rpc reply
-    std::string ws_rpl = json_rpc::JsonRpc::gen_err(ec, id).dump();
+    json j_err = json_rpc::JsonRpc::gen_err(ec, id);
+    // aggregated reply part (batch or fan-out)
+    if (agg) {
+        ws->async_agg_send(std::move(j_err), agg, agg_idx, req_done);
+        return;
+    }
+    std::string ws_rpl = json_rpc::encode(j_err, ws->get_encoding());
     //beast::flat_buffer &b = ws->get_buffer();
     //std::size_t sz = net::buffer_copy(b.prepare(ws_rpl.size()),
     //                                            net::buffer(ws_rpl));
 
     // send json rpc reply
     //b.commit(sz);
-    ws->async_buffer_send(ws_rpl);
+    ws->async_buffer_send(std::move(ws_rpl), req_done);
     //ws->get_stream().async_write(b.data(),
     //                             beast::bind_front_handler(&WebSocketBase::on_write,
     //                                                       ws));
 
 }
 
-static std::string sparam_zlib_decmpress(const uint8_t *data, 
-                                         const std::size_t sz,
-                                         char *out_buff, 
-                                         const std::size_t out_buf_sz){
-    // output string
-    std::string s;
-    // decompress
+// legacy sysagentd (without GDT compression caps)
+// compresses params in plugins; remove in next release
+static bool sparam_zlib_decmpress(const uint8_t *data,
+                                  const std::size_t sz,
+                                  std::string &out){
+    // zlib header (deflate, header checksum)
+    if (sz < 6 || (data[0] & 0x0f) != Z_DEFLATED ||
+        ((data[0] << 8) | data[1]) % 31 != 0)
+        return false;
+
     z_stream zs;
     zs.zalloc = Z_NULL;
     zs.zfree = Z_NULL;
     zs.opaque = Z_NULL;
-    // input size
     zs.avail_in = sz;
-    // input data
-    zs.next_in = (Bytef *)data;
-    zs.avail_out = out_buf_sz;
-    zs.next_out = (Bytef *)out_buff;
-    // init decompress struct
-    int z_res = inflateInit(&zs);
-    if(z_res != Z_OK){
-        // cleanup
-        delete data;
-    }
+    zs.next_in = const_cast<Bytef *>(data);
+    if (inflateInit(&zs) != Z_OK)
+        return false;
+
     // decompress
+    std::string s;
+    char buff[16384];
+    int z_res;
     do {
-        // inflate and flush to buffer
-        z_res = inflate(&zs, Z_SYNC_FLUSH);
-        // error
-        if (z_res < 0 && z_res != Z_BUF_ERROR)
+        zs.avail_out = sizeof(buff);
+        zs.next_out = reinterpret_cast<Bytef *>(buff);
+        z_res = inflate(&zs, Z_NO_FLUSH);
+        // error or truncated input
+        if (z_res != Z_OK && z_res != Z_STREAM_END)
+            break;
+        s.append(buff, sizeof(buff) - zs.avail_out);
+        if (s.size() > LEGACY_ZLIB_MAX)
             break;
-
-        //  append uncompressed data
-        s.append(out_buff, out_buf_sz - zs.avail_out);
-        // update zlib struct
-        if (zs.avail_out == 0) {
-            zs.avail_out = out_buf_sz;
-            zs.next_out = (Bytef *)out_buff;
-        }
     } while (z_res != Z_STREAM_END);
 
     // zlib cleanup
     inflateEnd(&zs);
-    // res
-    return s;
+    // not a complete zlib stream, keep raw data
+    if (z_res != Z_STREAM_END || zs.avail_in != 0)
+        return false;
+    out.swap(s);
+    return true;
 }
 
 void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
@@ -172,17 +185,27 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     // error check
     const mink_utils::VariantParam *vp_err = smsg->vpget(asn1::ParameterType::_pt_mink_error);
 
+    // subscription dropped by source (final push)
+    const mink_utils::VariantParam *vp_cancel = smsg->vpget(asn1::ParameterType::_pt_mink_sub_cancel);
+
     // correlate guid
-    dd->cmap.lock();
     mink_utils::Guid guid;
     guid.set(static_cast<uint8_t *>((unsigned char *)*vp_guid));
-    JrpcPayload *pld = dd->cmap.get(guid);
+    auto &cmap = dd->get_cmap(guid);
+    cmap.lock();
+    JrpcPayload *pld = cmap.get(guid);
     if(!pld){
-        dd->cmap.unlock();
+        cmap.unlock();
+        // stale subscription (unsubscribed or session
+        // closed), stop the source from pushing more
+        if (vp_p_guid && !vp_cancel)
+            dd->sub_cancel(guid,
+                           static_cast<char *>(*vp_src_type),
+                           static_cast<char *>(*vp_src_id));
         return;
     }
     // set as persistent (if requested)
-    if (vp_p_guid)
+    if (vp_p_guid && !vp_cancel)
         pld->persistent = true;
     else
         pld->persistent = false;
@@ -195,48 +218,84 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     std::shared_ptr<WebSocketBase> ws = pld->cdata.lock();
     // check is session has expired
     if(ws.get() == nullptr){
-        dd->cmap.remove(guid);
-        dd->cmap.unlock();
+        cmap.remove(guid);
+        cmap.unlock();
+        if (vp_p_guid && !vp_cancel)
+            dd->sub_cancel(guid,
+                           static_cast<char *>(*vp_src_type),
+                           static_cast<char *>(*vp_src_id));
         return;
     }
 
-    // generate empty json rpc reply
-    auto j = json_rpc::JsonRpc::gen_response(id);
+    // first reply completes the request (persistent
+    // correlations can receive more replies)
+    bool req_done = pld->inflight;
+    pld->inflight = false;
+    // aggregated reply (batch or fan-out)
+    std::shared_ptr<JrpcAggregate> agg = pld->agg;
+    std::size_t agg_idx = pld->agg_idx;
+
     // update ts
-    dd->cmap.update_ts(guid);
-    if(!pld->persistent) dd->cmap.remove(guid);
+    cmap.update_ts(guid);
+    if(!pld->persistent) cmap.remove(guid);
     // unlock
-    dd->cmap.unlock();
+    cmap.unlock();
+
 
+    // subscription dropped, forget it on session strand
+    if (vp_cancel)
+        ws->async_sub_drop(id, guid);
 
     // if error found
-    if(vp_err){
-        handle_error(vp_err, id, ws);
+    if(vp_err || vp_cancel){
+        handle_error(vp_err, id, ws, agg, agg_idx, req_done);
         return;
     }
 
-    // create result object
-    j[json_rpc::JsonRpc::RESULT_] = json::array();
-    auto &j_params = j.at(json_rpc::JsonRpc::RESULT_);
-    // tmp val string
-    std::string val;
-
     // remove auth params and guid
     smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_id);
     smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_password);
     smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_guid);
 
+    // aggregated replies are merged as json on session
+    // strand, others are serialized directly into the
+    // reply buffer
+    json j;
+    std::string ws_rpl = ws->get_wbuf();
+    json_rpc::JsonRpcWriter jw(ws_rpl, ws->get_encoding());
+    if (agg) {
+        j = json_rpc::JsonRpc::gen_response(id);
+        j[json_rpc::JsonRpc::RESULT_] = json::array();
+    } else
+        jw.begin_result(id);
+
+    // add result item
+    auto add_item = [&](const std::string &pname, const char *d, std::size_t sz, int idx) {
+        if (agg) {
+            auto o = json::object();
+            o["idx"] = idx;
+            o[pname] = std::string(d, sz);
+            j.at(json_rpc::JsonRpc::RESULT_).push_back(o);
+        } else
+            jw.add_item(pname, d, sz, idx);
+    };
+    // add binary result item (legacy compressed)
+    std::string z_out;
+    auto add_bin_item = [&](const std::string &pname, const uint8_t *d, std::size_t sz, int idx) {
+        if (sparam_zlib_decmpress(d, sz, z_out))
+            add_item(pname, z_out.data(), z_out.size(), idx);
+        else
+            add_item(pname, reinterpret_cast<const char *>(d), sz, idx);
+    };
+
     // loop GDT params
     mink_utils::PooledVPMap<uint32_t>::it_t it = smsg->vpmap.get_begin();
 
-    // zlib out buffer
-    char z_out_buff[65535];
-
     // loop param map
     for(; it != smsg->vpmap.get_end(); it++){
         // param name from ID
         auto itt = gdt_grpc::SysagentParamMap.find(it->first.key);
-        const std::string pname = (itt != gdt_grpc::SysagentParamMap.cend() ? itt->second : "n/a");
+        const std::string &pname = (itt != gdt_grpc::SysagentParamMap.cend() ? itt->second : NA_PNAME);
         // get param type
         const int pt = it->second.get_type();
 
@@ -244,21 +303,12 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
         if(pt == mink_utils::DPT_POINTER){
             auto data = static_cast<data_vec_t *>((void *)it->second);
             try {
-                // output string
-                std::string s = sparam_zlib_decmpress(data->data(),
-                                                      data->size(),
-                                                      z_out_buff,
-                                                      sizeof(z_out_buff));
-                // compressed/uncompressed
-                if (s.empty()) {
-                    s.assign(reinterpret_cast<char *>(data->data()), data->size());
-                }
-                // new json object
-                auto o = json::object();
-                o[pname] = s;
-                o["idx"] = it->first.index;
-                // new json rpc param object
-                j_params.push_back(o);
+                // output string (inflated by GDT layer
+                // or legacy zlib)
+                add_bin_item(pname,
+                             data->data(),
+                             data->size(),
+                             it->first.index);
 
             } catch (std::exception &e) {
                 mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
@@ -274,62 +324,40 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
 
         // short STRING
         if (pt == mink_utils::DPT_STRING) {
-            val = static_cast<char *>(it->second);
+            const char *val = static_cast<char *>(it->second);
+            add_item(pname, val, strlen(val), it->first.index);
 
         // STRING as OCTETES (check if printable)
         } else if (pt == mink_utils::DPT_OCTETS) {
             // sparam data
             unsigned char *od = static_cast<unsigned char *>(it->second);
-            // output string
-            val = sparam_zlib_decmpress(od,
-                                        it->second.get_size(),
-                                        z_out_buff,
-                                        sizeof(z_out_buff));
-            
-            // compressed/uncompressed
-            if (val.empty()) {
-                val.assign(reinterpret_cast<char *>(od), it->second.get_size());
-            }
-
-        // ignore other types
-        } else continue;
-
-        // setup json object
-        auto o = json::object();
-        o["idx"] = it->first.index;
-        o[pname] = val;
-        // new json rpc param object
-        j_params.push_back(o);
+            add_bin_item(pname,
+                         od,
+                         it->second.get_size(),
+                         it->first.index);
+        }
     }
 
-    // verfify json
-    try {
-        std::string ws_rpl = j.dump();
-        //std::unique_lock<std::mutex> l(ws->get_mtx());
-        //beast::flat_buffer &b = ws->get_buffer();
-        //std::size_t sz = net::buffer_copy(b.prepare(ws_rpl.size()),
-        //                                  net::buffer(ws_rpl));
-
-        // send json rpc reply (success)
-        //b.commit(sz);
-        //l.unlock();
-        ws->async_buffer_send(ws_rpl);
+    // request latency
+    int lat = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(ts_now - ts_req).count());
+
+    // aggregated reply part, sent when complete
+    if (agg) {
+        ws->async_agg_send(std::move(j), agg, agg_idx, req_done);
         mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
-                                  "JSON RPC received for id = [%d], latency = [%d msec]",
+                                  "JSON RPC part received for id = [%d], latency = [%d msec]",
                                   id,
-                                  std::chrono::duration_cast<std::chrono::milliseconds>(ts_now - ts_req));
-
-        //ws->get_stream().async_write(b.data(),
-        //                             beast::bind_front_handler(&WebSocketBase::on_write,
-        //                                                       ws));
-    } catch (std::exception &e) {
-        mink::CURRENT_DAEMON->log(mink::LLT_ERROR, 
-                                  "JSON RPC error: [%s]",
-                                  e.what());
-
-        // send error
-        handle_error(nullptr, id, ws);
+                                  lat);
+        return;
     }
+
+    // send json rpc reply (success)
+    jw.end_result();
+    ws->async_buffer_send(std::move(ws_rpl), req_done);
+    mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                              "JSON RPC received for id = [%d], latency = [%d msec]",
+                              id,
+                              lat);
 }
 
 void EVParamStreamLast::run(gdt::GDTCallbackArgs *args){
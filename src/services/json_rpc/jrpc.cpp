@@ -10,6 +10,7 @@
 #include <getopt.h>
 #include <regex>
 #include <iostream>
+#include <thread>
 #include "ws_server.h"
 #include "jrpc.h"
 #include <json_rpc.h>
@@ -45,6 +46,13 @@ JsonRpcdDescriptor::JsonRpcdDescriptor(const char *_type,
     // -t
     dparams.set_int(6, 3);
     dparams.set_int(7, 15);
+    // --ws-threads
+    unsigned int hw_th = std::thread::hardware_concurrency();
+    dparams.set_int(8, (hw_th > 0 ? hw_th : 1));
+    // --ws-max-inflight
+    dparams.set_int(9, 32);
+    // --ws-deflate
+    dparams.set_int(10, 0);
 }
 
 JsonRpcdDescriptor::~JsonRpcdDescriptor(){
@@ -61,6 +69,9 @@ void JsonRpcdDescriptor::process_args(int argc, char **argv){
                                     {"gdt-stimeout", required_argument, 0, 0},
                                     {"gdt-smsg-pool", required_argument, 0, 0},
                                     {"gdt-sparam-pool", required_argument, 0, 0},
+                                    {"ws-threads", required_argument, 0, 0},
+                                    {"ws-max-inflight", required_argument, 0, 0},
+                                    {"ws-deflate", required_argument, 0, 0},
                                     {0, 0, 0, 0}};
 
     if (argc < 5) {
@@ -96,6 +107,36 @@ void JsonRpcdDescriptor::process_args(int argc, char **argv){
                 dparams.set_int(3, atoi(optarg));
                 break;
 
+            // ws-threads
+            case 4:
+                if (atoi(optarg) < 1) {
+                    std::cout << "ERROR: Invalid number of WebSocket threads!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(8, atoi(optarg));
+                break;
+
+            // ws-max-inflight
+            case 5:
+                if (atoi(optarg) < 1) {
+                    std::cout << "ERROR: Invalid number of outstanding requests!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(9, atoi(optarg));
+                break;
+
+            // ws-deflate
+            case 6:
+                if (atoi(optarg) < 0 || atoi(optarg) > 9) {
+                    std::cout << "ERROR: Invalid compression level!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(10, atoi(optarg));
+                break;
+
             default:
                 break;
             }
@@ -285,6 +326,15 @@ void JsonRpcdDescriptor::print_help(){
               << std::endl;
     std::cout << " --gdt-sparam-pool GDT Service message parameter pool (default = 5000)"
               << std::endl;
+    std::cout << std::endl;
+    std::cout << "WebSocket Options:" << std::endl;
+    std::cout << "==================" << std::endl;
+    std::cout << " --ws-threads      Number of WebSocket I/O threads    (default = CPU count)"
+              << std::endl;
+    std::cout << " --ws-max-inflight Max outstanding requests/session   (default = 32)"
+              << std::endl;
+    std::cout << " --ws-deflate      permessage-deflate level (1-9)     (default = 0, off)"
+              << std::endl;
 }
 
 static void rtrds_connect(JsonRpcdDescriptor *d){
@@ -394,7 +444,7 @@ static void load_wss_certs(boost::asio::ssl::context &ctx,
 void JsonRpcdDescriptor::init_wss(const std::string &ws_addr){
     try{
         auto const addr = net::ip::make_address(ws_addr.substr(0, ws_addr.find(":")));
-        auto const th_nr = 1;
+        auto const th_nr = dparams.get_pval<int>(8);
         auto const droot = std::make_shared<std::string>("/");
         // get port
         uint16_t port = std::stoi(ws_addr.substr(ws_addr.find(":") + 1));
@@ -413,12 +463,6 @@ void JsonRpcdDescriptor::init_wss(const std::string &ws_addr){
                                    ctx,
                                    tcp::endpoint{addr, port},
                                    droot)->run();
-        // Run the I/O service on the requested number of threads
-        //std::vector<std::thread> v;
-        //v.reserve(th_nr);
-        //for (auto i = th_nr- 1; i > 0; --i)
-        //    v.emplace_back([&ioc] { ioc.run(); });
-
         // Construct a signal set registered for process termination.
         boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
 
@@ -427,7 +471,21 @@ void JsonRpcdDescriptor::init_wss(const std::string &ws_addr){
             ioc.stop();
         });
 
+        // Run the I/O service on the requested number of threads
+        // (each session is bound to its own strand)
+        std::vector<std::thread> v;
+        v.reserve(th_nr - 1);
+        for (auto i = th_nr - 1; i > 0; --i)
+            v.emplace_back([&ioc] { ioc.run(); });
+
+        mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                                  "Starting WebSocket server with [%d] I/O threads",
+                                  th_nr);
         ioc.run();
+
+        // wait for I/O threads
+        for (auto &t : v)
+            t.join();
     } catch (std::exception &e) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
                                   "Cannot create web socket listener: %s",
@@ -438,6 +496,49 @@ void JsonRpcdDescriptor::init_wss(const std::string &ws_addr){
     DaemonDescriptor::DAEMON_TERMINATED = true;
 }
 
+mink_utils::CorrelationMap<JrpcPayload> &JsonRpcdDescriptor::get_cmap(const mink_utils::Guid &guid){
+    // guids are random, first byte is good enough
+    return cmap_shards[guid.data()[0] % cmap_shards.size()];
+}
+
+int JsonRpcdDescriptor::sub_cancel(const mink_utils::Guid &guid,
+                                   const char *dtype,
+                                   const char *did){
+    // get new router if connection broken
+    if (!(rtrd_gdtc && rtrd_gdtc->is_registered()))
+        rtrd_gdtc = gdts->get_registered_client("routingd");
+    gdt::GDTClient *gdtc = rtrd_gdtc;
+    if (!gdtc)
+        return 1;
+
+    // allocate new service message
+    gdt::ServiceMessage *msg = gdtsmm->new_smsg();
+    if (!msg)
+        return 1;
+
+    // cancel request, no reply
+    msg->set_service_id(asn1::ServiceId::_sid_sysagent);
+    msg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, guid.data(), 16);
+    msg->vpmap.set_int(asn1::ParameterType::_pt_mink_sub_cancel, 1);
+    msg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type,
+                        get_daemon_type());
+    msg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id,
+                        get_daemon_id());
+
+    // sync vpmap
+    if (gdtsmm->vpmap_sparam_sync(msg, nullptr) != 0) {
+        gdtsmm->free_smsg(msg);
+        return 1;
+    }
+
+    // send service message (pipelined)
+    if (gdtsmm->send_pipelined(msg, gdtc, dtype, did, &ev_srvcm_tx)) {
+        gdtsmm->free_smsg(msg);
+        return 1;
+    }
+    return 0;
+}
+
 #ifdef MINK_ENABLE_CONFIGD
 int JsonRpcdDescriptor::init_cfg(bool _proc_cfg) const {
     // reserved
@@ -13,6 +13,7 @@
 
 #include <mink_pkg_config.h>
 #include <sstream>
+#include <array>
 #include <atomic.h>
 #include <daemon.h>
 #ifdef MINK_ENABLE_CONFIGD
@@ -25,6 +26,7 @@
 #include <gdt_utils.h>
 #include <gdt_stats.h>
 #include <mink_sqlite.h>
+#include <json_rpc.h>
 
 /*******************************/
 /* daemon name and description */
@@ -41,6 +43,27 @@ using pmap_t = mink_utils::VariantParamMap<uint32_t>;
 
 class WebSocketBase;
 
+/**************************************************/
+/* aggregated json rpc reply (batch or fan-out);  */
+/* accessed from session strand only              */
+/**************************************************/
+struct JrpcAggregate {
+    // batch = array of responses, fan-out = one
+    // response with a result entry per target
+    bool batch = false;
+    // fan-out request id
+    int id = 0;
+    // fan-out destination ids
+    std::vector<std::string> targets;
+    // reply parts
+    std::vector<json> replies;
+    // parts not yet received
+    std::size_t pending = 0;
+    // fan-out request inside a batch
+    std::shared_ptr<JrpcAggregate> parent;
+    std::size_t parent_idx = 0;
+};
+
 /**********************************/
 /* json rpc payload (correlation) */
 /**********************************/
@@ -49,9 +72,23 @@ struct JrpcPayload {
     std::weak_ptr<WebSocketBase> cdata;
     int id;
     bool persistent = false;
+    // counted in session's outstanding requests
+    bool inflight = true;
+    // aggregated reply (batch or fan-out)
+    std::shared_ptr<JrpcAggregate> agg;
+    std::size_t agg_idx = 0;
     std::chrono::time_point<std::chrono::system_clock> ts;
 };
 
+/**************************************************/
+/* subscription (periodic replies from sysagentd) */
+/**************************************************/
+struct JrpcSubscription {
+    mink_utils::Guid guid;
+    std::string dtype;
+    std::string did;
+};
+
 /********************************/
 /* daemon descriptor definition */
 /********************************/
@@ -68,6 +105,10 @@ public:
     void init_wss(const std::string &ws_addr);
     void init();
     void terminate() override;
+    mink_utils::CorrelationMap<JrpcPayload> &get_cmap(const mink_utils::Guid &guid);
+    int sub_cancel(const mink_utils::Guid &guid,
+                   const char *dtype,
+                   const char *did);
 
     // config daemons
     std::vector<std::string> rtrd_lst;
@@ -91,8 +132,9 @@ public:
     std::string ws_addr;
     // local IP
     std::string local_ip;
-    // correlation map
-    mink_utils::CorrelationMap<JrpcPayload> cmap;
+    // correlation map shards (selected by guid, io threads and
+    // GDT threads rarely compete for the same lock)
+    std::array<mink_utils::CorrelationMap<JrpcPayload>, 16> cmap_shards;
     // db manager
     mink_db::SqliteManager dbm;
     // certifcates
@@ -32,36 +32,49 @@ usr_info_t UserList::exists(const std::string &u){
     return std::make_tuple("", 0, nullptr, 0);
 }
 
-UserBanInfo *UserList::add_attempt(const std::string &u){
+bool UserList::auth_failed(const std::string &u,
+                           const uint64_t now_msec,
+                           const int max_attempts,
+                           const uint64_t ban_msec){
     std::unique_lock<std::mutex> lock(m);
     auto it = ban_lst.find(u);
     // add new user
     if(it == ban_lst.end()){
-        // get unix timestamp (part of user tuple)
-        auto ts_now = stdc::system_clock::now().time_since_epoch();
-        uint64_t ts_msec = stdc::duration_cast<stdc::milliseconds>(ts_now).count();
-        ban_lst.emplace(u, UserBanInfo{u, 1, ts_msec, false});
-
-    // user exists
-    } else {
-        ++it->second.attemtps;
+        it = ban_lst.emplace(u, UserBanInfo{u, 0, now_msec, 0, false}).first;
+    }
+    UserBanInfo &bi = it->second;
+
+    // check if banned
+    if (bi.banned) {
+        // ban can be lifted, start counting again
+        if (bi.ts_banned_until <= now_msec) {
+            ban_lst.erase(it);
+            ban_lst.emplace(u, UserBanInfo{u, 1, now_msec, 0, false});
+            return false;
+        }
+        return true;
     }
-    return &ban_lst.find(u)->second;
-}
 
-UserBanInfo *UserList::get_banned(const std::string &u){
-    std::unique_lock<std::mutex> lock(m);
-    auto it = ban_lst.find(u);
-    if(it != ban_lst.end()){
-        m.unlock();
-        return &it->second;
+    // check if ban needs to be set
+    if (++bi.attemtps >= max_attempts) {
+        bi.banned = true;
+        bi.ts_banned_until = now_msec + ban_msec;
+        return true;
     }
-    return nullptr;
+    return false;
 }
 
-void UserList::lift_ban(const std::string &u){
+bool UserList::is_banned(const std::string &u, const uint64_t now_msec){
     std::unique_lock<std::mutex> lock(m);
-    ban_lst.erase(u);
+    auto it = ban_lst.find(u);
+    if (it == ban_lst.end())
+        return false;
+    // ban can't be lifted just yet
+    if (it->second.banned && it->second.ts_banned_until > now_msec)
+        return true;
+    // lift ban, reset attempts
+    ban_lst.erase(it);
+    return false;
 }
 
 bool UserList::add(const usr_info_t &u){
@@ -247,6 +260,14 @@ std::tuple<int, std::string, std::string, int, int> user_auth_jrpc(const std::st
                            std::get<2>(c));
 }
 
+net::thread_pool &get_auth_pool(){
+    // created on first use (after daemonizing); sqlite
+    // connection is opened in FULLMUTEX mode, two threads
+    // are enough to keep io threads free
+    static net::thread_pool pool(2);
+    return pool;
+}
+
 bool user_auth_prepare(boost::string_view &auth_str, int type){
     // Header
     if(type == 0){
@@ -17,6 +17,9 @@
 #include <boost/beast/ssl.hpp>
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/asio/buffers_iterator.hpp>
 #include <boost/optional.hpp>
 #include <boost/beast/core/detail/base64.hpp>
@@ -34,6 +37,8 @@
 #include "jrpc.h"
 #include <gdt.pb.enums_only.h>
 #include <vector>
+#include <map>
+#include <netinet/tcp.h>
 
 
 // boost beast/asio
@@ -96,6 +101,12 @@ void fail(beast::error_code ec, char const *what);
 //bool user_auth_prepare(boost::string_view &auth_str, int type);
 //std::tuple<std::string, std::string, bool, int> user_auth(boost::string_view &auth_hdr);
 std::tuple<int, std::string, std::string, int, int> user_auth_jrpc(const std::string &crdt);
+net::thread_pool &get_auth_pool();
+
+// skip building debug log strings if not needed
+inline bool log_debug(){
+    return mink::CURRENT_DAEMON->get_log_level() >= mink::LLT_DEBUG;
+}
 
 /*******************************/
 /* List of authenticated users */
@@ -117,9 +128,11 @@ public:
 
     usr_info_t exists(const std::string &u);
     bool add(const usr_info_t &u);
-    UserBanInfo *add_attempt(const std::string &u);
-    UserBanInfo *get_banned(const std::string &u);
-    void lift_ban(const std::string &u);
+    bool auth_failed(const std::string &u,
+                     const uint64_t now_msec,
+                     const int max_attempts,
+                     const uint64_t ban_msec);
+    bool is_banned(const std::string &u, const uint64_t now_msec);
     void remove(const std::string &u, const uint64_t &ts);
     void remove_all();
     void process_all(const std::function<void(const usr_info_t &)> &f);
@@ -152,11 +165,19 @@ public:
 
 #endif
     virtual beast::flat_buffer &get_buffer() = 0;
-    virtual std::mutex &get_mtx() = 0;
-    virtual void async_buffer_send(const std::string &d) = 0;
+    virtual void async_buffer_send(std::string d, bool req_done = false) = 0;
+    virtual std::string get_wbuf() = 0;
+    virtual void async_agg_send(json &&j,
+                                const std::shared_ptr<JrpcAggregate> &agg,
+                                std::size_t agg_idx,
+                                bool req_done) = 0;
+    virtual void async_sub_drop(int id, const mink_utils::Guid &g) = 0;
     virtual void do_close() = 0;
+    // payload encoding (negotiated on accept)
+    json_rpc::Encoding get_encoding() const { return enc_; }
 
     usr_info_t usr_info_;
+    json_rpc::Encoding enc_ = json_rpc::ENC_JSON;
 };
 
 /**********************************/
@@ -166,7 +187,25 @@ public:
 template <class Derived>
 class WebSocketSession : public WebSocketBase {
 public:
-    WebSocketSession(): reading_{false} {}
+    WebSocketSession(): reading_{false} {
+        auto dd = static_cast<JsonRpcdDescriptor*>(mink::CURRENT_DAEMON);
+        max_inflight_ = dd->dparams.get_pval<int>(9);
+        deflate_lvl_ = dd->dparams.get_pval<int>(10);
+    }
+
+    // stop subscriptions of closed session
+    ~WebSocketSession(){
+        auto dd = static_cast<JsonRpcdDescriptor*>(mink::CURRENT_DAEMON);
+        for (auto &sub : subs_) {
+            auto &cmap = dd->get_cmap(sub.second.guid);
+            cmap.lock();
+            cmap.remove(sub.second.guid);
+            cmap.unlock();
+            dd->sub_cancel(sub.second.guid,
+                           sub.second.dtype.c_str(),
+                           (sub.second.did.empty() ? nullptr : sub.second.did.c_str()));
+        }
+    }
 
     // Access the derived class
     Derived &derived(){
@@ -182,11 +221,49 @@ public:
         // set nax nessage size
         derived().ws().read_message_max(0);
 
+        // one frame per message; uncompressed payload is
+        // written directly from reply buffer (no copy, single
+        // gather write)
+        derived().ws().auto_fragment(false);
+
+        // permessage-deflate (context takeover is kept, previous
+        // messages are used as dictionary for the next one)
+        if (deflate_lvl_ > 0) {
+            websocket::permessage_deflate pmd;
+            pmd.server_enable = true;
+            pmd.compLevel = deflate_lvl_;
+            derived().ws().set_option(pmd);
+            // compressed output goes through write buffer
+            derived().ws().write_buffer_bytes(WS_WBUF_SIZE);
+        }
+
+        // binary encoding requested by client (subprotocol)
+        enc_ = json_rpc::ENC_JSON;
+        boost::string_view sp = req[http::field::sec_websocket_protocol];
+        while (!sp.empty()) {
+            std::size_t n = sp.find(',');
+            boost::string_view t = sp.substr(0, n);
+            // trim
+            while (!t.empty() && t.front() == ' ') t.remove_prefix(1);
+            while (!t.empty() && t.back() == ' ') t.remove_suffix(1);
+            if (t == json_rpc::CBOR_SUBPROTOCOL) {
+                enc_ = json_rpc::ENC_CBOR;
+                break;
+            }
+            if (n == boost::string_view::npos)
+                break;
+            sp.remove_prefix(n + 1);
+        }
+        const bool cbor = (enc_ == json_rpc::ENC_CBOR);
+
         // Set a decorator to change the Server of the handshake
-        derived().ws().set_option(websocket::stream_base::decorator([](websocket::response_type &res) {
+        derived().ws().set_option(websocket::stream_base::decorator([cbor](websocket::response_type &res) {
             res.set(http::field::server,
                     std::string(BOOST_BEAST_VERSION_STRING) +
                     " mink-ws");
+            if (cbor)
+                res.set(http::field::sec_websocket_protocol,
+                        json_rpc::CBOR_SUBPROTOCOL);
             }));
 
         // Accept the websocket handshake
@@ -205,6 +282,10 @@ public:
         // reading in progress, skip
         if(reading_.load()) return;
 
+        // too many outstanding requests, reading is
+        // resumed in request_done
+        if(inflight_ >= max_inflight_) return;
+
         // reading started
         reading_.store(true);
 
@@ -214,23 +295,40 @@ public:
                                                             derived().shared_from_this()));
     }
 
+    // q_ is only accessed from the session strand
     void do_write(){
-        std::unique_lock<std::mutex> l(mtx_);
         if(q_state != SENDING && !q_.empty()){
             q_state = SENDING;
+            // more replies queued; hold partial segments
+            // until queue is drained
+            if (q_.size() > 1 && !corked_)
+                set_cork(true);
             derived().ws().async_write(net::buffer(q_.front()),
                                        beast::bind_front_handler(&WebSocketSession::on_write,
                                                                  derived().shared_from_this()));
         }
     }
 
-    void send_buff(const std::string &d){
-        std::unique_lock<std::mutex> l(mtx_);
-        q_.push_back(d);
-        l.unlock();
+    // coalesce queued replies into full TCP segments
+    void set_cork(bool on){
+        int v = on;
+        auto &sock = beast::get_lowest_layer(derived().ws()).socket();
+        if (setsockopt(sock.native_handle(), IPPROTO_TCP, TCP_CORK, &v, sizeof(v)) == 0)
+            corked_ = on;
+    }
+
+    void send_buff(std::string d){
+        q_.push_back(std::move(d));
         do_write();
     }
 
+    // GDT request completed (reply or timeout)
+    void request_done(){
+        if (inflight_ > 0)
+            --inflight_;
+        do_read();
+    }
+
     // Implementation of "firmware_update" command
     int impl_firmware_update(const json_rpc::JsonRpc &jrpc){
         using namespace gdt_grpc;
@@ -275,331 +373,547 @@ public:
         if (ec)
             return fail(ec, "WebSocketSession::read");
 
-        // accept only text data
-        if (!derived().ws().got_text()){
+        // accept only text data (binary if CBOR was negotiated)
+        if (derived().ws().got_text() != (enc_ == json_rpc::ENC_JSON)){
             // close ws session (code 1000)
             derived().ws().async_close({websocket::close_code::normal},
                                        [](beast::error_code) {});
             return;
         }
 
-        // parse
-        std::string rpc_data(net::buffers_begin(buffer_.data()),
-                             net::buffers_end(buffer_.data()));
-        json j = json::parse(rpc_data, nullptr, false);
+        // parse (in place, flat buffer is contiguous)
+        const char *rpc_data = static_cast<const char *>(buffer_.data().data());
+        const std::size_t rpc_sz = buffer_.size();
+        json j = json_rpc::decode(rpc_data, rpc_sz, enc_);
+
+        // malformed (log before buffer is released)
+        if (j.is_discarded() && enc_ == json_rpc::ENC_JSON && log_debug())
+            mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                                      "JSON RPC malformed = %s",
+                                      std::string(rpc_data, rpc_sz).c_str());
 
-        // text reply
-        derived().ws().text(true);
+        // text or binary reply
+        derived().ws().text(enc_ == json_rpc::ENC_JSON);
         // clear buffer
         buffer_.consume(buffer_.size());
-        // reply data
-        std::string ws_rpl;
 
         // validate json
         if (j.is_discarded()){
-            ws_rpl = Jrpc::gen_err(mink::error::EC_JSON_MALFORMED).dump();
-            //sz = net::buffer_copy(buffer_.prepare(ws_rpl.size()),
-            //                      net::buffer(ws_rpl));
+            send_buff(json_rpc::encode(Jrpc::gen_err(mink::error::EC_JSON_MALFORMED), enc_));
+
+        // batch request
+        }else if (j.is_array()){
+            handle_batch(j);
+
+        // single request (reading is resumed in
+        // on_auth if credentials are being verified)
+        }else if (handle_request(j, nullptr, 0)){
+            return;
+        }
+
+        // another read
+        reading_.store(false);
+        do_read();
+
+    }
+
+    // JSON-RPC 2.0 batch; one reply array is sent
+    // when all requests have been answered
+    void handle_batch(const json &j){
+        // empty batch
+        if (j.empty()) {
+            std::string ws_rpl = json_rpc::encode(Jrpc::gen_err(mink::error::EC_JSON_MALFORMED), enc_);
+            send_buff(ws_rpl);
+            return;
+        }
+
+        // bounded (each element can start a GDT request)
+        if (j.size() > MAX_BATCH) {
+            std::string ws_rpl = json_rpc::encode(Jrpc::gen_err(mink::error::EC_BUSY,
+                                                                "MINK: batch too large"),
+                                                  enc_);
             send_buff(ws_rpl);
-            mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
-                                      "JSON RPC malformed = %s",
-                                      rpc_data.c_str());
-            reading_.store(false);
-            do_read();
             return;
+        }
+
+        auto agg = std::make_shared<JrpcAggregate>();
+        agg->batch = true;
+        agg->replies.resize(j.size());
+        agg->pending = j.size();
+
+        std::size_t idx = 0;
+        for (const auto &r : j)
+            handle_request(r, agg, idx++);
+    }
 
-        }else{
-            // create json rpc parser
-            Jrpc jrpc(j);
-            // request id
-            int id = 0;
-            // request timeout
-            int req_tmt = 2000;
-            // daemon
-            auto dd = static_cast<JsonRpcdDescriptor*>(mink::CURRENT_DAEMON);
-            // verify if json is a valid json rpc data
-            try {
-                jrpc.verify(true);
+    // Handle single request; reply is sent directly or
+    // added to aggregated reply (agg != nullptr).
+    // Returns true if reading must stay paused.
+    bool handle_request(const json &j,
+                        const std::shared_ptr<JrpcAggregate> &agg,
+                        const std::size_t agg_idx){
+        // create json rpc parser
+        Jrpc jrpc(j);
+        // request id
+        int id = 0;
+        // request timeout
+        int req_tmt = 2000;
+        // error reply
+        json j_rpl;
+        // verify if json is a valid json rpc data
+        try {
+            jrpc.verify(true);
+            if (log_debug())
                 mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
                                           "JSON RPC received = %s",
                                           j.dump().c_str());
-                id = jrpc.get_id();
-                req_tmt = jrpc.get_mink_timeout();
-                // check if method is supported
-                if(jrpc.get_method_id() > -1){
-                    // auth check
-                    if (!auth_done()) {
-                        // check method
-                        if (jrpc.get_method_id() != gdt_grpc::CMD_AUTH)
-                            throw AuthException(mink::error::EC_AUTH_INVALID_METHOD);
-
-                        // check credentials
-                        const std::string &crdts = jrpc.get_auth_crdts();
-
-                        // user auth info
-                        std::tuple<int, std::string, std::string, int, int> ua;
+            id = jrpc.get_id();
+            req_tmt = jrpc.get_mink_timeout();
+
+            // auth check
+            if (!auth_done()) {
+                // check method (not allowed in batch)
+                if (agg || jrpc.get_method_id() != gdt_grpc::CMD_AUTH)
+                    throw AuthException(mink::error::EC_AUTH_INVALID_METHOD);
+
+                // check credentials
+                const std::string &crdts = jrpc.get_auth_crdts();
+
+                // verify credentials on auth pool (sqlite
+                // must not block the io thread), reading
+                // is resumed in on_auth
+                auto self = derived().shared_from_this();
+                net::post(get_auth_pool(), [self, crdts, id] {
+                    std::tuple<int, std::string, std::string, int, int> ua;
+                    std::string err;
+                    try {
                         // connect with DB
                         ua = user_auth_jrpc(crdts);
+                    } catch (std::exception &e) {
+                        err = e.what();
+                        if (err.empty())
+                            err = "unknown error";
+                    }
+                    // continue on session strand
+                    net::post(self->ws().get_executor(), [self, ua, err, id] {
+                        self->on_auth(ua, err, id);
+                    });
+                });
+                return true;
+            }
 
-                        /**************************************/
-                        /* tuple index [3] = user auth status */
-                        /**************************************/
-                        // -1 = invalid user
-                        //  0 = user found, invalid password
-                        //  1 = user found and authenticated
-                        if (std::get<3>(ua) == -1)
-                            throw AuthException(mink::error::EC_AUTH_UNKNOWN_USER);
-
-                        /**************/
-                        /* user found */
-                        /**************/
-                        // get unix timestamp (part of user tuple)
-                        auto ts_now = stdc::system_clock::now().time_since_epoch();
-                        // now ts msec
-                        uint64_t now_msec = stdc::duration_cast<stdc::milliseconds>(ts_now).count();
-
-                        // invalid password check
-                        if (std::get<3>(ua) == 0){
-                            // find user
-                            UserBanInfo *bi = USERS.get_banned(std::get<1>(ua));
-
-                            // add to list if not found
-                            if (!bi)
-                                bi = USERS.add_attempt(std::get<1>(ua));
-
-                            // if found, inc attempts
-                            else
-                                ++bi->attemtps;
-
-                            // check if banned
-                            if (bi->banned){
-                                // check if ban can be lifted
-                                if(now_msec - bi->ts_msec > bi->ts_banned_until){
-                                    USERS.lift_ban(bi->username);
-                                    bi = nullptr;
-
-                                }else{
-                                    // too many failed attempts
-                                    throw AuthException(mink::error::EC_AUTH_USER_BANNED);
-                                }
-
-                            // check if ban needs to be set
-                            }else{
-                                if(bi->attemtps >= dd->dparams.get_pval<int>(6)){
-                                    bi->banned = true;
-                                    bi->ts_banned_until = now_msec + (dd->dparams.get_pval<int>(7) * 60 * 1000);
-                                    // user is now banned
-                                    throw AuthException(mink::error::EC_AUTH_USER_BANNED);
-                                }
-                            }
-
-                            // invalid password
-                            throw AuthException(mink::error::EC_AUTH_FAILED);
-
-                        // password ok, check if user was banned
-                        }else{
-                            // find
-                            UserBanInfo *bi = USERS.get_banned(std::get<1>(ua));
-                            // user found, check if ban can be lifted
-                            if(bi && bi->banned){
-                                if(bi->ts_banned_until <= now_msec){
-                                    USERS.lift_ban(bi->username);
-
-                                // ban can't be lifted just yet
-                                }else{
-                                    throw AuthException(mink::error::EC_AUTH_USER_BANNED);
-                                }
-                            }
-                        }
+            // check for special CMD_FIRMWARE_UPDATE method
+            if (jrpc.get_method_id() == gdt_grpc::CMD_FIRMWARE_UPDATE) {
+                if (impl_firmware_update(jrpc)) {
+                    j_rpl = Jrpc::gen_err(mink::error::EC_UNKNOWN, id);
+                } else {
+                    using namespace gdt_grpc;
+                    j_rpl = json_rpc::JsonRpc::gen_response(id);
+                    j_rpl[json_rpc::JsonRpc::RESULT_] = json::array();
+                    auto &j_res_arr = j_rpl.at(json_rpc::JsonRpc::RESULT_);
+                    // filesize
+                    auto j_usr = json::object();
+                    j_usr[SysagentParamMap.find(PT_FU_FSIZE)->second] = mink_utils::get_file_size("/tmp/firmware.img");
+                    j_res_arr.push_back(j_usr);
+                }
+                send_reply(agg, agg_idx, j_rpl);
+                return false;
+            }
 
-#ifdef ENABLE_WS_SINGLE_SESSION
-                        if (USERS.count() > 0) {
-                            // new user is admin, logout other users
-                            if (std::get<4>(ua) == 1) {
-                                // logout other users
-                                USERS.process_all([this](const usr_info_t &u) {
-                                    WebSocketBase *ws = std::get<2>(u);
-                                    if (ws != this) ws->do_close();
-                                });
-                                USERS.remove_all();
-
-                            // new user is a "regular" user
-                            }else{
-                                // check if admin user is logged in
-                                bool al = false;
-                                USERS.process_all([&al](const usr_info_t &u) {
-                                    int f = std::get<1>(u);
-                                    if (f == 1)
-                                        al = true;
-                                });
-
-                                // admin already logged in, close connection
-                                if (al){
-                                    do_close();
-                                    return;
-
-                                // other "regular"users found, disconnect them
-                                }else{
-                                    USERS.process_all([this](const usr_info_t &u) {
-                                        WebSocketBase *ws = std::get<2>(u);
-                                        if (ws != this) ws->do_close();
-                                    });
-                                    USERS.remove_all();
-                                }
-                            }
-                        }
-#endif
+            // unsubscribe (handled locally, sysagentd
+            // does not reply to cancel requests)
+            const int sub_id = jrpc.get_mink_unsubscribe();
+            if (sub_id != -1) {
+                if (unsubscribe(sub_id)) {
+                    j_rpl = json_rpc::JsonRpc::gen_response(id);
+                    j_rpl[json_rpc::JsonRpc::RESULT_] = json::array();
+                } else
+                    j_rpl = Jrpc::gen_err(mink::error::EC_SUB_NOT_FOUND, id);
+                send_reply(agg, agg_idx, j_rpl);
+                return false;
+            }
 
+            // subscription; replies keep coming with
+            // the same id until unsubscribed
+            const bool sub = (jrpc.get_mink_interval() > 0);
+            if (sub) {
+                if (agg || jrpc.get_mink_did_list())
+                    throw std::invalid_argument("MINK: subscription not allowed in batch or fan-out");
+                // re-subscribe with the same id
+                unsubscribe(id);
+                if (subs_.size() >= MAX_SUBS)
+                    throw std::invalid_argument("MINK: too many subscriptions");
+            }
 
-                        // save session credentials
-                        set_credentials(std::get<0>(ua),
-                                        std::get<1>(ua),
-                                        std::get<2>(ua),
-                                        std::get<4>(ua));
-
-                        // add to user list
-                        auto new_usr = std::make_tuple(std::get<1>(ua),
-                                                       std::get<4>(ua),
-                                                       this,
-                                                       now_msec);
-                        USERS.add(new_usr);
-
-                        // set current user for this connection
-                        usr_info_ = new_usr;
-
-                        // generate response
-                        auto j_res = json_rpc::JsonRpc::gen_response(id);
-                        j_res[json_rpc::JsonRpc::RESULT_] = json::array();
-                        auto &j_res_arr = j_res.at(json_rpc::JsonRpc::RESULT_);
-                        // user id
-                        auto j_usr = json::object();
-                        j_usr[json_rpc::JsonRpc::ID_] = std::get<0>(ua);
-                        j_res_arr.push_back(j_usr);
-
-                        // send response
-                        std::string th_rpl = j_res.dump();
-                        reading_.store(false);
-                        send_buff(th_rpl);
-                        do_read();
-                        return;
+            // fan-out (list of destination ids), one GDT
+            // request per destination, results are aggregated
+            const json *dids = jrpc.get_mink_did_list();
+            if (dids) {
+                if (dids->size() > MAX_FANOUT)
+                    throw std::invalid_argument("MINK: too many destination ids");
+                auto fo = std::make_shared<JrpcAggregate>();
+                fo->id = id;
+                fo->parent = agg;
+                fo->parent_idx = agg_idx;
+                for (const auto &did : *dids)
+                    fo->targets.push_back(did.get<std::string>());
+                fo->replies.resize(fo->targets.size());
+                fo->pending = fo->targets.size();
+
+                for (std::size_t i = 0; i < fo->targets.size(); i++) {
+                    // every target counts as outstanding request
+                    if (inflight_ >= max_inflight_) {
+                        json j_err = Jrpc::gen_err(mink::error::EC_BUSY, id);
+                        agg_reply(fo, i, j_err);
+                        continue;
                     }
-
-                    // check for special CMD_FIRMWARE_UPDATE method
-                    if (jrpc.get_method_id() == gdt_grpc::CMD_FIRMWARE_UPDATE) {
-                        if (impl_firmware_update(jrpc)) {
-                            ws_rpl = Jrpc::gen_err(mink::error::EC_UNKNOWN, id).dump();
-                            send_buff(ws_rpl);
-                        } else {
-                            using namespace gdt_grpc;
-                            auto j_res = json_rpc::JsonRpc::gen_response(id);
-                            j_res[json_rpc::JsonRpc::RESULT_] = json::array();
-                            auto &j_res_arr = j_res.at(json_rpc::JsonRpc::RESULT_);
-                            // filesize
-                            auto j_usr = json::object();
-                            j_usr[SysagentParamMap.find(PT_FU_FSIZE)->second] = mink_utils::get_file_size("/tmp/firmware.img");
-                            j_res_arr.push_back(j_usr);
-                            ws_rpl = j_res.dump();
-                            send_buff(ws_rpl);
-                        }
-                        // another read
-                        reading_.store(false);
-                        do_read();
-                        return;
+                    if (!gdt_dispatch(jrpc, &fo->targets[i], fo, i, id, req_tmt)) {
+                        json j_err = Jrpc::gen_err(mink::error::EC_GDT_PUSH_FAILED, id);
+                        agg_reply(fo, i, j_err);
                     }
+                }
+                return false;
+            }
 
-                    // tmp guid
-                    uint8_t guid_b[16];
-                    // push via gdt
-                    if (!gdt_push(jrpc, derived().shared_from_this(), guid_b)) {
-                        throw GDTException();
+            // batch elements count as outstanding
+            // requests, excess is rejected
+            if (inflight_ >= max_inflight_) {
+                j_rpl = Jrpc::gen_err(mink::error::EC_BUSY, id);
+                send_reply(agg, agg_idx, j_rpl);
+                return false;
+            }
 
-                    // setup timeout
-                    }else{
-                        std::shared_ptr<WebSocketBase> ws = derived().shared_from_this();
-                        // timeout handler
-                        auto self = derived().shared_from_this();
-                        std::thread tt_th([ws, guid_b, id, req_tmt, self] {
-                            mink_utils::Guid g;
-                            g.set(guid_b);
-                            // sleep
-                            std::this_thread::sleep_for(std::chrono::milliseconds(req_tmt));
-                            // get current guid (generated in gdt_push)
-                            auto dd = static_cast<JsonRpcdDescriptor *>(mink::CURRENT_DAEMON);
-                            // correlate guid
-                            dd->cmap.lock();
-                            JrpcPayload *pld = dd->cmap.get(g);
-                            if (pld && !pld->persistent) {
-                                dd->cmap.remove(g);
-                                dd->cmap.unlock();
-                                std::string th_rpl = Jrpc::gen_err(mink::error::EC_REQ_TIMEOUT, id).dump();
-                                self->send_buff(th_rpl);
-                                mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
-                                                          "JSON RPC timeout occurred for id = [%d]",
-                                                          pld->id);
-
-                                /*
-                                // initiate another read after sending the reply
-                                bool expected = true;
-                                // !expected: if expected is set to true already by another thread,
-                                // it's done; otherwise, try again
-                                while (!self->reading_.compare_exchange_weak(expected, false) &&
-                                       !expected) {}
-                                // no other async reads are running, initiate one
-                                self->do_read();
-                                */
-                                return;
-                            }
-                            dd->cmap.unlock();
-                        });
-                        tt_th.detach();
+            // push via gdt
+            if (!gdt_dispatch(jrpc, jrpc.get_mink_did(), agg, agg_idx, id, req_tmt))
+                throw GDTException();
 
-                    }
-                }
-            } catch (GDTException &e) {
-                ws_rpl = Jrpc::gen_err(mink::error::EC_GDT_PUSH_FAILED, id).dump();
-                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                          "Cannot dispatch via GDT = %s",
-                                          j.dump().c_str());
+            return false;
 
-            } catch (AuthException &e) {
-                ws_rpl = Jrpc::gen_err(e.get_ec(), id).dump();
-                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                          "JSON RPC authentication error [%d] = %s",
-                                          e.get_ec(),
-                                          j.dump().c_str());
+        } catch (GDTException &e) {
+            j_rpl = Jrpc::gen_err(mink::error::EC_GDT_PUSH_FAILED, id);
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "Cannot dispatch via GDT = %s",
+                                      j.dump().c_str());
 
-            } catch (std::exception &e) {
-                ws_rpl = Jrpc::gen_err(mink::error::EC_UNKNOWN, id, e.what()).dump();
-            }
+        } catch (AuthException &e) {
+            j_rpl = Jrpc::gen_err(e.get_ec(), id);
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "JSON RPC authentication error [%d] = %s",
+                                      e.get_ec(),
+                                      j.dump().c_str());
+
+        } catch (std::exception &e) {
+            j_rpl = Jrpc::gen_err(mink::error::EC_UNKNOWN, id, e.what());
+        }
 
-            // send error reply
-            if (!ws_rpl.empty()) {
-                send_buff(ws_rpl);
+        // send error reply
+        if (log_debug())
+            mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                                      "JSON RPC error = %s",
+                                      j_rpl.dump().c_str());
+        send_reply(agg, agg_idx, j_rpl);
+        return false;
+    }
+
+    // Push request via GDT and setup timeout
+    bool gdt_dispatch(const json_rpc::JsonRpc &jrpc,
+                      const std::string *dest_id,
+                      const std::shared_ptr<JrpcAggregate> &agg,
+                      const std::size_t agg_idx,
+                      const int id,
+                      const int req_tmt){
+        // tmp guid
+        uint8_t guid_b[16];
+        // push via gdt
+        if (!gdt_push(jrpc, derived().shared_from_this(), guid_b, dest_id, agg, agg_idx))
+            return false;
+
+        // outstanding requests; replies are matched
+        // by guid, next read is not blocked
+        ++inflight_;
+        // timeout handler (timer runs on session strand)
+        auto self = derived().shared_from_this();
+        auto tmr = std::make_shared<net::steady_timer>(derived().ws().get_executor());
+        tmr->expires_after(std::chrono::milliseconds(req_tmt));
+        mink_utils::Guid g;
+        g.set(guid_b);
+        // subscription, cancelled by client or when
+        // session is closed
+        if (jrpc.get_mink_interval() > 0) {
+            subs_[id] = JrpcSubscription{g,
+                                         jrpc.get_mink_dtype(),
+                                         (dest_id != nullptr ? *dest_id : "")};
+        }
+        tmr->async_wait([tmr, g, id, agg, agg_idx, self](beast::error_code ec) {
+            if (ec)
+                return;
+            auto dd = static_cast<JsonRpcdDescriptor *>(mink::CURRENT_DAEMON);
+            auto &cmap = dd->get_cmap(g);
+            // correlate guid
+            cmap.lock();
+            JrpcPayload *pld = cmap.get(g);
+            if (pld && !pld->persistent) {
+                int pld_id = pld->id;
+                bool req_done = pld->inflight;
+                cmap.remove(g);
+                cmap.unlock();
+                // reported per target for fan-out
+                json j_err = Jrpc::gen_err(mink::error::EC_REQ_TIMEOUT, id);
+                self->send_reply(agg, agg_idx, j_err);
+                // no data received, stop subscription
+                auto it = self->subs_.find(id);
+                if (it != self->subs_.end() && it->second.guid == g)
+                    self->unsubscribe(id);
+                if (req_done)
+                    self->request_done();
                 mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
-                                          "JSON RPC error = %s",
-                                          ws_rpl.c_str());
-                reading_.store(false);
-                do_read();
+                                          "JSON RPC timeout occurred for id = [%d]",
+                                          pld_id);
                 return;
             }
+            cmap.unlock();
+        });
+        return true;
+    }
+
+    // Cancel subscription (session strand)
+    bool unsubscribe(const int sub_id){
+        auto it = subs_.find(sub_id);
+        if (it == subs_.end())
+            return false;
+
+        auto dd = static_cast<JsonRpcdDescriptor *>(mink::CURRENT_DAEMON);
+        const JrpcSubscription &sub = it->second;
+        // remove correlation, late replies are dropped
+        auto &cmap = dd->get_cmap(sub.guid);
+        bool req_done = false;
+        cmap.lock();
+        JrpcPayload *pld = cmap.get(sub.guid);
+        if (pld) {
+            req_done = pld->inflight;
+            cmap.remove(sub.guid);
         }
+        cmap.unlock();
+        // stop sampling on sysagentd
+        dd->sub_cancel(sub.guid,
+                       sub.dtype.c_str(),
+                       (sub.did.empty() ? nullptr : sub.did.c_str()));
+        subs_.erase(it);
+        if (req_done)
+            request_done();
+        return true;
+    }
+
+    // Send reply or add it to aggregated reply
+    void send_reply(const std::shared_ptr<JrpcAggregate> &agg,
+                    const std::size_t agg_idx,
+                    json &j){
+        if (agg)
+            agg_reply(agg, agg_idx, j);
+        else
+            send_buff(json_rpc::encode(j, enc_));
+    }
+
+    // Aggregated reply part received
+    void agg_reply(const std::shared_ptr<JrpcAggregate> &agg,
+                   const std::size_t agg_idx,
+                   json &j){
+        // already received (persistent correlation)
+        if (agg_idx >= agg->replies.size() || !agg->replies[agg_idx].is_null())
+            return;
+
+        // fan-out, tag result with destination id
+        if (!agg->batch) {
+            j.erase(json_rpc::JsonRpc::JSON_RPC_);
+            j.erase(json_rpc::JsonRpc::ID_);
+            j[json_rpc::JsonRpc::MINK_DID_] = agg->targets[agg_idx];
+        }
+        agg->replies[agg_idx] = std::move(j);
+        if (--agg->pending > 0)
+            return;
+
+        // all parts received
+        json j_rpl;
+        if (agg->batch) {
+            j_rpl = json::array();
+            for (auto &r : agg->replies)
+                j_rpl.push_back(std::move(r));
+
+        } else {
+            j_rpl = json_rpc::JsonRpc::gen_response(agg->id);
+            j_rpl[json_rpc::JsonRpc::RESULT_] = json::array();
+            auto &j_res_arr = j_rpl.at(json_rpc::JsonRpc::RESULT_);
+            for (auto &r : agg->replies)
+                j_res_arr.push_back(std::move(r));
+        }
+        agg->replies.clear();
+
+        // fan-out inside a batch
+        if (agg->parent)
+            agg_reply(agg->parent, agg->parent_idx, j_rpl);
+        else
+            send_buff(json_rpc::encode(j_rpl, enc_));
+    }
+
+    // Auth pool result handler (runs on session strand)
+    void on_auth(const std::tuple<int, std::string, std::string, int, int> &ua,
+                 const std::string &err,
+                 const int id){
+        // daemon
+        auto dd = static_cast<JsonRpcdDescriptor*>(mink::CURRENT_DAEMON);
+        // error reply
+        json j_err;
+        try {
+            // db error
+            if (!err.empty())
+                throw std::invalid_argument(err);
+
+            /**************************************/
+            /* tuple index [3] = user auth status */
+            /**************************************/
+            // -1 = invalid user
+            //  0 = user found, invalid password
+            //  1 = user found and authenticated
+            if (std::get<3>(ua) == -1)
+                throw AuthException(mink::error::EC_AUTH_UNKNOWN_USER);
+
+            /**************/
+            /* user found */
+            /**************/
+            // get unix timestamp (part of user tuple)
+            auto ts_now = stdc::system_clock::now().time_since_epoch();
+            // now ts msec
+            uint64_t now_msec = stdc::duration_cast<stdc::milliseconds>(ts_now).count();
+
+            // invalid password check
+            if (std::get<3>(ua) == 0){
+                // count failed attempt (sessions on other
+                // io threads can fail at the same time)
+                uint64_t ban_msec = dd->dparams.get_pval<int>(7) * 60 * 1000;
+                if (USERS.auth_failed(std::get<1>(ua),
+                                      now_msec,
+                                      dd->dparams.get_pval<int>(6),
+                                      ban_msec)) {
+                    // too many failed attempts
+                    throw AuthException(mink::error::EC_AUTH_USER_BANNED);
+                }
+
+                // invalid password
+                throw AuthException(mink::error::EC_AUTH_FAILED);
+
+            // password ok, check if user was banned
+            }else{
+                // ban can't be lifted just yet
+                if (USERS.is_banned(std::get<1>(ua), now_msec))
+                    throw AuthException(mink::error::EC_AUTH_USER_BANNED);
+            }
+
+#ifdef ENABLE_WS_SINGLE_SESSION
+            if (USERS.count() > 0) {
+                // new user is admin, logout other users
+                if (std::get<4>(ua) == 1) {
+                    // logout other users
+                    USERS.process_all([this](const usr_info_t &u) {
+                        WebSocketBase *ws = std::get<2>(u);
+                        if (ws != this) ws->do_close();
+                    });
+                    USERS.remove_all();
+
+                // new user is a "regular" user
+                }else{
+                    // check if admin user is logged in
+                    bool al = false;
+                    USERS.process_all([&al](const usr_info_t &u) {
+                        int f = std::get<1>(u);
+                        if (f == 1)
+                            al = true;
+                    });
+
+                    // admin already logged in, close connection
+                    if (al){
+                        do_close();
+                        return;
+
+                    // other "regular"users found, disconnect them
+                    }else{
+                        USERS.process_all([this](const usr_info_t &u) {
+                            WebSocketBase *ws = std::get<2>(u);
+                            if (ws != this) ws->do_close();
+                        });
+                        USERS.remove_all();
+                    }
+                }
+            }
+#endif
+
+
+            // save session credentials
+            set_credentials(std::get<0>(ua),
+                            std::get<1>(ua),
+                            std::get<2>(ua),
+                            std::get<4>(ua));
+
+            // add to user list
+            auto new_usr = std::make_tuple(std::get<1>(ua),
+                                           std::get<4>(ua),
+                                           this,
+                                           now_msec);
+            USERS.add(new_usr);
+
+            // set current user for this connection
+            usr_info_ = new_usr;
+
+            // generate response
+            auto j_res = json_rpc::JsonRpc::gen_response(id);
+            j_res[json_rpc::JsonRpc::RESULT_] = json::array();
+            auto &j_res_arr = j_res.at(json_rpc::JsonRpc::RESULT_);
+            // user id
+            auto j_usr = json::object();
+            j_usr[json_rpc::JsonRpc::ID_] = std::get<0>(ua);
+            j_res_arr.push_back(j_usr);
+
+            // send response
+            std::string th_rpl = json_rpc::encode(j_res, enc_);
+            send_buff(th_rpl);
+
+        } catch (AuthException &e) {
+            j_err = Jrpc::gen_err(e.get_ec(), id);
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "JSON RPC authentication error [%d] for user = %s",
+                                      e.get_ec(),
+                                      std::get<1>(ua).c_str());
+
+        } catch (std::exception &e) {
+            j_err = Jrpc::gen_err(mink::error::EC_UNKNOWN, id, e.what());
+        }
+
+        // send error reply
+        if (!j_err.is_null()) {
+            send_buff(json_rpc::encode(j_err, enc_));
+            mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                                      "JSON RPC error = %s",
+                                      j_err.dump().c_str());
+        }
+
         // another read
         reading_.store(false);
         do_read();
-
     }
 
     void on_write(beast::error_code ec, std::size_t bt){
         boost::ignore_unused(bt);
 
-        std::unique_lock<std::mutex> l(mtx_);
         q_state = IDLE;
+        put_wbuf(std::move(q_.front()));
         q_.pop_front();
-        l.unlock();
 
         if (ec)
             return fail(ec, "WebSocketSession::write");
 
+        // queue drained, flush
+        if (q_.empty() && corked_)
+            set_cork(false);
+
         // write more
         do_write();
 
@@ -610,12 +924,17 @@ public:
 
     template<class Body, class Allocator>
     void run(http::request<Body, http::basic_fields<Allocator>> req){
+        // weak self for calls from other sessions
+        weak_self_ = derived().shared_from_this();
         // Accept the WebSocket upgrade request
         do_accept(std::move(req));
     }
     bool gdt_push(const json_rpc::JsonRpc &jrpc,
                   std::shared_ptr<WebSocketBase> ws,
-                  uint8_t *guid){
+                  uint8_t *guid,
+                  const std::string *dest_id,
+                  const std::shared_ptr<JrpcAggregate> &agg,
+                  const std::size_t agg_idx){
 
         auto dd = static_cast<JsonRpcdDescriptor*>(mink::CURRENT_DAEMON);
         // local routing daemon pointer
@@ -675,6 +994,10 @@ public:
         // timeout
         msg->vpmap.set_int(asn1::ParameterType::_pt_mink_timeout,
                            jrpc.get_mink_timeout());
+        // subscription interval
+        if (jrpc.get_mink_interval() > 0)
+            msg->vpmap.set_int(asn1::ParameterType::_pt_mink_sub_interval,
+                               jrpc.get_mink_interval());
 
         // set smsg user callback as param
         msg->params.set_param(3, ev_usr_cb);
@@ -724,6 +1047,8 @@ public:
         // set correlation payload data
         pld.cdata = ws;
         pld.id = jrpc.get_id();
+        pld.agg = agg;
+        pld.agg_idx = agg_idx;
         // generate guid
         rand.generate(guid, 16);
         pld.guid.set(guid);
@@ -739,28 +1064,40 @@ public:
             return false;
         }
 
-        // destination id
-        const std::string *dest_id = jrpc.get_mink_did();
-
-        // send service message
-        int r = dd->gdtsmm->send(msg,
+        // save to correlarion map (before sending, pipelined
+        // replies can arrive before send returns)
+        auto &cmap = dd->get_cmap(pld.guid);
+        cmap.lock();
+        cmap.set(pld.guid, pld);
+        cmap.unlock();
+
+        // send service message; pipelined mode is opt-in
+        // (stateless-no-reply, routing errors are not reported)
+        const char *did = (dest_id != nullptr ? dest_id->c_str() : nullptr);
+        int r;
+        if (jrpc.get_mink_pipelined())
+            r = dd->gdtsmm->send_pipelined(msg,
+                                           gdtc,
+                                           jrpc.get_mink_dtype().c_str(),
+                                           did,
+                                           &dd->ev_srvcm_tx);
+        else
+            r = dd->gdtsmm->send(msg,
                                  gdtc,
                                  jrpc.get_mink_dtype().c_str(),
-                                 (dest_id != nullptr ? dest_id->c_str() : nullptr),
+                                 did,
                                  true,
                                  &dd->ev_srvcm_tx);
         if (r) {
             // TODO stats
+            cmap.lock();
+            cmap.remove(pld.guid);
+            cmap.unlock();
             dd->gdtsmm->free_smsg(msg);
             delete ev_usr_cb;
             return false;
         }
 
-        // save to correlarion map
-        dd->cmap.lock();
-        dd->cmap.set(pld.guid, pld);
-        dd->cmap.unlock();
-
         return true;
 
     }
@@ -783,25 +1120,79 @@ public:
         return buffer_;
     }
 
-    std::mutex &get_mtx(){
-        return mtx_;
+    // called from GDT threads; hand over to session strand
+    void async_buffer_send(std::string d, bool req_done = false) {
+        auto self = derived().shared_from_this();
+        auto dp = std::make_shared<std::string>(std::move(d));
+        net::post(derived().ws().get_executor(),
+                  [self, dp, req_done]() {
+                      self->send_buff(std::move(*dp));
+                      if (req_done)
+                          self->request_done();
+                  });
     }
 
-    void async_buffer_send(const std::string &d) {
-        std::unique_lock<std::mutex> l(mtx_);
-        q_.push_back(std::move(d));
-        l.unlock();
-        do_write();
+    // reusable write buffer (capacity is kept)
+    std::string get_wbuf() {
+        std::unique_lock<std::mutex> l(wbuf_mtx_);
+        if (wbuf_pool_.empty())
+            return std::string();
+        std::string b = std::move(wbuf_pool_.back());
+        wbuf_pool_.pop_back();
+        return b;
     }
 
+    // return write buffer to pool (large buffers are dropped)
+    void put_wbuf(std::string &&b) {
+        if (b.capacity() > WBUF_MAX_CAP)
+            return;
+        b.clear();
+        std::unique_lock<std::mutex> l(wbuf_mtx_);
+        if (wbuf_pool_.size() < WBUF_POOL_MAX)
+            wbuf_pool_.push_back(std::move(b));
+    }
+
+    // called from GDT threads (aggregated reply part)
+    void async_agg_send(json &&j,
+                        const std::shared_ptr<JrpcAggregate> &agg,
+                        std::size_t agg_idx,
+                        bool req_done) {
+        auto self = derived().shared_from_this();
+        auto jp = std::make_shared<json>(std::move(j));
+        net::post(derived().ws().get_executor(),
+                  [self, jp, agg, agg_idx, req_done]() {
+                      self->agg_reply(agg, agg_idx, *jp);
+                      if (req_done)
+                          self->request_done();
+                  });
+    }
+
+    // called from GDT threads; subscription was dropped
+    // by source (correlation already removed)
+    void async_sub_drop(int id, const mink_utils::Guid &g) {
+        auto self = derived().shared_from_this();
+        net::post(derived().ws().get_executor(), [self, id, g]() {
+            auto it = self->subs_.find(id);
+            if (it != self->subs_.end() && it->second.guid == g)
+                self->subs_.erase(it);
+        });
+    }
+
+    // can be called from other sessions (io threads)
     void do_close(){
-        // Send a TCP shutdown
-        beast::error_code ec;
-        beast::get_lowest_layer(derived().ws()).socket().shutdown(tcp::socket::shutdown_send, ec);
+        auto self = weak_self_.lock();
+        if (!self)
+            return;
+        net::post(derived().ws().get_executor(), [self] {
+            // Send a TCP shutdown
+            beast::error_code ec;
+            beast::get_lowest_layer(self->ws()).socket().shutdown(tcp::socket::shutdown_send, ec);
+        });
     }
 
 private:
     beast::flat_buffer buffer_;
+    std::weak_ptr<Derived> weak_self_;
     int usr_id_;
     std::string usr_;
     std::string pwd_;
@@ -809,8 +1200,25 @@ private:
     int usr_flags_;
     enum QState { IDLE, SENDING } q_state = IDLE;
     std::atomic_bool reading_;
+    // outstanding GDT requests (session strand)
+    int inflight_ = 0;
+    int max_inflight_;
     std::deque<std::string> q_;
-    std::mutex mtx_;
+    bool corked_ = false;
+    // permessage-deflate level (0 = disabled)
+    int deflate_lvl_;
+    static constexpr std::size_t WS_WBUF_SIZE = 65536;
+    // active subscriptions by request id (session strand)
+    static constexpr std::size_t MAX_SUBS = 64;
+    // max batch size and fan-out targets per request
+    static constexpr std::size_t MAX_BATCH = 64;
+    static constexpr std::size_t MAX_FANOUT = 64;
+    std::map<int, JrpcSubscription> subs_;
+    // reusable write buffers (filled by GDT threads)
+    static constexpr std::size_t WBUF_POOL_MAX = 16;
+    static constexpr std::size_t WBUF_MAX_CAP = 65536;
+    std::mutex wbuf_mtx_;
+    std::vector<std::string> wbuf_pool_;
 };
 
 /*************************/
@@ -11,12 +11,12 @@
 #include "events.h"
 #include "sysagent.h"
 #include <daemon.h>
-#include <thread>
 #include <atomic.h>
 #include <sys/sysinfo.h>
 #include <sys/utsname.h>
 #include <proc/readproc.h>
 #include <mink_pkg_config.h>
+#include <mink_err_codes.h>
 #ifdef ENABLE_GRPC
 #include <gdt.pb.h>
 #else
@@ -66,10 +66,72 @@ void EVHbeatCleanup::run(gdt::GDTCallbackArgs *args) {
 }
 #endif
 
+// send command reply to source daemon (smsg is
+// freed by sent handler or here on error)
+static void send_reply(SysagentdDescriptor *dd,
+                       gdt::ServiceMessage *smsg,
+                       const std::string &src_type,
+                       const std::string &src_id,
+                       gdt::GDTCallbackMethod *sent_cb){
+    gdt::ServiceMsgManager *gdtsmm = smsg->get_smsg_manager();
+
+    // set source daemon
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type, dd->get_daemon_type());
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id, dd->get_daemon_id());
+
+    // extra params
+    using spmap_t = std::vector<gdt::ServiceParam*>;
+    gdt::GDTCallbackMethod *ev_usr_cb = nullptr;
+    spmap_t *pmap = nullptr;
+    // get callback and smsg map
+    const mink_utils::VariantParam *vp_cb = smsg->vpmap.get_param(0);
+    const mink_utils::VariantParam *vp_pmap = smsg->vpmap.get_param(1);
+    // check pointers
+    if (vp_cb) ev_usr_cb = static_cast<gdt::GDTCallbackMethod *>((void *)*vp_cb);
+    if (vp_pmap) pmap = static_cast<spmap_t *>((void *)*vp_pmap);
+
+    // sync vpmap
+    if (gdtsmm->vpmap_sparam_sync(smsg, pmap) == 0) {
+        // set extra params
+        smsg->params.set_param(3, ev_usr_cb);
+        // send (reply in the same mode as request)
+        int res = 0;
+        if (smsg->pipelined) {
+            res = gdtsmm->send_pipelined(smsg,
+                                         dd->rtrd_gdtc,
+                                         src_type.c_str(),
+                                         src_id.c_str(),
+                                         sent_cb);
+        } else {
+            res = gdtsmm->send(smsg,
+                               dd->rtrd_gdtc,
+                               src_type.c_str(),
+                               src_id.c_str(),
+                               true,
+                               sent_cb);
+        }
+        if(res){
+            // error
+            // TODO stats
+            // return service message to pool
+            gdtsmm->free_smsg(smsg);
+            // free user cb
+            delete ev_usr_cb;
+        }
+
+    } else {
+        // error
+        // TODO STATS
+        // return service message to pool
+        gdtsmm->free_smsg(smsg);
+        // free user cb
+        delete ev_usr_cb;
+    }
+}
+
 void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     gdt::ServiceMessage* smsg = args->get<gdt::ServiceMessage>(gdt::GDT_CB_INPUT_ARGS,
                                                                gdt::GDT_CB_ARGS_SRVC_MSG);
-    gdt::ServiceMsgManager* gdtsmm = smsg->get_smsg_manager();
     auto dd = static_cast<SysagentdDescriptor*>(mink::CURRENT_DAEMON);
     gdt::GDTStream* gdt_stream = args->get<gdt::GDTStream>(gdt::GDT_CB_INPUT_ARGS,
                                                            gdt::GDT_CB_ARG_STREAM);
@@ -107,6 +169,19 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     const mink_utils::VariantParam *vp_guid = smsg->vpget(asn1::ParameterType::_pt_mink_guid);
     if(!vp_guid) return;
 
+    // save source daemon address
+    std::string src_type(static_cast<char *>(*vp_src_type));
+    std::string src_id(static_cast<char *>(*vp_src_id));
+
+    // subscription cancel (only subscriber can
+    // cancel its own subscription)
+    if (smsg->vpget(asn1::ParameterType::_pt_mink_sub_cancel)) {
+        mink_utils::Guid guid;
+        guid.set(static_cast<uint8_t *>((unsigned char *)*vp_guid));
+        dd->subs.remove(guid, src_type, src_id);
+        return;
+    }
+
     // look for cmd id
     const mink_utils::VariantParam *vp_cmd_id = smsg->vpget(asn1::ParameterType::_pt_mink_command_id);
     if(!vp_cmd_id) return;
@@ -156,9 +231,31 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
         }
     }
 
-    // save source daemon address
-    std::string src_type(static_cast<char *>(*vp_src_type));
-    std::string src_id(static_cast<char *>(*vp_src_id));
+    // subscription; command is sampled periodically
+    // and changes are pushed to source daemon
+    const mink_utils::VariantParam *vp_sub = smsg->vpget(asn1::ParameterType::_pt_mink_sub_interval);
+    if (vp_sub) {
+        mink_utils::Guid guid;
+        guid.set(static_cast<uint8_t *>((unsigned char *)*vp_guid));
+        // int (jrpcd) or string (grpcd)
+        uint32_t intvl = 0;
+        if (vp_sub->get_type() == mink_utils::DPT_INT)
+            intvl = static_cast<int>(*vp_sub);
+        else if (vp_sub->get_type() == mink_utils::DPT_STRING)
+            intvl = strtoul(static_cast<char *>(*vp_sub), nullptr, 10);
+        if (dd->subs.add(smsg,
+                         guid,
+                         static_cast<int>(*vp_cmd_id),
+                         src_type,
+                         src_id,
+                         intvl)) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                     "too many subscriptions");
+            dd->subs.cancel(guid, src_type, src_id, mink::error::EC_BUSY);
+        }
+        // smsg is not needed anymore (freed by GDT layer)
+        return;
+    }
 
     // set client if needed
     if (!dd->rtrd_gdtc || !dd->rtrd_gdtc->is_registered())
@@ -171,71 +268,40 @@ void EVSrvcMsgRecv::run(gdt::GDTCallbackArgs *args){
     //   mandatory in this case
     gdt_stream->set_param(gdt::SMSG_PT_PASS, smsg);
 
-    // run in separate thread
-    std::thread exec_th([this,
-                         dd,
-                         gdtsmm,
-                         smsg,
-                         vp_cmd_id,
-                         src_type,
-                         src_id] {
-
-        // create data type wrapper
-        mink_utils::PluginInputData p_id(mink_utils::PLG_DT_GDT, smsg);
+    // command id
+    int cmd_id = static_cast<int>(*vp_cmd_id);
 
-        // run plugin
-        if (dd->plg_mngr.run(static_cast<int>(*vp_cmd_id), p_id)){
+    // run plugin; async handler or command executor
+    // (bounded per command)
+    int r = dd->plg_mngr.run_async(cmd_id,
+                                   mink_utils::PluginInputData(mink_utils::PLG_DT_GDT, smsg),
+                                   [this, dd, smsg, src_type, src_id](int res) {
+        // plugin error
+        if (res) {
             // return service message to pool
             smsg->get_smsg_manager()->free_smsg(smsg);
             return;
         }
+        send_reply(dd, smsg, src_type, src_id, &srvc_msg_sent);
+    });
 
-        // set source daemon
-        smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type, dd->get_daemon_type());
-        smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id, dd->get_daemon_id());
-
-        // extra params
-        using spmap_t = std::vector<gdt::ServiceParam*>;
-        gdt::GDTCallbackMethod *ev_usr_cb = nullptr;
-        spmap_t *pmap = nullptr;
-        // get callback and smsg map
-        const mink_utils::VariantParam *vp_cb = smsg->vpmap.get_param(0);
-        const mink_utils::VariantParam *vp_pmap = smsg->vpmap.get_param(1);
-        // check pointers
-        if (vp_cb) ev_usr_cb = static_cast<gdt::GDTCallbackMethod *>((void *)*vp_cb);
-        if (vp_pmap) pmap = static_cast<spmap_t *>((void *)*vp_pmap);
-
-        // sync vpmap
-        if (gdtsmm->vpmap_sparam_sync(smsg, pmap) == 0) {
-            // set extra params
-            smsg->params.set_param(3, ev_usr_cb);
-            // send
-            int res = gdtsmm->send(smsg,
-                                   dd->rtrd_gdtc,
-                                   src_type.c_str(),
-                                   src_id.c_str(),
-                                   true,
-                                   &srvc_msg_sent);
-            if(res){
-                // error
-                // TODO stats
-                // return service message to pool
-                smsg->get_smsg_manager()->free_smsg(smsg);
-                // free user cb
-                delete ev_usr_cb;
-            }
+    // plugin error
+    if (r && r != mink::error::EC_BUSY) {
+        smsg->get_smsg_manager()->free_smsg(smsg);
+        return;
+    }
 
-        } else {
-            // error
-            // TODO STATS
-            // return service message to pool
-            smsg->get_smsg_manager()->free_smsg(smsg);
-            // free user cb
-            delete ev_usr_cb;
-        }
-    });
-    // detach thread
-    exec_th.detach();
+    // saturated, reply with error
+    if (r) {
+        mink::CURRENT_DAEMON->log(mink::LLT_WARNING,
+                                  "command queue full, rejecting cmd = [%d]",
+                                  cmd_id);
+        smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_id);
+        smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_password);
+        smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_error,
+                             std::to_string(mink::error::EC_BUSY).c_str());
+        send_reply(dd, smsg, src_type, src_id, &srvc_msg_sent);
+    }
 }
 
 void EVParamStreamLast::run(gdt::GDTCallbackArgs *args){
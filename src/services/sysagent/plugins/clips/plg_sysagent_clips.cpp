@@ -14,6 +14,7 @@
 #include <memory>
 #include <mink_plugin.h>
 #include <gdt_utils.h>
+#include <mink_err_codes.h>
 #include <mink_pkg_config.h>
 #include <mutex>
 #include <stdexcept>
@@ -27,6 +28,8 @@ extern "C" {
 #include <clips.h>
 }
 #include <thread>
+#include <condition_variable>
+#include <unordered_map>
 #include <fstream>
 #include <atomic>
 #include <sys/sysinfo.h>
@@ -35,6 +38,7 @@ extern "C" {
 #include <json_rpc.h>
 #include <sysagent.h>
 #include <boost/variant.hpp>
+#include <boost/utility/string_view.hpp>
 
 /***********/
 /* Aliases */
@@ -54,6 +58,7 @@ static const char *PLG_ID = "plg_sysagent_clips.so";
 /* list of command implemented by this plugin */
 /**********************************************/
 extern "C" constexpr int COMMANDS[] = {
+    gdt_grpc::CMD_RUN_RULES,
     // end of list marker
     -1
 };
@@ -98,6 +103,66 @@ struct CLIPSEnv2EnvDescriptor {
 
 };
 
+/*****************/
+/* CLIPS fact op */
+/*****************/
+struct CLIPSFactOp {
+    enum Type {
+        // persistent fact (until retracted)
+        FO_ASSERT   = 0,
+        FO_RETRACT  = 1,
+        // transient fact (retracted after run)
+        FO_EVENT    = 2
+    };
+    Type type;
+    std::string fact;
+};
+
+/*********************************/
+/* CLIPS ENV events (event mode) */
+/*********************************/
+// Fact ops queued for event driven env; env thread applies
+// them incrementally and runs rules only if agenda is not
+// empty
+struct CLIPSEnvEvents {
+    // queue max
+    std::size_t q_max = 1024;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<CLIPSFactOp> q;
+
+    // stats
+    // run cycles
+    std::atomic<uint64_t> cycles{0};
+    // managed facts (asserted via ops)
+    std::atomic<uint64_t> facts{0};
+    // fact ops applied
+    std::atomic<uint64_t> asserted{0};
+    std::atomic<uint64_t> retracted{0};
+    // agenda size before run (total)
+    std::atomic<uint64_t> activations{0};
+    // rules fired (total)
+    std::atomic<uint64_t> fired{0};
+    // run time (usec, last cycle and total)
+    std::atomic<uint64_t> last_run_us{0};
+    std::atomic<uint64_t> run_us{0};
+    // dropped ops (queue full)
+    std::atomic<uint64_t> dropped{0};
+
+    // push if not full
+    int push(CLIPSFactOp &&op){
+        std::unique_lock<std::mutex> l(mtx);
+        if (q.size() >= q_max) {
+            ++dropped;
+            return 1;
+        }
+        q.push_back(std::move(op));
+        l.unlock();
+        cv.notify_one();
+        return 0;
+    }
+};
+
 /************************/
 /* CLIPS ENV Descriptor */
 /************************/
@@ -125,6 +190,8 @@ struct CLIPSEnvDescriptor {
     CLIPSEnvData data;
     // env2env interface
     CLIPSEnv2EnvDescriptor env2env_d;
+    // event mode (nullptr - interval mode)
+    std::shared_ptr<CLIPSEnvEvents> events;
 };
 
 
@@ -191,6 +258,12 @@ public:
             f(it->second);
     }
 
+    void clear(){
+        // lock
+        std::unique_lock<std::mutex> l(mtx);
+        data.clear();
+    }
+
     CLIPSSharedVariant &recv(const std::string &dst){
         // lock
         std::unique_lock<std::mutex> l(mtx);
@@ -228,6 +301,11 @@ private:
 /***************/
 char hostname[HOST_NAME_MAX + 1];
 CLIPSEnv2Env env2env;
+// env threads
+std::vector<std::thread> env_threads;
+// interval mode sleep (woken up on terminate)
+std::mutex env_mtx;
+std::condition_variable env_cv;
 
 /****************/
 /* Push via GDT */
@@ -669,6 +747,163 @@ extern "C" void mink_clips_env_pop(Environment *env, UDFContext *uctx, UDFValue
 }
 
 
+/************************/
+/* CLIPS string literal */
+/************************/
+static void clips_quote(std::string &out, boost::string_view s){
+    out += '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    out += '"';
+}
+
+/******************/
+/* Signal handler */
+/******************/
+// Each row of signal data is asserted as transient
+// (mink_event "<signal>" "<key>" "<value>" ...) fact
+class CLIPS_signal_hndlr: public mink_utils::SignalHandler {
+public:
+    CLIPS_signal_hndlr(const std::string &sig,
+                       std::shared_ptr<CLIPSEnvEvents> ev)
+        : sig_(sig)
+        , ev_(ev) {}
+
+    std::string operator()(mink_utils::PluginData &d) const {
+        for (std::size_t r = 0; r < d.size(); r++) {
+            std::string f = "(mink_event ";
+            clips_quote(f, sig_);
+            for (std::size_t c = 0; c < d.row_size(r); c++) {
+                const mink_utils::PluginColumn *col = d.get(r, c);
+                f += ' ';
+                clips_quote(f, col->key);
+                f += ' ';
+                clips_quote(f, col->value.str());
+            }
+            f += ')';
+            if (ev_->push(CLIPSFactOp{CLIPSFactOp::FO_EVENT, std::move(f)}))
+                break;
+        }
+        return "";
+    }
+
+private:
+    std::string sig_;
+    std::shared_ptr<CLIPSEnvEvents> ev_;
+};
+
+// registered signal handlers (owned by plugin)
+std::vector<CLIPS_signal_hndlr *> sig_hndlrs;
+
+/*******************************/
+/* CLIPS event mode (run loop) */
+/*******************************/
+static void clips_run_events(CLIPSEnvDescriptor *ed){
+    CLIPSEnvEvents &ev = *ed->events;
+    // managed facts
+    std::unordered_map<std::string, Fact *> facts;
+    // transient facts (current cycle)
+    std::vector<Fact *> tr;
+    // pending ops
+    std::deque<CLIPSFactOp> ops;
+    // wait limit (termination check)
+    auto w = stdc::milliseconds(ed->interval > 0 ? ed->interval : 1000);
+
+    while (!mink::CURRENT_DAEMON->DAEMON_TERMINATED && ed->active->load()){
+        // wait for ops
+        {
+            std::unique_lock<std::mutex> l(ev.mtx);
+            ev.cv.wait_for(l, w, [&ev, ed] {
+                return !ev.q.empty() || !ed->active->load();
+            });
+            ops.swap(ev.q);
+        }
+        if (ops.empty())
+            continue;
+
+        // apply ops (incremental)
+        for (auto &op : ops) {
+            if (op.type == CLIPSFactOp::FO_RETRACT) {
+                auto it = facts.find(op.fact);
+                if (it == facts.end())
+                    continue;
+                // could have been retracted by rules
+                if (FactExistp(it->second))
+                    Retract(it->second);
+                ReleaseFact(it->second);
+                facts.erase(it);
+                ++ev.retracted;
+                continue;
+            }
+            // persistent fact already asserted
+            if (op.type == CLIPSFactOp::FO_ASSERT) {
+                auto it = facts.find(op.fact);
+                if (it != facts.end()) {
+                    if (FactExistp(it->second))
+                        continue;
+                    // retracted by rules, assert again
+                    ReleaseFact(it->second);
+                    facts.erase(it);
+                }
+            }
+            Fact *f = AssertString(ed->env, op.fact.c_str());
+            if (!f) {
+                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                          "plg_clips: [%s: cannot assert fact]",
+                                          ed->name.c_str());
+                continue;
+            }
+            RetainFact(f);
+            if (op.type == CLIPSFactOp::FO_ASSERT)
+                facts.emplace(std::move(op.fact), f);
+            else
+                tr.push_back(f);
+            ++ev.asserted;
+        }
+        ops.clear();
+        ev.facts = facts.size();
+
+        // run only if agenda is not empty
+        uint64_t acts = 0;
+        for (Activation *a = GetNextActivation(ed->env, nullptr);
+             a;
+             a = GetNextActivation(ed->env, a))
+            ++acts;
+        if (acts > 0) {
+            auto ts = stdc::steady_clock::now();
+            long long n = Run(ed->env, -1);
+            uint64_t us = stdc::duration_cast<stdc::microseconds>(
+                stdc::steady_clock::now() - ts).count();
+            ++ev.cycles;
+            ev.activations += acts;
+            ev.fired += (n > 0 ? n : 0);
+            ev.last_run_us = us;
+            ev.run_us += us;
+            mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                                      "plg_clips: [%s: facts = %lu, activations = %lu, "
+                                      "fired = %lld, run = %lu usec]",
+                                      ed->name.c_str(),
+                                      ev.facts.load(),
+                                      acts,
+                                      n,
+                                      us);
+        }
+
+        // retract transient facts
+        for (Fact *f : tr) {
+            if (FactExistp(f))
+                Retract(f);
+            ReleaseFact(f);
+        }
+        tr.clear();
+    }
+    for (auto &f : facts)
+        ReleaseFact(f.second);
+}
+
 /*********************/
 /* CLIPS Environment */
 /*********************/
@@ -748,13 +983,26 @@ static void thread_clips_env(CLIPSEnvDescriptor *ed){
     Load(ed->env, ed->r_path.c_str());
     Reset(ed->env);
 
+    // event mode
+    if (ed->events) {
+        clips_run_events(ed);
+        DestroyEnvironment(ed->env);
+        ed->env = nullptr;
+        return;
+    }
+
     // run
     while (!mink::CURRENT_DAEMON->DAEMON_TERMINATED && ed->active->load()){
         Run(ed->env, -1);
-        std::this_thread::sleep_for(stdc::milliseconds(ed->interval));
+        std::unique_lock<std::mutex> l(env_mtx);
+        env_cv.wait_for(l, stdc::milliseconds(ed->interval), [ed] {
+            return !ed->active->load();
+        });
+        l.unlock();
         if(ed->rbr) Reset(ed->env);
     }
-
+    DestroyEnvironment(ed->env);
+    ed->env = nullptr;
 }
 
 /********************************/
@@ -812,6 +1060,10 @@ static int process_cfg(mink_utils::PluginManager *pm) {
             }
             // get clear_before_run
             auto j_rbr = (*it)["reset_before_run"];
+            // get mode (interval or event)
+            auto j_mode = it->value("mode", "interval");
+            if (j_mode != "interval" && j_mode != "event")
+                throw std::invalid_argument("invalid mode");
             // get rules file
             auto j_rpath = (*it)["rpath"];
             // check rules file size
@@ -829,9 +1081,33 @@ static int process_cfg(mink_utils::PluginManager *pm) {
                 j_rbr.get<json::boolean_t>(),
                 std::make_shared<std::atomic_bool>(j_as.get<json::boolean_t>()),
                 j_rpath.get<std::string>(),
-                { .pm = pm, .env2env = &env2env }
+                { .pm = pm, .env2env = &env2env },
+                {},
+                nullptr
             };
 
+            // event mode (facts from CMD_RUN_RULES
+            // and plugin signals)
+            if (j_mode == "event") {
+                ed.events = std::make_shared<CLIPSEnvEvents>();
+                ed.events->q_max = it->value("queue", ed.events->q_max);
+                // signal subscriptions
+                if (it->find("events") != it->end()) {
+                    auto j_events = it->at("events");
+                    for (auto it_ev = j_events.begin(); it_ev != j_events.end(); ++it_ev) {
+                        auto ev_name = it_ev->get<std::string>();
+                        auto h = new CLIPS_signal_hndlr(ev_name, ed.events);
+                        sig_hndlrs.push_back(h);
+                        if (pm->register_signal(ev_name, h))
+                            throw std::invalid_argument("cannot register event handler");
+                        mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                                                  "plg_clips: [attaching '%s' to '%s' event]",
+                                                  ed.name.c_str(),
+                                                  ev_name.c_str());
+                    }
+                }
+            }
+
             // add to list
             env2env.new_envd(ed);
         }
@@ -863,13 +1139,12 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
     // create environments
     env2env.process_envs([](CLIPSEnvDescriptor &d){
         // check if ENV should auto-start
-        if (d.auto_start && d.interval > 0) {
+        if (d.auto_start && (d.interval > 0 || d.events)) {
             mink::CURRENT_DAEMON->log(mink::LLT_INFO,
                                       "plg_clips: [starting ENV (%s)]",
                                       d.name.c_str());
 
-            std::thread th(&thread_clips_env, &d);
-            th.detach();
+            env_threads.push_back(std::thread(&thread_clips_env, &d));
         }
     });
 
@@ -880,9 +1155,190 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
 /* terminate handler */
 /*********************/
 extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // stop envs (interval and event mode)
+    {
+        std::unique_lock<std::mutex> l(env_mtx);
+        env2env.process_envs([](CLIPSEnvDescriptor &d) {
+            if (d.events) {
+                std::unique_lock<std::mutex> l_ev(d.events->mtx);
+                d.active->store(false);
+                l_ev.unlock();
+                d.events->cv.notify_one();
+            } else {
+                d.active->store(false);
+            }
+        });
+    }
+    env_cv.notify_all();
+    for (auto &th : env_threads)
+        th.join();
+    env_threads.clear();
+    // signal handlers are already detached
+    for (auto h : sig_hndlrs)
+        delete h;
+    sig_hndlrs.clear();
+    // envs are re-created by next init
+    env2env.clear();
     return 0;
 }
 
+/*****************/
+/* CMD_RUN_RULES */
+/*****************/
+static int do_run_rules(const std::string &env,
+                        std::deque<CLIPSFactOp> &ops,
+                        json *j_res){
+    // find event mode env
+    CLIPSEnvDescriptor &ed = env2env.get_envd(env);
+    if (!ed.events)
+        throw std::invalid_argument("env not in event mode");
+    // queue ops
+    for (auto &op : ops) {
+        if (ed.events->push(std::move(op)))
+            throw std::invalid_argument("env queue is full");
+    }
+    // stats
+    if (j_res) {
+        CLIPSEnvEvents &ev = *ed.events;
+        (*j_res)["facts"] = ev.facts.load();
+        (*j_res)["asserted"] = ev.asserted.load();
+        (*j_res)["retracted"] = ev.retracted.load();
+        (*j_res)["cycles"] = ev.cycles.load();
+        (*j_res)["activations"] = ev.activations.load();
+        (*j_res)["fired"] = ev.fired.load();
+        (*j_res)["last_run_us"] = ev.last_run_us.load();
+        (*j_res)["run_us"] = ev.run_us.load();
+        (*j_res)["dropped"] = ev.dropped.load();
+    }
+    return 0;
+}
+
+/******************************/
+/* local CMD_RUN_RULES (JRPC) */
+/******************************/
+// params: {"env": "<name>", "assert": ["(f 1)", ...],
+//          "retract": [...], "event": [...]}
+static void impl_local_run_rules(Jrpc &jrpc, json *j_d){
+    const json &j_p = jrpc.get_params();
+    auto it = j_p.find("env");
+    if (it == j_p.end() || !it->is_string())
+        throw std::invalid_argument("env is missing");
+
+    std::deque<CLIPSFactOp> ops;
+    auto add_ops = [&j_p, &ops](const char *k, CLIPSFactOp::Type t) {
+        auto it = j_p.find(k);
+        if (it == j_p.end())
+            return;
+        if (it->is_string()) {
+            ops.push_back(CLIPSFactOp{t, it->get<std::string>()});
+            return;
+        }
+        for (auto &f : *it)
+            ops.push_back(CLIPSFactOp{t, f.get<std::string>()});
+    };
+    add_ops("retract", CLIPSFactOp::FO_RETRACT);
+    add_ops("assert", CLIPSFactOp::FO_ASSERT);
+    add_ops("event", CLIPSFactOp::FO_EVENT);
+
+    json j_res = json::object();
+    do_run_rules(it->get<std::string>(), ops, &j_res);
+    (*j_d)[Jrpc::RESULT_] = j_res;
+}
+
+/**********************************/
+/* local CMD_RUN_RULES (standard) */
+/**********************************/
+// rows: {"env": "<name>", "op": "assert|retract|event",
+//        "fact": "(f 1)"}
+static void impl_local_run_rules(mink_utils::Plugin_data_std *data){
+    // ops per env
+    std::map<std::string, std::deque<CLIPSFactOp>> ops;
+    for (auto &row : *data) {
+        auto it_env = row.find("env");
+        auto it_op = row.find("op");
+        auto it_f = row.find("fact");
+        if (it_env == row.end() || it_op == row.end() || it_f == row.end())
+            continue;
+        CLIPSFactOp::Type t;
+        if (it_op->second == "assert")
+            t = CLIPSFactOp::FO_ASSERT;
+        else if (it_op->second == "retract")
+            t = CLIPSFactOp::FO_RETRACT;
+        else if (it_op->second == "event")
+            t = CLIPSFactOp::FO_EVENT;
+        else
+            continue;
+        ops[it_env->second].push_back(CLIPSFactOp{t, it_f->second});
+    }
+    for (auto &o : ops)
+        do_run_rules(o.first, o.second, nullptr);
+}
+
+/*************************/
+/* local command handler */
+/*************************/
+extern "C" int run_local(mink_utils::PluginManager *pm,
+                         mink_utils::PluginDescriptor *pd,
+                         int cmd_id,
+                         mink_utils::PluginInputData &p_id){
+    // sanity/type check
+    if (!p_id.data())
+        return -1;
+
+    // UNIX socket local interface
+    if(p_id.type() == mink_utils::PLG_DT_JSON_RPC){
+        json *j_d = static_cast<json *>(p_id.data());
+        int id = -1;
+        int cmd_id = -1;
+        try {
+            // create json rpc parser
+            Jrpc jrpc(*j_d);
+            // verify
+            jrpc.verify(true);
+            // get method
+            cmd_id = jrpc.get_method_id();
+            // get JSON RPC id
+            id = jrpc.get_id();
+            // check command id
+            switch (cmd_id) {
+                case gdt_grpc::CMD_RUN_RULES:
+                    impl_local_run_rules(jrpc, j_d);
+                    break;
+
+                default:
+                    break;
+            }
+
+        } catch (std::exception &e) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plg_clips: [%s]",
+                                      e.what());
+            auto j_err = Jrpc::gen_err(id, e.what());
+            (*j_d)[Jrpc::ERROR_] = j_err[Jrpc::ERROR_];
+        }
+        return 0;
+    }
+
+    // plugin2plugin local interface (standard)
+    if (p_id.type() == mink_utils::PLG_DT_STANDARD) {
+        auto *plg_d = static_cast<mink_utils::Plugin_data_std *>(p_id.data());
+        try {
+            if (cmd_id == gdt_grpc::CMD_RUN_RULES)
+                impl_local_run_rules(plg_d);
+
+        } catch (std::exception &e) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plg_clips: [%s]",
+                                      e.what());
+            return -1;
+        }
+        return 0;
+    }
+
+    // unknown interface
+    return -1;
+}
+
 /*******************/
 /* command handler */
 /*******************/
@@ -895,6 +1351,14 @@ extern "C" int run(mink_utils::PluginManager *pm,
     if (!(p_id.data() && p_id.type() == mink_utils::PLG_DT_GDT))
         return 1;
 
+    // CMD_RUN_RULES is available on local interfaces
+    // only (UNIX socket and plugin2plugin)
+    if (cmd_id == gdt_grpc::CMD_RUN_RULES) {
+        auto smsg = static_cast<gdt::ServiceMessage *>(p_id.data());
+        smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_command_id);
+        smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_error,
+                             std::to_string(mink::error::EC_UNKNOWN).c_str());
+    }
     return 0;
 }
 
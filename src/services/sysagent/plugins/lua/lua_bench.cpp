@@ -0,0 +1,110 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include "lua_state_pool.h"
+
+using bench_clock = std::chrono::steady_clock;
+
+// CMD_LUA_CALL without pool (new state, script
+// is read and compiled for every call)
+static int call_fresh(const std::string &path) {
+    lua_State *L = luaL_newstate();
+    if (!L)
+        return 1;
+    luaL_openlibs(L);
+    std::string lua_s;
+    std::string l;
+    std::ifstream lua_s_fs(path);
+    while (std::getline(lua_s_fs, l)) {
+        lua_s += l + "\n";
+    }
+    if (luaL_loadstring(L, lua_s.c_str())) {
+        lua_close(L);
+        return 1;
+    }
+    lua_pushlightuserdata(L, nullptr);
+    lua_pushlightuserdata(L, nullptr);
+    int r = lua_pcall(L, 2, 1, 0);
+    lua_close(L);
+    return r;
+}
+
+// CMD_LUA_CALL with warm state and cached bytecode
+static int call_pooled(Lua_state_pool &pool, const std::string &path) {
+    Lua_state_pool::State st;
+    std::string err;
+    if (pool.acquire(path, st, err))
+        return 1;
+    Lua_state_pool::push_chunk(st.L);
+    lua_pushlightuserdata(st.L, nullptr);
+    lua_pushlightuserdata(st.L, nullptr);
+    int r = lua_pcall(st.L, 2, 1, 0);
+    pool.release(path, st);
+    return r;
+}
+
+// run n calls, return calls/sec
+template<typename F>
+static double run_bench(int n, uint64_t &failed, F f) {
+    failed = 0;
+    auto start = bench_clock::now();
+    for (int i = 0; i < n; i++) {
+        if (f())
+            ++failed;
+    }
+    double sec = std::chrono::duration<double>(bench_clock::now() - start).count();
+    return n / sec;
+}
+
+static void print_help() {
+    std::cout << "luab - CMD_LUA_CALL benchmark (calls/sec, fresh vs. pooled state)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << " -s\tLua script (called with nil plugin manager and data)" << std::endl;
+    std::cout << " -n\tnumber of calls [100000]" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::string path;
+    int n = 100000;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:n:h")) != -1) {
+        switch (opt) {
+            case 's':
+                path.assign(optarg);
+                break;
+            case 'n':
+                n = atoi(optarg);
+                break;
+            default:
+                print_help();
+                return 1;
+        }
+    }
+    if (path.empty() || n < 1) {
+        print_help();
+        return 1;
+    }
+
+    Lua_state_pool pool;
+    uint64_t failed = 0;
+    std::cout << "mode\tcalls/s\tfailed" << std::endl;
+    double cps = run_bench(n, failed, [&path] { return call_fresh(path); });
+    std::cout << "fresh\t" << (uint64_t)cps << "\t" << failed << std::endl;
+    cps = run_bench(n, failed, [&pool, &path] { return call_pooled(pool, path); });
+    std::cout << "pooled\t" << (uint64_t)cps << "\t" << failed << std::endl;
+    return 0;
+}
@@ -0,0 +1,296 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef SYSAGENTD_LUA_STATE_POOL_H
+#define SYSAGENTD_LUA_STATE_POOL_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <lua.hpp>
+
+/******************/
+/* LUA state pool */
+/******************/
+// Warm Lua states per script; compiled chunk is kept
+// at stack index 1, bytecode is cached by path and mtime.
+// Shared tables (globals, libraries, package.loaded and
+// string metatable) are restored when state is returned
+// to pool, changes made by one call are not visible to
+// the next one
+class Lua_state_pool {
+public:
+    struct State {
+        lua_State *L = nullptr;
+        uint64_t gen = 0;
+        uint32_t uses = 0;
+    };
+
+    Lua_state_pool() = default;
+    Lua_state_pool(const Lua_state_pool &o) = delete;
+    Lua_state_pool &operator=(const Lua_state_pool &o) = delete;
+
+    ~Lua_state_pool() {
+        for (auto &s : scripts_) {
+            for (auto &st : s.second.idle)
+                lua_close(st.L);
+        }
+    }
+
+    // get warm state (0 for success, error
+    // message is set on failure)
+    int acquire(const std::string &path, State &st, std::string &err) {
+        std::unique_lock<std::mutex> l(mtx_);
+        Script &sc = scripts_[path];
+        // check for script changes (throttled)
+        auto now = std::chrono::steady_clock::now();
+        if (sc.bc.empty() || now - sc.ts > std::chrono::milliseconds(MTIME_CHECK_MS)) {
+            sc.ts = now;
+            struct stat fs;
+            if (stat(path.c_str(), &fs)) {
+                err = "cannot stat Lua script";
+                return 1;
+            }
+            if (sc.bc.empty() ||
+                fs.st_mtim.tv_sec != sc.mtime.tv_sec ||
+                fs.st_mtim.tv_nsec != sc.mtime.tv_nsec) {
+                // compile, states with old chunk
+                // are not reused
+                if (compile(path, sc, err))
+                    return 1;
+                sc.mtime = fs.st_mtim;
+                ++sc.gen;
+                for (auto &i : sc.idle)
+                    lua_close(i.L);
+                sc.idle.clear();
+            }
+        }
+        // idle state
+        if (!sc.idle.empty()) {
+            st = sc.idle.back();
+            sc.idle.pop_back();
+            return 0;
+        }
+        // new state (precompiled chunk), created
+        // outside of pool lock
+        std::string bc = sc.bc;
+        st.gen = sc.gen;
+        st.uses = 0;
+        l.unlock();
+        st.L = luaL_newstate();
+        if (!st.L) {
+            err = "cannot create Lua state";
+            return 1;
+        }
+        luaL_openlibs(st.L);
+        if (luaL_loadbuffer(st.L, bc.data(), bc.size(), path.c_str())) {
+            err = lua_tostring(st.L, -1);
+            lua_close(st.L);
+            return 1;
+        }
+        snapshot(st.L);
+        return 0;
+    }
+
+    // return state to pool
+    void release(const std::string &path, State &st) {
+        // chunk only
+        lua_settop(st.L, 1);
+        ++st.uses;
+        std::unique_lock<std::mutex> l(mtx_);
+        Script &sc = scripts_[path];
+        // stale, pool full or used too many times
+        // (bounds heap growth)
+        if (st.gen != sc.gen || sc.idle.size() >= MAX_IDLE || st.uses >= MAX_USES) {
+            l.unlock();
+            lua_close(st.L);
+            return;
+        }
+        l.unlock();
+        // undo changes to shared tables
+        restore(st.L);
+        l.lock();
+        sc.idle.push_back(st);
+    }
+
+    // push chunk with fresh globals table; globals
+    // set by script do not leak to next call
+    static void push_chunk(lua_State *L) {
+        lua_pushvalue(L, 1);
+        lua_newtable(L);
+        lua_newtable(L);
+        lua_pushvalue(L, LUA_GLOBALSINDEX);
+        lua_setfield(L, -2, "__index");
+        lua_setmetatable(L, -2);
+        lua_setfenv(L, -2);
+    }
+
+    enum Limits {
+        MAX_IDLE = 8,
+        MAX_USES = 10000,
+        MTIME_CHECK_MS = 1000
+    };
+
+private:
+    struct Script {
+        // bytecode
+        std::string bc;
+        timespec mtime{0, 0};
+        std::chrono::steady_clock::time_point ts;
+        uint64_t gen = 0;
+        std::vector<State> idle;
+    };
+
+    static int bc_writer(lua_State *L, const void *p, size_t sz, void *ud) {
+        static_cast<std::string *>(ud)->append(static_cast<const char *>(p), sz);
+        return 0;
+    }
+
+    // compile script to bytecode
+    static int compile(const std::string &path, Script &sc, std::string &err) {
+        std::stringstream ss;
+        std::ifstream lua_s_fs(path);
+        ss << lua_s_fs.rdbuf();
+        std::string src = ss.str();
+
+        lua_State *L = luaL_newstate();
+        if (!L) {
+            err = "cannot create Lua state";
+            return 1;
+        }
+        if (luaL_loadbuffer(L, src.data(), src.size(), path.c_str())) {
+            err = lua_tostring(L, -1);
+            lua_close(L);
+            return 1;
+        }
+        std::string bc;
+        lua_dump(L, &bc_writer, &bc);
+        lua_close(L);
+        sc.bc = std::move(bc);
+        return 0;
+    }
+
+    // add {table, copy, metatable} entry to snapshot
+    // list, table is popped
+    static void snap_add(lua_State *L, int lst) {
+        if (!lua_istable(L, -1)) {
+            lua_pop(L, 1);
+            return;
+        }
+        int t = lua_gettop(L);
+        lua_createtable(L, 3, 0);
+        lua_pushvalue(L, t);
+        lua_rawseti(L, -2, 1);
+        // shallow copy
+        lua_newtable(L);
+        lua_pushnil(L);
+        while (lua_next(L, t)) {
+            lua_pushvalue(L, -2);
+            lua_insert(L, -2);
+            lua_rawset(L, -4);
+        }
+        lua_rawseti(L, -2, 2);
+        if (lua_getmetatable(L, t))
+            lua_rawseti(L, -2, 3);
+        lua_rawseti(L, lst, lua_objlen(L, lst) + 1);
+        lua_pop(L, 1);
+    }
+
+    // snapshot of shared tables (kept in registry)
+    static void snapshot(lua_State *L) {
+        static const char *libs[] = { "string", "table", "math", "io", "os",
+                                      "package", "coroutine", "debug", "bit",
+                                      "jit", nullptr };
+        lua_newtable(L);
+        int lst = lua_gettop(L);
+        // globals
+        lua_pushvalue(L, LUA_GLOBALSINDEX);
+        snap_add(L, lst);
+        // libraries
+        for (const char **n = libs; *n; ++n) {
+            lua_getglobal(L, *n);
+            snap_add(L, lst);
+        }
+        // package.loaded
+        lua_getglobal(L, "package");
+        if (lua_istable(L, -1))
+            lua_getfield(L, -1, "loaded");
+        else
+            lua_pushnil(L);
+        lua_remove(L, -2);
+        snap_add(L, lst);
+        // string metatable
+        lua_pushliteral(L, "");
+        if (!lua_getmetatable(L, -1))
+            lua_pushnil(L);
+        lua_remove(L, -2);
+        snap_add(L, lst);
+        lua_setfield(L, LUA_REGISTRYINDEX, SNAP_KEY);
+    }
+
+    // restore shared tables from snapshot (added keys
+    // are removed, changed and removed keys are reset)
+    static void restore(lua_State *L) {
+        lua_getfield(L, LUA_REGISTRYINDEX, SNAP_KEY);
+        int lst = lua_gettop(L);
+        int n = lua_objlen(L, lst);
+        for (int i = 1; i <= n; i++) {
+            lua_rawgeti(L, lst, i);
+            lua_rawgeti(L, -1, 1);
+            lua_rawgeti(L, -2, 2);
+            int t = lua_gettop(L) - 1;
+            int c = t + 1;
+            // added or changed (only existing fields
+            // are assigned during traversal)
+            lua_pushnil(L);
+            while (lua_next(L, t)) {
+                lua_pushvalue(L, -2);
+                lua_rawget(L, c);
+                if (!lua_rawequal(L, -1, -2)) {
+                    lua_pushvalue(L, -3);
+                    lua_insert(L, -2);
+                    lua_rawset(L, t);
+                } else {
+                    lua_pop(L, 1);
+                }
+                lua_pop(L, 1);
+            }
+            // removed
+            lua_pushnil(L);
+            while (lua_next(L, c)) {
+                lua_pushvalue(L, -2);
+                lua_rawget(L, t);
+                if (lua_isnil(L, -1)) {
+                    lua_pushvalue(L, -3);
+                    lua_pushvalue(L, -3);
+                    lua_rawset(L, t);
+                }
+                lua_pop(L, 2);
+            }
+            // metatable (nil removes)
+            lua_rawgeti(L, t - 1, 3);
+            lua_setmetatable(L, t);
+            lua_pop(L, 3);
+        }
+        lua_pop(L, 1);
+    }
+
+    static constexpr const char *SNAP_KEY = "mink_pool_snapshot";
+
+    std::mutex mtx_;
+    std::map<std::string, Script> scripts_;
+};
+
+#endif /* ifndef SYSAGENTD_LUA_STATE_POOL_H */
@@ -18,7 +18,11 @@ ffi.cdef [[
     // structures
     typedef struct {
         const char *key;
+        size_t key_sz;
+        int type;
         const char *value;
+        size_t value_sz;
+        double num;
     } mink_cdata_column_t;
 
     // functions
@@ -35,6 +39,14 @@ ffi.cdef [[
                                      const char *k,
                                      const char *v,
                                      void *p);
+    void mink_lua_cmd_data_add_num(const int r,
+                                   const char *k,
+                                   double v,
+                                   void *p);
+    void mink_lua_cmd_data_add_int(const int r,
+                                   const char *k,
+                                   int64_t v,
+                                   void *p);
     char *mink_lua_signal(const char *s, const char *d, void *md);
     int mink_lua_cmd_call(void *md,
                           int argc,
@@ -45,6 +57,14 @@ ffi.cdef [[
 -- ************
 -- * wrappers *
 -- ************
+-- typed column value (PVT_INT = 1, PVT_DOUBLE = 2)
+local function column_value(c)
+    if c.type == 1 or c.type == 2 then
+        return tonumber(c.num)
+    end
+    return ffi.string(c.value, c.value_sz)
+end
+
 local function w_mink_lua_cmd_call(cmd)
     -- array length
     local l = #cmd
@@ -78,14 +98,14 @@ local function w_mink_lua_cmd_call(cmd)
                 -- get column key/value
                 local c = C.mink_lua_cmd_data_get_column(i, j, c_data)
                 -- add column to lua table
-                if c.value ~= nil then
+                if c.type ~= 0 then
                     local k = 1
-                    -- update key, if not null
-                    if c.key ~= nil and string.len(ffi.string(c.key)) > 0 then
-                        k = ffi.string(c.key)
+                    -- update key, if not empty
+                    if c.key_sz > 0 then
+                        k = ffi.string(c.key, c.key_sz)
                     end
                     -- add column
-                    res[i + 1][k] = ffi.string(c.value)
+                    res[i + 1][k] = column_value(c)
                 end
             end
         end
@@ -116,14 +136,14 @@ local function w_mink_lua_get_args()
             -- get column key/value
             local c = C.mink_lua_cmd_data_get_column(i, j, c_data)
             -- add column to lua table
-            if c.value ~= nil then
+            if c.type ~= 0 then
                 local k = 1
-                -- update key, if not null
-                if c.key ~= nil and string.len(ffi.string(c.key)) > 0 then
-                    k = ffi.string(c.key)
+                -- update key, if not empty
+                if c.key_sz > 0 then
+                    k = ffi.string(c.key, c.key_sz)
                 end
                 -- add column
-                res[i + 1][k] = ffi.string(c.value)
+                res[i + 1][k] = column_value(c)
             end
         end
     end
@@ -137,8 +157,17 @@ local function w_mink_lua_set_result(str, r, c)
     local c_data = mink.args[2]
     -- add 1 row
     C.mink_lua_cmd_data_add_rows(c_data, 1)
-    -- add column
-    C.mink_lua_cmd_data_add_colum(1, "", str, c_data)
+    -- add column (integer, number or string)
+    if type(str) == "number" then
+        -- integral values (exactly representable)
+        if str == math.floor(str) and str >= -2^53 and str <= 2^53 then
+            C.mink_lua_cmd_data_add_int(1, "", str, c_data)
+        else
+            C.mink_lua_cmd_data_add_num(1, "", str, c_data)
+        end
+    else
+        C.mink_lua_cmd_data_add_colum(1, "", str, c_data)
+    end
 end
 
 local function w_mink_lua_signal(s, d)
@@ -25,29 +25,36 @@ using Jrpc = json_rpc::JsonRpc;
 /*********/
 typedef struct {
     const char *key;
+    size_t key_sz;
+    // mink_utils::PluginValueType
+    int type;
+    // PVT_STRING, PVT_BYTES
     const char *value;
+    size_t value_sz;
+    // PVT_INT, PVT_DOUBLE
+    double num;
 } mink_cdata_column_t;
 
 /*******************/
 /* Free plugin res */
 /*******************/
 extern "C" void mink_lua_free_res(void *p) {
-    delete static_cast<mink_utils::Plugin_data_std *>(p);
+    delete static_cast<mink_utils::PluginData *>(p);
 }
 
 /**************************/
 /* Create new plugin data */
 /**************************/
 extern "C" void *mink_lua_new_cmd_data() {
-    return new mink_utils::Plugin_data_std();
+    return new mink_utils::PluginData();
 }
 
 /*****************************/
 /* Get plugin data row count */
 /*****************************/
 extern "C" size_t mink_lua_cmd_data_sz(void *p) {
-    // cast (unsafe) to standard plugin data type
-    auto *d = static_cast<mink_utils::Plugin_data_std *>(p);
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
     // number of rows
     return d->size();
 }
@@ -56,12 +63,10 @@ extern "C" size_t mink_lua_cmd_data_sz(void *p) {
 /* Get plugin data columns count for specific row */
 /**************************************************/
 extern "C" size_t mink_lua_cmd_data_row_sz(const int r, void *p) {
-    // cast (unsafe) to standard plugin data type
-    auto *d = static_cast<mink_utils::Plugin_data_std *>(p);
-    // verify row index
-    if (r >= d->size()) return 0;
-    // return column count for rox index
-    return d->at(r).size();
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
+    // column count for row index (0 if not found)
+    return d->row_size(r);
 }
 
 /********************************/
@@ -70,33 +75,42 @@ extern "C" size_t mink_lua_cmd_data_row_sz(const int r, void *p) {
 extern "C" mink_cdata_column_t mink_lua_cmd_data_get_column(const int r,
                                                             const int c,
                                                             void *p) {
-    // get row count
-    size_t rc = mink_lua_cmd_data_sz(p);
-    // sanity check (rows)
-    if (rc <= r) return mink_cdata_column_t{nullptr, nullptr};
-    // cast (unsafe) to standard plugin data type
-    auto *d = static_cast<mink_utils::Plugin_data_std *>(p);
-    // get row
-    auto row = d->cbegin() + r;
-    // sanity check (columns)
-    if (row->size() <= c) return mink_cdata_column_t{nullptr, nullptr};
+    mink_cdata_column_t res{nullptr, 0, mink_utils::PVT_NONE, nullptr, 0, 0};
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
     // get column
-    auto column = row->cbegin();
-    // advance to index c
-    std::advance(column, c);
-    // return column value
-    return mink_cdata_column_t{column->first.c_str(), column->second.c_str()};
+    const mink_utils::PluginColumn *col = d->get(r, c);
+    if (!col) return res;
+    res.key = col->key.data();
+    res.key_sz = col->key.size();
+    res.type = col->value.type;
+    switch (col->value.type) {
+        case mink_utils::PVT_INT:
+            res.num = static_cast<double>(col->value.i);
+            break;
+        case mink_utils::PVT_DOUBLE:
+            res.num = col->value.d;
+            break;
+        case mink_utils::PVT_STRING:
+        case mink_utils::PVT_BYTES:
+            res.value = col->value.s.data();
+            res.value_sz = col->value.s.size();
+            break;
+        default:
+            break;
+    }
+    return res;
 }
 
 /***********/
 /* Add row */
 /***********/
 extern "C" void mink_lua_cmd_data_add_rows(void *p, int sz) {
-    // cast (unsafe) to standard plugin data type
-    auto *d = static_cast<mink_utils::Plugin_data_std *>(p);
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
     // add rows
     for (int i = 0; i < sz; i++)
-        d->push_back(std::map<std::string, std::string>());
+        d->add_row();
 }
 
 /**************************************/
@@ -106,18 +120,36 @@ extern "C" void mink_lua_cmd_data_add_colum(const int r,
                                             const char *k,
                                             const char *v,
                                             void *p) {
-    // get row count
-    size_t rc = mink_lua_cmd_data_sz(p);
-    // sanity check (rows)
-    if (rc <= r) return;
-    // cast (unsafe) to standard plugin data type
-    auto *d = static_cast<mink_utils::Plugin_data_std *>(p);
-    // get row
-    auto row = d->begin() + r;
-    // key shoud not be present
-    if (row->find(k) != row->cend()) return;
-    // add
-    row->insert(std::make_pair(k, v));
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
+    // add (key should not be present)
+    d->add(r, k, v);
+}
+
+/*********************************************/
+/* Add numeric column value to specific row  */
+/*********************************************/
+extern "C" void mink_lua_cmd_data_add_num(const int r,
+                                          const char *k,
+                                          double v,
+                                          void *p) {
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
+    // add (key should not be present)
+    d->add(r, k, v);
+}
+
+/*********************************************/
+/* Add integer column value to specific row  */
+/*********************************************/
+extern "C" void mink_lua_cmd_data_add_int(const int r,
+                                          const char *k,
+                                          int64_t v,
+                                          void *p) {
+    // cast (unsafe) to plugin data type
+    auto *d = static_cast<mink_utils::PluginData *>(p);
+    // add (key should not be present)
+    d->add(r, k, v);
 }
 
 /**********/
@@ -129,9 +161,9 @@ extern "C" char *mink_lua_signal(const char *s, const char *d, void *md) {
     // check signal
     if (!s)
         return strdup("<TOPIC UNDEFINED>");
-    // process signal
-    mink_utils::Plugin_data_std e_d;
-    e_d.push_back({{"", (d ? d : "")}});
+    // process signal (lua string is valid during call)
+    mink_utils::PluginData e_d;
+    e_d.add_ref(e_d.add_row(), "", (d ? d : ""));
     return strdup(pm->process_signal(s, e_d).c_str());
 }
 
@@ -148,22 +180,21 @@ extern "C" int mink_lua_cmd_call(void *md,
     if (argc < 1) return -1;
     // output check
     if (!out) return -2;
-    // cmd data
-    auto cmd_data = static_cast<mink_utils::Plugin_data_std *>(out);
+    // cmd data (standard plugin data for target plugin)
+    mink_utils::Plugin_data_std cmd_data;
     // get command id
     int cmd_id = Jrpc::get_method_id(args[0]);
     // cmd arguments
     for (int i = 1; i < argc; i++) {
-        // column map
-        std::map<std::string, std::string> cmap;
-        // insert columns
-        cmap.insert(std::make_pair("", args[i]));
         // add row
-        cmd_data->push_back(cmap);
+        cmd_data.push_back({{"", args[i]}});
     }
 
     // run plugin method
-    return pm->run(cmd_id,
-                   mink_utils::PluginInputData(mink_utils::PLG_DT_STANDARD, cmd_data),
-                   true);
+    int r = pm->run(cmd_id,
+                    mink_utils::PluginInputData(mink_utils::PLG_DT_STANDARD, &cmd_data),
+                    true);
+    // args and results
+    static_cast<mink_utils::PluginData *>(out)->from_std(cmd_data);
+    return r;
 }
@@ -22,7 +22,10 @@
 #include <boost/filesystem/fstream.hpp>
 #include <atomic>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <lua.hpp>
+#include "lua_state_pool.h"
 #include <json_rpc.h>
 #include <sysagent.h>
 
@@ -118,6 +121,12 @@ public:
             f(it->second);
     }
 
+    void clear(){
+        // lock
+        std::unique_lock<std::mutex> l(mtx_);
+        envs_.clear();
+    }
+
 private:
     std::mutex mtx_;
     std::map<std::string, Lua_env_d> envs_;
@@ -127,22 +136,18 @@ private:
 /******************/
 /* Signal handler */
 /******************/
+// Runs env script for each signal; one independent
+// state per async delivery lane (lanes are run in
+// parallel, events with the same order key are
+// delivered to the same lane)
 class Lua_signal_hndlr: public mink_utils::SignalHandler {
 public:
-    Lua_signal_hndlr(Lua_env_d &ed, mink_utils::PluginManager *pm)
+    Lua_signal_hndlr(Lua_env_d &ed,
+                     mink_utils::PluginManager *pm,
+                     std::size_t lanes = 1)
         : ed_(ed)
         , pm_(pm) {
 
-        // lua state
-        L_ = luaL_newstate();
-        if (!L_) {
-            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                      "plg_lua: [cannot create Lua state]");
-            throw std::invalid_argument("cannot create Lua state");
-        }
-        // init lua
-        luaL_openlibs(L_);
-
          // load lua script
         std::string l;
         bfs::ifstream lua_s_fs(ed_.path);
@@ -150,58 +155,116 @@ public:
             lua_s_ += l + "\n";
         }
 
+        // lua states (one per lane)
+        std::size_t n = (lanes ? lanes : 1);
+        for (std::size_t i = 0; i < n; i++) {
+            std::unique_ptr<Lane> ln(new Lane());
+            ln->L = new_state();
+            if (!ln->L) {
+                close_states();
+                throw std::invalid_argument("cannot load Lua script");
+            }
+            lanes_.push_back(std::move(ln));
+        }
+    }
+
+    ~Lua_signal_hndlr() override {
+        close_states();
+    }
+
+    std::string operator()(mink_utils::PluginData &d) const {
+        return run_lane(d, 0);
+    }
+
+    std::string run_lane(mink_utils::PluginData &d, std::size_t lane) const override {
+        // sync delivery can run on several
+        // emitting threads
+        Lane &ln = *lanes_[lane % lanes_.size()];
+        std::unique_lock<std::mutex> l(ln.mtx);
+        return run(ln.L, d);
+    }
+
+private:
+    struct Lane {
+        lua_State *L = nullptr;
+        std::mutex mtx;
+    };
+
+    // new lua state with precompiled chunk on stack
+    lua_State *new_state() const {
+        lua_State *L = luaL_newstate();
+        if (!L) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plg_lua: [cannot create Lua state]");
+            return nullptr;
+        }
+        // init lua
+        luaL_openlibs(L);
         // load lua script
-        if(luaL_loadstring(L_, lua_s_.c_str())){
+        if(luaL_loadstring(L, lua_s_.c_str())){
             mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
                                       "plg_lua: [cannot load Lua script]");
-            lua_close(L_);
-            throw std::invalid_argument("cannot load Lua script");
+            lua_close(L);
+            return nullptr;
         }
+        return L;
+    }
 
-
+    void close_states() {
+        for (auto &ln : lanes_) {
+            if (ln->L)
+                lua_close(ln->L);
+            ln->L = nullptr;
+        }
     }
 
-    std::string operator()(mink_utils::Plugin_data_std &d) const {
+    std::string run(lua_State *L, mink_utils::PluginData &d) const {
         // copy precompiled lua chunk (pcall removes it)
-        lua_pushvalue(L_, -1);
+        lua_pushvalue(L, -1);
         // push plugin manager pointer
-        lua_pushlightuserdata(L_, pm_);
+        lua_pushlightuserdata(L, pm_);
         // push data
-        lua_pushlightuserdata(L_, &d);
+        lua_pushlightuserdata(L, &d);
         // run lua script
-        if(lua_pcall(L_, 2, 1, 0)){
+        if(lua_pcall(L, 2, 1, 0)){
             mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
                                       "plg_lua: [%s]",
-                                      lua_tostring(L_, -1));
+                                      lua_tostring(L, -1));
         }
         // retrun val
         std::string res;
         // check return (STRING)
-        if (lua_isstring(L_, -1)) {
-            res.assign(lua_tostring(L_, -1));
+        if (lua_isstring(L, -1)) {
+            res.assign(lua_tostring(L, -1));
 
         // NUMBER
-        } else if (lua_isnumber(L_, -1)) {
-            res = std::to_string(lua_tonumber(L_, -1));
+        } else if (lua_isnumber(L, -1)) {
+            res = std::to_string(lua_tonumber(L, -1));
         }
         // pop result or error message
-        lua_pop(L_, 1);
+        lua_pop(L, 1);
         // return
         return res;
     }
 
-private:
     Lua_env_d ed_;
     mink_utils::PluginManager *pm_;
     std::string lua_s_;
-    lua_State *L_;
+    std::vector<std::unique_ptr<Lane>> lanes_;
 };
 
-
 /**********/
 /* Global */
 /**********/
 Lua_env_mngr env_mngr;
+Lua_state_pool lua_pool;
+// long running env threads
+std::vector<std::thread> env_threads;
+// env sleep (woken up on terminate)
+std::mutex env_mtx;
+std::condition_variable env_cv;
+// registered signal handlers (owned by plugin)
+std::vector<Lua_signal_hndlr *> sig_hndlrs;
 
 /********************************/
 /* Process static configuration */
@@ -282,18 +345,52 @@ static int process_cfg(mink_utils::PluginManager *pm) {
                 j_path.get<std::string>()
             };
 
+            // parallel lua states (async delivery
+            // lanes) and order key
+            std::size_t workers = it->value("workers", 1);
+            std::string okey = it->value("order_key", "");
+
             // check for event subscriptions
             if (it->find("events") != it->end()) {
                 auto j_events = it->at("events");
                 // loop events
                 for(auto it_ev = j_events.begin(); it_ev != j_events.end(); ++it_ev){
+                    // event name or object with delivery
+                    // options (async, queue, policy)
+                    std::string ev_name;
+                    mink_utils::SignalOpts opts;
+                    if (it_ev->is_object()) {
+                        ev_name = it_ev->at("name").get<std::string>();
+                        if (it_ev->value("async", false))
+                            opts.mode = mink_utils::SD_ASYNC;
+                        opts.qsize = it_ev->value("queue", opts.qsize);
+                        std::string p = it_ev->value("policy", "drop_old");
+                        if (p == "drop_new")
+                            opts.policy = mink_utils::SP_DROP_NEW;
+                        else if (p == "coalesce")
+                            opts.policy = mink_utils::SP_COALESCE;
+                        else if (p != "drop_old")
+                            throw std::invalid_argument("invalid event policy");
+                    } else {
+                        ev_name = it_ev->get<std::string>();
+                    }
+                    // more than one state requires
+                    // async delivery
+                    if (workers > 1) {
+                        opts.mode = mink_utils::SD_ASYNC;
+                        opts.lanes = workers;
+                        opts.order_key = okey;
+                    }
                     // register signal handlers
-                    pm->register_signal(it_ev->get<std::string>(),
-                                        new Lua_signal_hndlr(ed, pm));
+                    auto h = new Lua_signal_hndlr(ed, pm, opts.lanes);
+                    sig_hndlrs.push_back(h);
+                    if (pm->register_signal(ev_name, h, opts))
+                        throw std::invalid_argument("cannot register event handler");
                     mink::CURRENT_DAEMON->log(mink::LLT_INFO,
-                                          "plg_lua: [attaching '%s' to '%s' event]",
+                                          "plg_lua: [attaching '%s' to '%s' event (%s)]",
                                           ed.path.c_str(),
-                                          it_ev->get<std::string>().c_str());
+                                          ev_name.c_str(),
+                                          (opts.mode == mink_utils::SD_ASYNC ? "async" : "sync"));
 
                 }
             }
@@ -356,7 +453,10 @@ static void thread_lua_env(Lua_env_d *ed, mink_utils::PluginManager *pm){
         // pop result or error message
         lua_pop(L, 1);
         // next iteration
-        std::this_thread::sleep_for(stdc::milliseconds(ed->interval));
+        std::unique_lock<std::mutex> l(env_mtx);
+        env_cv.wait_for(l, stdc::milliseconds(ed->interval), [ed] {
+            return !ed->active->load();
+        });
     }
     // remove lua state
     lua_close(L);
@@ -382,8 +482,7 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
                                       "plg_lua: [starting ENV (%s)]",
                                       d.name.c_str());
 
-            std::thread th(&thread_lua_env, &d, pm);
-            th.detach();
+            env_threads.push_back(std::thread(&thread_lua_env, &d, pm));
         }
     });
 
@@ -394,13 +493,28 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
 /* terminate handler */
 /*********************/
 extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // stop long running envs
+    {
+        std::unique_lock<std::mutex> l(env_mtx);
+        env_mngr.process_envs([](Lua_env_d &d) { d.active->store(false); });
+    }
+    env_cv.notify_all();
+    for (auto &th : env_threads)
+        th.join();
+    env_threads.clear();
+    // signal handlers are already detached
+    for (auto h : sig_hndlrs)
+        delete h;
+    sig_hndlrs.clear();
+    // envs are re-created by next init
+    env_mngr.clear();
     return 0;
 }
 
-/*********************************/
-/* local CMD_LUA_CALL (standard) */
-/*********************************/
-static void impl_lua_call(mink_utils::Plugin_data_std *data,
+/**********************/
+/* local CMD_LUA_CALL */
+/**********************/
+static void impl_lua_call(mink_utils::PluginData *data,
                           mink_utils::PluginManager *pm) {
     // sanity check
     if(!data || data->empty()){
@@ -412,34 +526,15 @@ static void impl_lua_call(mink_utils::Plugin_data_std *data,
     try {
         // get CMD_CALL env
         Lua_env_d &ed = env_mngr.get_envd("CMD_CALL");
-         // lua state
-        lua_State *L = luaL_newstate();
-        if (!L) {
-            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                      "plg_lua: [cannot create Lua state]");
-            throw std::invalid_argument("cannot create Lua state");
-        }
-        // init lua
-        luaL_openlibs(L);
-
-         // load lua script
-        std::string l;
-        std::string lua_s;
-        bfs::ifstream lua_s_fs(ed.path);
-        while (std::getline(lua_s_fs, l)) {
-            lua_s += l + "\n";
-        }
-
-        // load lua script
-        if(luaL_loadstring(L, lua_s.c_str())){
-            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                      "plg_lua: [cannot load Lua script]");
-            lua_close(L);
-            throw std::invalid_argument("cannot load Lua script");
-        }
+        // warm lua state
+        Lua_state_pool::State st;
+        std::string err;
+        if (lua_pool.acquire(ed.path, st, err))
+            throw std::invalid_argument(err);
+        lua_State *L = st.L;
 
         // copy precompiled lua chunk (pcall removes it)
-        lua_pushvalue(L, -1);
+        Lua_state_pool::push_chunk(L);
         // push plugin manager pointer
         lua_pushlightuserdata(L, pm);
         // push data
@@ -450,31 +545,55 @@ static void impl_lua_call(mink_utils::Plugin_data_std *data,
                                       "plg_lua: [%s]",
                                       lua_tostring(L, -1));
         }
-        // pop result or error message
-        lua_pop(L, 1);
-        // remove lua state
-        lua_close(L);
-
+        // return lua state to pool
+        lua_pool.release(ed.path, st);
 
     } catch (std::exception &e) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR, "plg_lua: [%s]",
                                   e.what());
     }
 }
+/*********************************/
+/* local CMD_LUA_CALL (standard) */
+/*********************************/
+static void impl_lua_call(mink_utils::Plugin_data_std *data,
+                          mink_utils::PluginManager *pm) {
+    // sanity check
+    if (!data) {
+        mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                  "plg_lua: [CMD_LUA_CALL invalid data]");
+        return;
+    }
+    // convert to plugin data and back (lua can
+    // add result rows)
+    mink_utils::PluginData e_d;
+    e_d.from_std(*data);
+    impl_lua_call(&e_d, pm);
+    e_d.to_std(*data);
+}
+
 /**********************************/
 /* local CMD_LUA_CALL (UNIX JRPC) */
 /**********************************/
 static void impl_lua_call(json *j,
                           mink_utils::PluginManager *pm) {
 
-    // create standard plugin in/out data
-    mink_utils::Plugin_data_std e_d;
-    e_d.push_back({{"", j->dump()}});
+    // create plugin in/out data
+    std::string j_s = j->dump();
+    mink_utils::PluginData e_d;
+    e_d.add_ref(e_d.add_row(), "", j_s);
     // call lua
     impl_lua_call(&e_d, pm);
     // return result
-    if (e_d.size() > 1)
-        (*j)[Jrpc::RESULT_] = e_d.at(1).cbegin()->second;
+    const mink_utils::PluginColumn *c = e_d.get(1, 0);
+    if (!c)
+        return;
+    if (c->value.type == mink_utils::PVT_INT)
+        (*j)[Jrpc::RESULT_] = c->value.i;
+    else if (c->value.type == mink_utils::PVT_DOUBLE)
+        (*j)[Jrpc::RESULT_] = c->value.d;
+    else
+        (*j)[Jrpc::RESULT_] = c->value.str();
 }
 
 /*************************/
@@ -20,7 +20,6 @@
 #include <sysagent.h>
 #include <json_rpc.h>
 #include <MQTTAsync.h>
-#include <boost/signals2.hpp>
 
 /*************/
 /* Plugin ID */
@@ -40,6 +39,8 @@ extern "C" constexpr int COMMANDS[] = {
 /* SIGNALS */
 /***********/
 const std::string SIG_MQTT_RX = "mqtt:RX";
+// interned signal id (set in init)
+static int sig_mqtt_rx = -1;
 
 /*******************/
 /* MQTT connection */
@@ -162,12 +163,15 @@ private:
     static int on_rx(void *ctx, char *t, int t_sz, MQTTAsync_message *msg) {
         // get context
         MQTT_conn *conn = static_cast<MQTT_conn *>(ctx);
-        // signal data
-        std::string s(static_cast<char *>(msg->payload), msg->payloadlen);
+        // signal data (no copy, valid until freed)
+        boost::string_view s(static_cast<char *>(msg->payload), msg->payloadlen);
+        boost::string_view tv = (t_sz > 0 ? boost::string_view(t, t_sz) : boost::string_view(t));
         // process signal
-        mink_utils::Plugin_data_std e_d;
-        e_d.push_back({{"mqtt_topic", t}, {"mqtt_payload", s}});
-        conn->pm_->process_signal(SIG_MQTT_RX, e_d);
+        mink_utils::PluginData e_d;
+        std::size_t r = e_d.add_row();
+        e_d.add_ref(r, "mqtt_topic", tv);
+        e_d.add_ref(r, "mqtt_payload", s, mink_utils::PVT_BYTES);
+        conn->pm_->process_signal(sig_mqtt_rx, e_d);
         // cleanup
         MQTTAsync_freeMessage(&msg);
         MQTTAsync_free(t);
@@ -319,6 +323,8 @@ static int process_cfg(mink_utils::PluginManager *pm) {
 /* init handler */
 /****************/
 extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // signals (before connections are started)
+    sig_mqtt_rx = pm->signal_id(SIG_MQTT_RX);
     // process cfg
     if (process_cfg(pm)) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
@@ -0,0 +1,262 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef SYSAGENTD_NDPI_FLOW_TABLE_H
+#define SYSAGENTD_NDPI_FLOW_TABLE_H
+
+#include <vector>
+#include <utility>
+#include <cstring>
+#include <sys/types.h>
+#include <arpa/inet.h>
+#include <endian.h>
+
+/**************/
+/* Flow table */
+/**************/
+// Open addressing (linear probing, backward shift delete)
+// flow table; slots hold hash and pool index only, flow
+// records are pooled and linked in LRU order (expiry).
+// T is a POD flow record with key[KEY_SZ], hashval,
+// last_seen_ms, lru_prev and lru_next fields; Free
+// releases record data when flow is removed
+template <typename T, typename Free>
+class Flow_table {
+public:
+    static constexpr u_int32_t NIL = 0xffffffff;
+    // default max flows
+    static constexpr u_int32_t MAX_FLOWS = 1 << 18;
+    // idle timeout (workflow time units)
+    static constexpr u_int64_t IDLE_TIMEOUT = 30000;
+    // max expired flows per packet
+    static constexpr u_int32_t EXPIRE_MAX = 16;
+
+    explicit Flow_table(u_int32_t max_flows) {
+        max_ = (max_flows ? max_flows : MAX_FLOWS);
+        // load factor <= 0.5
+        std::size_t n = 1;
+        while (n < (std::size_t)max_ * 2)
+            n <<= 1;
+        slots_.assign(n, Slot{0, NIL});
+        mask_ = n - 1;
+    }
+    ~Flow_table() {
+        for (u_int32_t i = lru_head_; i != NIL; i = pool_[i].lru_next)
+            Free()(&pool_[i]);
+    }
+    Flow_table(const Flow_table &o) = delete;
+    Flow_table &operator=(const Flow_table &o) = delete;
+
+    // key size (u_int64_t words)
+    static constexpr int KEY_SZ = 5;
+
+    // 128-bit address (IPv4 is mapped to ::ffff:0:0/96)
+    struct Addr {
+        u_int64_t hi;
+        u_int64_t lo;
+    };
+
+    static Addr addr4(u_int32_t ip) {
+        return Addr{0, 0x0000ffff00000000ULL | ntohl(ip)};
+    }
+
+    // ip is a 16 byte address (network byte order)
+    template <typename A>
+    static Addr addr6(const A &ip) {
+        static_assert(sizeof(A) == 16, "invalid IPv6 address type");
+        Addr a;
+        memcpy(&a.hi, &ip, 8);
+        memcpy(&a.lo, reinterpret_cast<const char *>(&ip) + 8, 8);
+        return Addr{be64toh(a.hi), be64toh(a.lo)};
+    }
+
+    // canonical 5-tuple and vlan (both directions map to
+    // the same key); returns 1 if a is the lower endpoint
+    static int make_key(Addr a_ip,
+                        u_int16_t a_port,
+                        Addr b_ip,
+                        u_int16_t b_port,
+                        u_int8_t proto,
+                        u_int16_t vlan,
+                        u_int64_t *k) {
+        int fwd = (a_ip.hi != b_ip.hi ? a_ip.hi < b_ip.hi :
+                   a_ip.lo != b_ip.lo ? a_ip.lo < b_ip.lo :
+                   a_port <= b_port);
+        if (!fwd) {
+            std::swap(a_ip, b_ip);
+            std::swap(a_port, b_port);
+        }
+        k[0] = a_ip.hi;
+        k[1] = a_ip.lo;
+        k[2] = b_ip.hi;
+        k[3] = b_ip.lo;
+        k[4] = ((u_int64_t)a_port << 48) |
+               ((u_int64_t)b_port << 32) |
+               ((u_int64_t)proto << 16) |
+               vlan;
+        return fwd;
+    }
+
+    static u_int64_t hash(const u_int64_t *k) {
+        u_int64_t h = 0;
+        for (int i = 0; i < KEY_SZ; i++)
+            h = fmix64(h ^ (k[i] + 0x9e3779b97f4a7c15ULL));
+        return h;
+    }
+
+    // find flow and mark as recently used
+    T *find(const u_int64_t *k, u_int64_t h) {
+        u_int32_t h32 = (u_int32_t)h;
+        for (std::size_t i = h & mask_;; i = (i + 1) & mask_) {
+            const Slot &s = slots_[i];
+            if (s.idx == NIL)
+                return nullptr;
+            if (s.h == h32) {
+                T *f = &pool_[s.idx];
+                if (memcmp(f->key, k, sizeof(f->key)) == 0) {
+                    lru_unlink(s.idx);
+                    lru_push(s.idx);
+                    return f;
+                }
+            }
+        }
+    }
+
+    // new zeroed flow record (key and hash are set); LRU
+    // flow is evicted if table is full. Returned pointer is
+    // valid until next insert
+    T *insert(const u_int64_t *k, u_int64_t h) {
+        u_int32_t idx;
+        if (!free_.empty()) {
+            idx = free_.back();
+            free_.pop_back();
+        } else if (pool_.size() < max_) {
+            idx = pool_.size();
+            pool_.emplace_back();
+        } else {
+            // full, evict LRU flow
+            idx = lru_tail_;
+            erase(idx);
+            free_.pop_back();
+        }
+        T *f = &pool_[idx];
+        memset(f, 0, sizeof(T));
+        memcpy(f->key, k, sizeof(f->key));
+        f->hashval = (u_int32_t)h;
+        // slot
+        std::size_t i = h & mask_;
+        while (slots_[i].idx != NIL)
+            i = (i + 1) & mask_;
+        slots_[i] = Slot{(u_int32_t)h, idx};
+        lru_push(idx);
+        ++size_;
+        return f;
+    }
+
+    // remove flows idle since (now - IDLE_TIMEOUT), oldest
+    // first; at most max flows
+    u_int32_t expire(u_int64_t now, u_int32_t max) {
+        u_int32_t n = 0;
+        while (n < max && lru_tail_ != NIL &&
+               pool_[lru_tail_].last_seen_ms + IDLE_TIMEOUT < now) {
+            erase(lru_tail_);
+            ++n;
+        }
+        return n;
+    }
+
+    // remove flow
+    void remove(T *f) {
+        erase(f - pool_.data());
+    }
+
+    std::size_t size() const { return size_; }
+
+private:
+    struct Slot {
+        u_int32_t h;
+        u_int32_t idx;
+    };
+
+    // murmur3 finalizer
+    static u_int64_t fmix64(u_int64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    // free flow data and release record to pool
+    void erase(u_int32_t idx) {
+        T *f = &pool_[idx];
+        // find slot
+        std::size_t i = f->hashval & mask_;
+        while (slots_[i].idx != idx)
+            i = (i + 1) & mask_;
+        // backward shift
+        std::size_t j = i;
+        for (;;) {
+            j = (j + 1) & mask_;
+            if (slots_[j].idx == NIL)
+                break;
+            std::size_t k = slots_[j].h & mask_;
+            // home slot in (i, j], keep
+            if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+                continue;
+            slots_[i] = slots_[j];
+            i = j;
+        }
+        slots_[i] = Slot{0, NIL};
+
+        lru_unlink(idx);
+        Free()(f);
+        free_.push_back(idx);
+        --size_;
+    }
+
+    void lru_push(u_int32_t idx) {
+        T *f = &pool_[idx];
+        f->lru_prev = NIL;
+        f->lru_next = lru_head_;
+        if (lru_head_ != NIL)
+            pool_[lru_head_].lru_prev = idx;
+        lru_head_ = idx;
+        if (lru_tail_ == NIL)
+            lru_tail_ = idx;
+    }
+
+    void lru_unlink(u_int32_t idx) {
+        T *f = &pool_[idx];
+        if (f->lru_prev != NIL)
+            pool_[f->lru_prev].lru_next = f->lru_next;
+        else
+            lru_head_ = f->lru_next;
+        if (f->lru_next != NIL)
+            pool_[f->lru_next].lru_prev = f->lru_prev;
+        else
+            lru_tail_ = f->lru_prev;
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t mask_ = 0;
+    // flow records
+    std::vector<T> pool_;
+    std::vector<u_int32_t> free_;
+    u_int32_t max_ = 0;
+    std::size_t size_ = 0;
+    // most recently used
+    u_int32_t lru_head_ = NIL;
+    // least recently used
+    u_int32_t lru_tail_ = NIL;
+};
+
+#endif /* ifndef SYSAGENTD_NDPI_FLOW_TABLE_H */
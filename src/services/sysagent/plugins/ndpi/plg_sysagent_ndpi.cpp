@@ -25,6 +25,19 @@
 #include <regex>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <memory>
+#include <poll.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/if_packet.h>
+#include <linux/if_ether.h>
+#include <net/if_arp.h>
+#include <endian.h>
+#include "flow_table.h"
 
 /***********/
 /* Aliases */
@@ -36,6 +49,8 @@ using Pargs = mink_utils::Plugin_args;
 /* Forward */
 /***********/
 class Pcap_d;
+struct Pcap_worker;
+struct Flow_free;
 
 /**********************/
 /* ndpi flow tracking */
@@ -64,6 +79,13 @@ typedef struct ndpi_flow_info {
     ndpi_protocol detected_protocol;
     ndpi_bin payload_len_bin;
     u_int64_t last_seen_ms;
+    // canonical 5-tuple and vlan (flow table key)
+    u_int64_t key[5];
+    // first packet was sent by lower endpoint
+    u_int8_t key_fwd;
+    // LRU list (pool indexes)
+    u_int32_t lru_prev;
+    u_int32_t lru_next;
 
 } ndpi_flow_info_t;
 
@@ -74,7 +96,6 @@ typedef struct ndpi_workflow_prefs {
   u_int8_t decode_tunnels;
   u_int8_t quiet_mode;
   u_int8_t ignore_vlanid;
-  u_int32_t num_roots;
   u_int32_t max_ndpi_flows;
 } ndpi_workflow_prefs_t;
 
@@ -85,17 +106,57 @@ typedef struct ndpi_workflow_prefs {
 typedef struct ndpi_workflow {
     ndpi_workflow_prefs prefs;
     pcap_t *pcap_handle;
+    // datalink type
+    int dlt;
     Pcap_d *pcap_d;
-    void **ndpi_flows_root;
+    // fanout worker (nullptr - pcap mode)
+    Pcap_worker *worker;
+    Flow_table<ndpi_flow_info_t, Flow_free> *flows;
     ndpi_detection_module_struct *ndpi_struct;
     u_int32_t num_allocated_flows;
-    u_int64_t last_idle_scan_time;
     u_int64_t last_time;
-    u_int32_t num_idle_flows;
-    u_int32_t idle_scan_idx;
-    ndpi_flow_info_t *idle_flows[1024];
 } ndpi_workflow_t;
 
+/*************************/
+/* Fanout capture worker */
+/*************************/
+// Per worker protocol counters; single writer (worker
+// thread), readers merge them without locking
+struct Pcap_worker {
+    // protocol names (immutable after ready is set)
+    std::vector<std::string> names;
+    // packet counters (per protocol id)
+    std::unique_ptr<std::atomic<uint64_t>[]> cntrs;
+    // names and counters are valid
+    std::atomic_bool ready{false};
+
+    void init(ndpi_detection_module_struct *m) {
+        u_int n = ndpi_get_num_supported_protocols(m);
+        names.reserve(n);
+        for (u_int i = 0; i < n; i++)
+            names.emplace_back(ndpi_get_proto_name(m, i));
+        cntrs.reset(new std::atomic<uint64_t>[n]);
+        for (u_int i = 0; i < n; i++)
+            cntrs[i].store(0, std::memory_order_relaxed);
+        ready.store(true, std::memory_order_release);
+    }
+
+    void inc(u_int16_t id) {
+        if (id < names.size())
+            cntrs[id].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void merge(std::map<std::string, uint64_t> &out) const {
+        if (!ready.load(std::memory_order_acquire))
+            return;
+        for (std::size_t i = 0; i < names.size(); i++) {
+            uint64_t v = cntrs[i].load(std::memory_order_relaxed);
+            if (v > 0)
+                out[names[i]] += v;
+        }
+    }
+};
+
 /*******************/
 /* PCAP descriptor */
 /*******************/
@@ -108,6 +169,7 @@ public:
         pcap_h_ = o.pcap_h_;
         workflow_ = o.workflow_;
         stats_ = o.stats_;
+        workers_ = o.workers_;
     }
     Pcap_d(const std::string &if_n) : if_n_(if_n) {
         // reserved
@@ -122,9 +184,17 @@ public:
     }
 
     void set_pcap_h(pcap_t *pcap_h) {
+        std::unique_lock<std::mutex> lock(mtx_);
         pcap_h_ = pcap_h;
     }
 
+    // stop pcap_dispatch of capture thread
+    void breakloop() {
+        std::unique_lock<std::mutex> lock(mtx_);
+        if (pcap_h_)
+            pcap_breakloop(pcap_h_);
+    }
+
     ndpi_workflow_t &get_workflow() {
         return workflow_;
     }
@@ -139,15 +209,33 @@ public:
     }
 
     void get_stats(std::map<std::string, uint64_t> &out) {
-        std::unique_lock<std::mutex> lock(mtx_);
-        out = stats_;
+        {
+            std::unique_lock<std::mutex> lock(mtx_);
+            out = stats_;
+        }
+        // fanout workers (lock-free)
+        for (auto &w : workers_)
+            w->merge(out);
+    }
+
+    // create fanout workers (before capture
+    // threads are started)
+    void set_workers(std::size_t n) {
+        workers_.clear();
+        for (std::size_t i = 0; i < n; i++)
+            workers_.push_back(std::make_shared<Pcap_worker>());
+    }
+
+    Pcap_worker *get_worker(std::size_t i) {
+        return workers_.at(i).get();
     }
 
 private:
     std::string if_n_;
-    pcap_t *pcap_h_;
+    pcap_t *pcap_h_ = nullptr;
     ndpi_workflow_t workflow_;
     std::map<std::string, uint64_t> stats_;
+    std::vector<std::shared_ptr<Pcap_worker>> workers_;
     std::mutex mtx_;
 };
 
@@ -186,6 +274,15 @@ public:
 
     }
 
+    void process_pcaps(const std::function<void(Pcap_d &)> &f) {
+        for (auto it = pcap_lst_.begin(); it != pcap_lst_.end(); ++it)
+            f(it->second);
+    }
+
+    void clear() {
+        pcap_lst_.clear();
+    }
+
 private:
     std::map<std::string, Pcap_d> pcap_lst_;
 
@@ -195,8 +292,13 @@ private:
 /* Global vars */
 /***************/
 Pcap_mngr pcap_mngr;
-uint32_t current_ndpi_memory = 0;
-uint32_t max_ndpi_memory = 0;
+std::atomic<uint64_t> current_ndpi_memory{0};
+std::atomic<uint64_t> max_ndpi_memory{0};
+// max flows per workflow (flow table size)
+uint32_t max_flows = 0;
+// capture threads (joined in terminate)
+std::vector<std::thread> cap_threads;
+std::atomic_bool cap_active{true};
 
 /*************/
 /* Plugin ID */
@@ -239,10 +341,10 @@ json *plg_get_config(){
 
 // ndpi_malloc wrapper function
 static void *ndpi_malloc_wrapper(size_t size) {
-    current_ndpi_memory += size;
-
-    if (current_ndpi_memory > max_ndpi_memory)
-        max_ndpi_memory = current_ndpi_memory;
+    uint64_t c = current_ndpi_memory += size;
+    uint64_t m = max_ndpi_memory.load(std::memory_order_relaxed);
+    while (c > m && !max_ndpi_memory.compare_exchange_weak(m, c))
+        ;
 
     return (malloc(size));
 }
@@ -270,55 +372,18 @@ int ndpi_is_datalink_supported(int dlt) {
     }
 }
 
-// compare node 32bit
-static inline int cmp_n32(uint32_t a, uint32_t b) {
-    return a == b ? 0 : ntohl(a) < ntohl(b) ? -1 : 1;
-}
-
-// compare node 16bit
-static inline int cmp_n16(uint16_t a, uint16_t b) {
-    return a == b ? 0 : ntohs(a) < ntohs(b) ? -1 : 1;
+static void ndpi_flow_info_free_data(ndpi_flow_info_t *flow) {
+    ndpi_free_flow_info_half(flow);
+    ndpi_free_bin(&flow->payload_len_bin);
 }
 
-// compare two nodes in workflow
-static int ndpi_workflow_node_cmp(const void *a, const void *b) {
-    const struct ndpi_flow_info *fa = (const struct ndpi_flow_info *)a;
-    const struct ndpi_flow_info *fb = (const struct ndpi_flow_info *)b;
-
-    if (fa->hashval < fb->hashval)
-        return (-1);
-    else if (fa->hashval > fb->hashval)
-        return (1);
-
-    // Flows have the same hash
-    if (fa->vlan_id < fb->vlan_id)
-        return (-1);
-    else {
-        if (fa->vlan_id > fb->vlan_id)
-            return (1);
-    }
-    if (fa->protocol < fb->protocol)
-        return (-1);
-    else {
-        if (fa->protocol > fb->protocol)
-            return (1);
+// flow table record cleanup
+struct Flow_free {
+    void operator()(ndpi_flow_info_t *f) const {
+        ndpi_flow_info_free_data(f);
     }
-
-    int r;
-    r = cmp_n32(fa->src_ip, fb->src_ip);
-    if (r)
-        return r;
-    r = cmp_n16(fa->src_port, fb->src_port);
-    if (r)
-        return r;
-    r = cmp_n32(fa->dst_ip, fb->dst_ip);
-    if (r)
-        return r;
-    r = cmp_n16(fa->dst_port, fb->dst_port);
-
-    return (r);
-}
-
+};
+using Ndpi_flow_table = Flow_table<ndpi_flow_info_t, Flow_free>;
 
 static ndpi_flow_info *get_ndpi_flow_info(ndpi_workflow *workflow,
                                           const u_int8_t version,
@@ -335,11 +400,9 @@ static ndpi_flow_info *get_ndpi_flow_info(ndpi_workflow *workflow,
                                           u_int8_t *proto,
                                           u_int8_t **payload,
                                           u_int16_t *payload_len,
-                                          u_int8_t *src_to_dst_direction) {
+                                          u_int8_t *src_to_dst_direction,
+                                          u_int16_t vlan) {
 
-    u_int32_t idx, hashval;
-    ndpi_flow_info flow;
-    void *ret;
     const u_int8_t *l3, *l4;
     u_int32_t l4_data_len = 0XFEEDFACE;
 
@@ -409,109 +472,80 @@ static ndpi_flow_info *get_ndpi_flow_info(ndpi_workflow *workflow,
         l4_data_len = 0;
     }
 
-    flow.protocol = iph->protocol;
-    flow.vlan_id = 0;
-    flow.src_ip = iph->saddr, flow.dst_ip = iph->daddr;
-    flow.src_port = htons(*sport), flow.dst_port = htons(*dport);
-    flow.hashval = hashval = flow.protocol +
-                             ntohl(flow.src_ip) +
-                             ntohl(flow.dst_ip) +
-                             ntohs(flow.src_port) +
-                             ntohs(flow.dst_port);
-
-    idx = hashval % workflow->prefs.num_roots;
-    ret = ndpi_tfind(&flow,
-                     &workflow->ndpi_flows_root[idx],
-                     ndpi_workflow_node_cmp);
-
-    // to avoid two nodes in one binary tree for a flow
-    int is_changed = 0;
-    if (ret == NULL) {
-        u_int32_t orig_src_ip = flow.src_ip;
-        u_int16_t orig_src_port = flow.src_port;
-        u_int32_t orig_dst_ip = flow.dst_ip;
-        u_int16_t orig_dst_port = flow.dst_port;
-
-        flow.src_ip = orig_dst_ip;
-        flow.src_port = orig_dst_port;
-        flow.dst_ip = orig_src_ip;
-        flow.dst_port = orig_src_port;
-
-        is_changed = 1;
-
-        ret = ndpi_tfind(&flow,
-                         &workflow->ndpi_flows_root[idx],
-                         ndpi_workflow_node_cmp);
-
-        if (ret == nullptr) {
-            ndpi_flow_info_t *newflow =
-                (ndpi_flow_info_t *)ndpi_malloc(sizeof(struct ndpi_flow_info));
-
-            if (newflow == nullptr) {
-                return (nullptr);
-            } else
-                workflow->num_allocated_flows++;
-
-            memset(newflow, 0, sizeof(ndpi_flow_info_t));
-            newflow->flow_id = 0;
-            newflow->hashval = hashval;
-            newflow->protocol = iph->protocol;
-            newflow->src_ip = iph->saddr;
-            newflow->dst_ip = iph->daddr;
-            newflow->src_port = htons(*sport),
-            newflow->dst_port = htons(*dport);
-            newflow->ip_version = version;
-
-            if (version == IPVERSION) {
-                inet_ntop(AF_INET,
-                          &newflow->src_ip,
-                          newflow->src_name,
-                          sizeof(newflow->src_name));
-                inet_ntop(AF_INET,
-                          &newflow->dst_ip,
-                          newflow->dst_name,
-                          sizeof(newflow->dst_name));
-            } else {
-                inet_ntop(AF_INET6,
-                          &iph6->ip6_src,
-                          newflow->src_name,
-                          sizeof(newflow->src_name));
-                inet_ntop(AF_INET6,
-                          &iph6->ip6_dst,
-                          newflow->dst_name,
-                          sizeof(newflow->dst_name));
-                // For consistency across platforms replace :0: with ::
-                ndpi_patchIPv6Address(newflow->src_name);
-                ndpi_patchIPv6Address(newflow->dst_name);
-            }
-            if ((newflow->ndpi_flow = (ndpi_flow_struct *)ndpi_flow_malloc(
-                     SIZEOF_FLOW_STRUCT)) == nullptr) {
-                ndpi_free_bin(&newflow->payload_len_bin);
-                ndpi_free(newflow);
-                return (nullptr);
-            } else
-                memset(newflow->ndpi_flow, 0, SIZEOF_FLOW_STRUCT);
-
-            ndpi_tsearch(newflow,
-                         &workflow->ndpi_flows_root[idx],
-                         ndpi_workflow_node_cmp);
-
-            return newflow;
-        }
-    } else {
-        ndpi_flow_info_t *rflow = *(ndpi_flow_info_t **)ret;
-
-        if (is_changed) {
+    // canonical key (both directions, full
+    // IPv6 addresses)
+    u_int64_t key[Ndpi_flow_table::KEY_SZ];
+    if (workflow->prefs.ignore_vlanid)
+        vlan = 0;
+    int fwd = Ndpi_flow_table::make_key(version == IPVERSION ?
+                                            Ndpi_flow_table::addr4(iph->saddr) :
+                                            Ndpi_flow_table::addr6(iph6->ip6_src),
+                                        *sport,
+                                        version == IPVERSION ?
+                                            Ndpi_flow_table::addr4(iph->daddr) :
+                                            Ndpi_flow_table::addr6(iph6->ip6_dst),
+                                        *dport,
+                                        iph->protocol,
+                                        vlan,
+                                        key);
+    u_int64_t hashval = Ndpi_flow_table::hash(key);
+
+    ndpi_flow_info_t *rflow = workflow->flows->find(key, hashval);
+    if (rflow) {
+        // packet direction (relative to first packet)
+        if (rflow->key_fwd != fwd) {
             *src_to_dst_direction = 0;
             rflow->bidirectional |= 1;
         } else {
             *src_to_dst_direction = 1;
         }
-
         return (rflow);
     }
 
-    return nullptr;
+    // new flow (pooled record)
+    ndpi_flow_info_t *newflow = workflow->flows->insert(key, hashval);
+    workflow->num_allocated_flows++;
+
+    newflow->flow_id = 0;
+    newflow->key_fwd = fwd;
+    newflow->vlan_id = vlan;
+    newflow->protocol = iph->protocol;
+    newflow->src_ip = iph->saddr;
+    newflow->dst_ip = iph->daddr;
+    newflow->src_port = htons(*sport),
+    newflow->dst_port = htons(*dport);
+    newflow->ip_version = version;
+
+    if (version == IPVERSION) {
+        inet_ntop(AF_INET,
+                  &newflow->src_ip,
+                  newflow->src_name,
+                  sizeof(newflow->src_name));
+        inet_ntop(AF_INET,
+                  &newflow->dst_ip,
+                  newflow->dst_name,
+                  sizeof(newflow->dst_name));
+    } else {
+        inet_ntop(AF_INET6,
+                  &iph6->ip6_src,
+                  newflow->src_name,
+                  sizeof(newflow->src_name));
+        inet_ntop(AF_INET6,
+                  &iph6->ip6_dst,
+                  newflow->dst_name,
+                  sizeof(newflow->dst_name));
+        // For consistency across platforms replace :0: with ::
+        ndpi_patchIPv6Address(newflow->src_name);
+        ndpi_patchIPv6Address(newflow->dst_name);
+    }
+    if ((newflow->ndpi_flow = (ndpi_flow_struct *)ndpi_flow_malloc(
+             SIZEOF_FLOW_STRUCT)) == nullptr) {
+        workflow->flows->remove(newflow);
+        return (nullptr);
+    } else
+        memset(newflow->ndpi_flow, 0, SIZEOF_FLOW_STRUCT);
+
+    return newflow;
 }
 
 static ndpi_flow_info *get_ndpi_flow_info6(ndpi_workflow * workflow,
@@ -525,17 +559,15 @@ static ndpi_flow_info *get_ndpi_flow_info6(ndpi_workflow * workflow,
                                            u_int8_t *proto,
                                            u_int8_t **payload,
                                            u_int16_t *payload_len,
-                                           u_int8_t *src_to_dst_direction) {
+                                           u_int8_t *src_to_dst_direction,
+                                           u_int16_t vlan) {
   struct ndpi_iphdr iph;
 
   if (ipsize < 40)
       return (nullptr);
+  // protocol only (flow key uses full addresses)
   memset(&iph, 0, sizeof(iph));
   iph.version = IPVERSION;
-  iph.saddr = iph6->ip6_src.u6_addr.u6_addr32[2] +
-              iph6->ip6_src.u6_addr.u6_addr32[3];
-  iph.daddr = iph6->ip6_dst.u6_addr.u6_addr32[2] +
-              iph6->ip6_dst.u6_addr.u6_addr32[3];
   u_int8_t l4proto = iph6->ip6_hdr.ip6_un1_nxt;
   u_int16_t ip_len = ntohs(iph6->ip6_hdr.ip6_un1_plen);
   const u_int8_t *l4ptr = (((const u_int8_t *)iph6) +
@@ -566,7 +598,8 @@ static ndpi_flow_info *get_ndpi_flow_info6(ndpi_workflow * workflow,
                              proto,
                              payload,
                              payload_len,
-                             src_to_dst_direction));
+                             src_to_dst_direction,
+                             vlan));
 }
 
 static ndpi_proto packet_proc(ndpi_workflow * workflow,
@@ -577,7 +610,8 @@ static ndpi_proto packet_proc(ndpi_workflow * workflow,
                               u_int16_t ipsize,
                               u_int16_t rawsize,
                               const pcap_pkthdr *header,
-                              const u_char *packet) {
+                              const u_char *packet,
+                              u_int16_t vlan) {
 
     ndpi_flow_info *flow = nullptr;
     ndpi_flow_struct *ndpi_flow = nullptr;
@@ -606,7 +640,8 @@ static ndpi_proto packet_proc(ndpi_workflow * workflow,
                                   &proto,
                                   &payload,
                                   &payload_len,
-                                  &src_to_dst_direction);
+                                  &src_to_dst_direction,
+                                  vlan);
     else
         flow = get_ndpi_flow_info6(workflow,
                                    iph6,
@@ -619,7 +654,8 @@ static ndpi_proto packet_proc(ndpi_workflow * workflow,
                                    &proto,
                                    &payload,
                                    &payload_len,
-                                   &src_to_dst_direction);
+                                   &src_to_dst_direction,
+                                   vlan);
 
     if (flow != nullptr) {
         ndpi_flow = flow->ndpi_flow;
@@ -670,10 +706,11 @@ static ndpi_proto packet_proc(ndpi_workflow * workflow,
     return (flow->detected_protocol);
 }
 
+// vlan - tag removed from packet by capture (0 if none)
 static ndpi_proto ndpi_workflow_process_packet(ndpi_workflow * workflow,
-                                               pcap_t *pcap_h,
                                                const pcap_pkthdr *header,
-                                               const u_char *packet) {
+                                               const u_char *packet,
+                                               u_int16_t vlan) {
 
     // unknown protocol
     ndpi_proto nproto = NDPI_PROTOCOL_NULL;
@@ -696,7 +733,7 @@ static ndpi_proto ndpi_workflow_process_packet(ndpi_workflow * workflow,
     u_int64_t time_ms;
 
     // get/check datalink layer
-    int dlt = pcap_datalink(pcap_h);
+    int dlt = workflow->dlt;
     // timestamp
     time_ms = ((uint64_t) header->ts.tv_sec) * 10 + header->ts.tv_usec / (1000000 / 10);
     // safety check
@@ -739,9 +776,17 @@ static ndpi_proto ndpi_workflow_process_packet(ndpi_workflow * workflow,
             break;
     }
 
+    // 802.1Q (inner tag is used for QinQ)
+    while (type == ETH_P_VLAN) {
+        if (header->caplen < ip_offset + 4)
+            return (nproto);
+        vlan = ntohs(*(const u_int16_t *)&packet[ip_offset]) & 0xfff;
+        type = ntohs(*(const u_int16_t *)&packet[ip_offset + 2]);
+        ip_offset += 4;
+    }
+
     // process ether type
     switch(type){
-        case ETH_P_VLAN:
         case ETH_P_MPLS_UNI:
         case ETH_P_MPLS_MULTI:
         case ETH_P_PPPoE:
@@ -822,44 +867,20 @@ static ndpi_proto ndpi_workflow_process_packet(ndpi_workflow * workflow,
                         header->caplen - ip_offset,
                         header->caplen,
                         header,
-                        packet));
+                        packet,
+                        vlan));
 
 }
 
-static void ndpi_flow_info_free_data(ndpi_flow_info_t *flow) {
-    ndpi_free_flow_info_half(flow);
-    ndpi_free_bin(&flow->payload_len_bin);
-}
-
-
-static void node_idle_scan_walker(const void *node, ndpi_VISIT which, int depth, void *user_data) {
-    ndpi_flow_info_t *flow = *(ndpi_flow_info_t **)node;
-    ndpi_workflow_t *workflow = (ndpi_workflow_t *)user_data;
-
-    if (workflow->num_idle_flows == 1024) {
-        return;
-    }
-
-    if ((which == ndpi_preorder) || (which == ndpi_leaf)) {
-        if(flow->last_seen_ms + 30000 < workflow->last_time) {
-            ndpi_flow_info_free_data(flow);
-            // add to delete queue
-            workflow->idle_flows[workflow->num_idle_flows++] = flow;
-        }
-    }
-}
-
-static void ndpi_process_packet(u_char *args,
+static void ndpi_process_packet(ndpi_workflow_t *workflow,
                                 const pcap_pkthdr *header,
-                                const u_char *packet) {
-
-    ndpi_workflow_t *workflow = (ndpi_workflow_t *)args;
-    pcap_t *pcap_h = workflow->pcap_handle;
+                                const u_char *packet,
+                                u_int16_t vlan) {
 
     ndpi_proto p = ndpi_workflow_process_packet(workflow,
-                                                pcap_h,
                                                 header,
-                                                packet);
+                                                packet,
+                                                vlan);
 /*
     if (p.app_protocol != NDPI_PROTOCOL_UNKNOWN)
         std::cout << "app: "
@@ -875,8 +896,15 @@ static void ndpi_process_packet(u_char *args,
         p.master_protocol != NDPI_PROTOCOL_UNKNOWN)
         std::cout << std::endl;
 */
+    // inc stats (fanout worker)
+    if (workflow->worker) {
+        if (p.app_protocol != NDPI_PROTOCOL_UNKNOWN)
+            workflow->worker->inc(p.app_protocol);
+        else if (p.master_protocol != NDPI_PROTOCOL_UNKNOWN)
+            workflow->worker->inc(p.master_protocol);
+
     // inc stats
-    if (p.app_protocol != NDPI_PROTOCOL_UNKNOWN) {
+    } else if (p.app_protocol != NDPI_PROTOCOL_UNKNOWN) {
         auto pn = ndpi_get_proto_name(workflow->ndpi_struct, p.app_protocol);
         workflow->pcap_d->inc_stats(pn);
 
@@ -885,28 +913,63 @@ static void ndpi_process_packet(u_char *args,
         workflow->pcap_d->inc_stats(pn);
     }
 
-    // cleanup (idle flows)
-    if (workflow->last_idle_scan_time + 10 < workflow->last_time) {
-        // scan for idle flows
-        ndpi_twalk(workflow->ndpi_flows_root[workflow->idle_scan_idx],
-                   node_idle_scan_walker,
-                   workflow);
-
-        // remove idle flows
-        while (workflow->num_idle_flows > 0) {
-            // search and delete the idle flow from the ndpi_flow_root
-            ndpi_tdelete(workflow->idle_flows[--workflow->num_idle_flows],
-                         &workflow->ndpi_flows_root[workflow->idle_scan_idx],
-                         ndpi_workflow_node_cmp);
-            // free mem associated with idle flows
-            ndpi_free_flow_info_half(workflow->idle_flows[workflow->num_idle_flows]);
-            ndpi_free(workflow->idle_flows[workflow->num_idle_flows]);
-        }
-        // update scan time
-        if (++workflow->idle_scan_idx == workflow->prefs.num_roots)
-            workflow->idle_scan_idx = 0;
-        workflow->last_idle_scan_time = workflow->last_time;
+    // cleanup (idle flows, oldest first)
+    workflow->flows->expire(workflow->last_time, Ndpi_flow_table::EXPIRE_MAX);
+}
+
+// pcap handler (vlan tags are in packet data)
+static void ndpi_process_packet(u_char *args,
+                                const pcap_pkthdr *header,
+                                const u_char *packet) {
+    ndpi_process_packet((ndpi_workflow_t *)args, header, packet, 0);
+}
+
+/*************************/
+/* ndpi detection module */
+/*************************/
+static ndpi_detection_module_struct *ndpi_module_new() {
+    // ndpi detection module
+    NDPI_PROTOCOL_BITMASK all;
+    set_ndpi_malloc(ndpi_malloc_wrapper);
+    set_ndpi_free(free_wrapper);
+    set_ndpi_flow_malloc(nullptr);
+    set_ndpi_flow_free(nullptr);
+    ndpi_detection_module_struct *m = ndpi_init_detection_module(ndpi_no_prefs);
+    if (!m) {
+        throw std::invalid_argument("cannot create ndpi detection module");
     }
+
+    // set ndpi bitmask
+    NDPI_BITMASK_SET_ALL(all);
+    ndpi_set_protocol_detection_bitmask2(m, &all);
+    ndpi_finalize_initialization(m);
+    return m;
+}
+
+/*****************/
+/* ndpi workflow */
+/*****************/
+static ndpi_workflow_t *ndpi_workflow_new(ndpi_detection_module_struct *m,
+                                          Pcap_d *pcap_d,
+                                          pcap_t *pcap_h,
+                                          int dlt,
+                                          Pcap_worker *worker) {
+    // init workflow struct
+    ndpi_workflow_t *workflow = (ndpi_workflow_t *)ndpi_calloc(1, sizeof(ndpi_workflow_t));
+    workflow->ndpi_struct = m;
+    workflow->prefs.max_ndpi_flows = max_flows;
+    workflow->flows = new Ndpi_flow_table(max_flows);
+    workflow->pcap_handle = pcap_h;
+    workflow->dlt = dlt;
+    workflow->pcap_d = pcap_d;
+    workflow->worker = worker;
+    return workflow;
+}
+
+static void ndpi_workflow_free(ndpi_workflow_t *workflow) {
+    ndpi_exit_detection_module(workflow->ndpi_struct);
+    delete workflow->flows;
+    ndpi_free(workflow);
 }
 
 /*************************/
@@ -918,6 +981,7 @@ static void thread_proc_packet(Pcap_d *pcap_d){
     char pcap_err_b[PCAP_ERRBUF_SIZE];
     pcap_t *pcap_h = nullptr;
     ndpi_detection_module_struct *m = nullptr;
+    int dlt = 0;
 
     // setuo
     try {
@@ -934,26 +998,13 @@ static void thread_proc_packet(Pcap_d *pcap_d){
         pcap_d->set_pcap_h(pcap_h);
 
         // datalink type check
-        int dlt = pcap_datalink(pcap_h);
+        dlt = pcap_datalink(pcap_h);
         if (!ndpi_is_datalink_supported(dlt)) {
             throw std::invalid_argument("unsupported datalink type");
         }
 
         // ndpi detection module
-        NDPI_PROTOCOL_BITMASK all;
-        set_ndpi_malloc(ndpi_malloc_wrapper);
-        set_ndpi_free(free_wrapper);
-        set_ndpi_flow_malloc(nullptr);
-        set_ndpi_flow_free(nullptr);
-        m = ndpi_init_detection_module(ndpi_no_prefs);
-        if (!m) {
-            throw std::invalid_argument("cannot create ndpi detection module");
-        }
-
-        // set ndpi bitmask
-        NDPI_BITMASK_SET_ALL(all);
-        ndpi_set_protocol_detection_bitmask2(m, &all);
-        ndpi_finalize_initialization(m);
+        m = ndpi_module_new();
 
     } catch (std::exception &e) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
@@ -966,31 +1017,208 @@ static void thread_proc_packet(Pcap_d *pcap_d){
     }
 
     // init workflow struct
-    ndpi_workflow_t *workflow = (ndpi_workflow_t *)ndpi_calloc(1, sizeof(ndpi_workflow_t));
-    workflow->ndpi_flows_root = (void **)ndpi_calloc(512, sizeof(void *));
-    workflow->ndpi_struct = m;
-    workflow->prefs.num_roots = 512;
-    workflow->prefs.max_ndpi_flows = 200000000;
-    workflow->pcap_handle = pcap_h;
-    workflow->pcap_d = pcap_d;
+    ndpi_workflow_t *workflow = ndpi_workflow_new(m, pcap_d, pcap_h, dlt, nullptr);
 
-    // process packets
-    int r = pcap_loop(pcap_h, -1, &ndpi_process_packet, (u_char *)workflow);
-    if (r == -1) {
-        ndpi_exit_detection_module(m);
-        ndpi_free(workflow->ndpi_flows_root);
-        ndpi_free(workflow);
-        pcap_close(pcap_h);
-        throw std::invalid_argument("error while capturing packets");
+    // process packets (read timeout or breakloop
+    // returns to termination check)
+    while (!mink::CURRENT_DAEMON->DAEMON_TERMINATED && cap_active.load()) {
+        int r = pcap_dispatch(pcap_h, -1, &ndpi_process_packet, (u_char *)workflow);
+        if (r == -1) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plg_ndpi: [%s: error while capturing packets]",
+                                      pcap_d->get_if().c_str());
+            break;
+        }
     }
 
     // cleanup
-    ndpi_exit_detection_module(m);
-    ndpi_free(workflow->ndpi_flows_root);
-    ndpi_free(workflow);
+    pcap_d->set_pcap_h(nullptr);
+    ndpi_workflow_free(workflow);
     pcap_close(pcap_h);
 }
 
+/*************************/
+/* AF_PACKET fanout ring */
+/*************************/
+// TPACKET_V3 rx ring; sockets of all workers join the
+// same PACKET_FANOUT_HASH group (symmetric flow hash, both
+// directions of a flow are received by the same worker)
+struct Fanout_cfg {
+    // number of workers
+    std::size_t workers = 1;
+    // ring (per worker, 4 MiB)
+    uint32_t block_size = 1 << 18;
+    uint32_t block_nr = 16;
+    uint32_t frame_size = 2048;
+    // lock ring pages in memory
+    bool lock = false;
+    // block retire timeout (msec)
+    uint32_t block_tmt = 60;
+    // fanout group id
+    uint16_t group = 0;
+};
+
+class Fanout_ring {
+public:
+    Fanout_ring() = default;
+    ~Fanout_ring() {
+        if (map_ != MAP_FAILED)
+            munmap(map_, map_sz_);
+        if (fd_ >= 0)
+            close(fd_);
+    }
+    Fanout_ring(const Fanout_ring &o) = delete;
+    Fanout_ring &operator=(const Fanout_ring &o) = delete;
+
+    void open(const std::string &if_n, const Fanout_cfg &cfg) {
+        // raw socket
+        fd_ = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+        if (fd_ < 0)
+            throw std::invalid_argument("cannot create AF_PACKET socket");
+
+        // interface (ethernet only)
+        ifreq ifr;
+        memset(&ifr, 0, sizeof(ifr));
+        strncpy(ifr.ifr_name, if_n.c_str(), IFNAMSIZ - 1);
+        if (ioctl(fd_, SIOCGIFINDEX, &ifr) < 0)
+            throw std::invalid_argument("unknown interface");
+        int ifidx = ifr.ifr_ifindex;
+        if (ioctl(fd_, SIOCGIFHWADDR, &ifr) < 0 ||
+            ifr.ifr_hwaddr.sa_family != ARPHRD_ETHER)
+            throw std::invalid_argument("unsupported datalink type");
+
+        // TPACKET_V3
+        int v = TPACKET_V3;
+        if (setsockopt(fd_, SOL_PACKET, PACKET_VERSION, &v, sizeof(v)) < 0)
+            throw std::invalid_argument("TPACKET_V3 not supported");
+
+        // rx ring
+        tpacket_req3 req;
+        memset(&req, 0, sizeof(req));
+        req.tp_block_size = cfg.block_size;
+        req.tp_block_nr = cfg.block_nr;
+        req.tp_frame_size = cfg.frame_size;
+        req.tp_frame_nr = (cfg.block_size * cfg.block_nr) / cfg.frame_size;
+        req.tp_retire_blk_tov = cfg.block_tmt;
+        if (setsockopt(fd_, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0)
+            throw std::invalid_argument("cannot create rx ring");
+        map_sz_ = (std::size_t)cfg.block_size * cfg.block_nr;
+        map_ = mmap(nullptr,
+                    map_sz_,
+                    PROT_READ | PROT_WRITE,
+                    MAP_SHARED | (cfg.lock ? MAP_LOCKED : 0),
+                    fd_,
+                    0);
+        if (map_ == MAP_FAILED)
+            throw std::invalid_argument("cannot map rx ring");
+        block_size_ = cfg.block_size;
+        block_nr_ = cfg.block_nr;
+
+        // bind
+        sockaddr_ll ll;
+        memset(&ll, 0, sizeof(ll));
+        ll.sll_family = AF_PACKET;
+        ll.sll_protocol = htons(ETH_P_ALL);
+        ll.sll_ifindex = ifidx;
+        if (bind(fd_, (sockaddr *)&ll, sizeof(ll)) < 0)
+            throw std::invalid_argument("cannot bind AF_PACKET socket");
+
+        // promiscuous mode
+        packet_mreq mr;
+        memset(&mr, 0, sizeof(mr));
+        mr.mr_ifindex = ifidx;
+        mr.mr_type = PACKET_MR_PROMISC;
+        setsockopt(fd_, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mr, sizeof(mr));
+
+        // join fanout group
+        int fo = cfg.group | ((PACKET_FANOUT_HASH | PACKET_FANOUT_FLAG_DEFRAG) << 16);
+        if (setsockopt(fd_, SOL_PACKET, PACKET_FANOUT, &fo, sizeof(fo)) < 0)
+            throw std::invalid_argument("cannot join fanout group");
+    }
+
+    // process ready blocks; returns when there is no
+    // data after poll timeout (msec)
+    template<typename F>
+    void read(int tmt, F &&f) {
+        auto *bd = (tpacket_block_desc *)((uint8_t *)map_ + (std::size_t)blk_ * block_size_);
+        // wait for block
+        if (!(__atomic_load_n(&bd->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER)) {
+            pollfd pfd;
+            pfd.fd = fd_;
+            pfd.events = POLLIN | POLLERR;
+            pfd.revents = 0;
+            poll(&pfd, 1, tmt);
+            return;
+        }
+        // packets in block
+        auto *ph = (tpacket3_hdr *)((uint8_t *)bd + bd->hdr.bh1.offset_to_first_pkt);
+        for (uint32_t i = 0; i < bd->hdr.bh1.num_pkts; i++) {
+            pcap_pkthdr h;
+            h.ts.tv_sec = ph->tp_sec;
+            h.ts.tv_usec = ph->tp_nsec / 1000;
+            h.caplen = ph->tp_snaplen;
+            h.len = ph->tp_len;
+            // vlan tag stripped by kernel
+            uint16_t vlan = 0;
+            if (ph->tp_status & TP_STATUS_VLAN_VALID)
+                vlan = ph->hv1.tp_vlan_tci & 0xfff;
+            f(&h, (const u_char *)ph + ph->tp_mac, vlan);
+            ph = (tpacket3_hdr *)((uint8_t *)ph + ph->tp_next_offset);
+        }
+        // return block to kernel
+        __atomic_store_n(&bd->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+        blk_ = (blk_ + 1) % block_nr_;
+    }
+
+private:
+    int fd_ = -1;
+    void *map_ = MAP_FAILED;
+    std::size_t map_sz_ = 0;
+    uint32_t block_size_ = 0;
+    uint32_t block_nr_ = 0;
+    uint32_t blk_ = 0;
+};
+
+/********************************/
+/* fanout packet capture thread */
+/********************************/
+static void thread_proc_fanout(Pcap_d *pcap_d, Fanout_cfg cfg, std::size_t w_idx){
+    Fanout_ring ring;
+    ndpi_detection_module_struct *m = nullptr;
+    Pcap_worker *worker = pcap_d->get_worker(w_idx);
+
+    // setup
+    try {
+        ring.open(pcap_d->get_if(), cfg);
+        // ndpi detection module (private)
+        m = ndpi_module_new();
+
+    } catch (std::exception &e) {
+        mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                  "plg_ndpi: [%s: worker %lu: %s]",
+                                  pcap_d->get_if().c_str(),
+                                  w_idx,
+                                  e.what());
+        return;
+    }
+
+    // stats
+    worker->init(m);
+
+    // private workflow (flow table)
+    ndpi_workflow_t *workflow = ndpi_workflow_new(m, pcap_d, nullptr, DLT_EN10MB, worker);
+
+    // process packets
+    while (!mink::CURRENT_DAEMON->DAEMON_TERMINATED && cap_active.load()) {
+        ring.read(500, [workflow](const pcap_pkthdr *h, const u_char *p, uint16_t vlan) {
+            ndpi_process_packet(workflow, h, p, vlan);
+        });
+    }
+
+    // cleanup
+    ndpi_workflow_free(workflow);
+}
+
 /********************************/
 /* Process static configuration */
 /********************************/
@@ -1008,10 +1236,42 @@ static int process_cfg(mink_utils::PluginManager *pm) {
 
     // process
     try {
+        // flow table size (per workflow)
+        max_flows = pcfg->value("max_flows", 0);
         // get interfaces
         auto j_if_lst = pcfg->at("interfaces");
         // loop interfaces
         for(auto it_if = j_if_lst.begin(); it_if != j_if_lst.end(); ++ it_if) {
+            // fanout capture (object)
+            // {"name": "eth0", "workers": 4, ...}
+            if (it_if->is_object()) {
+                Fanout_cfg cfg;
+                std::string if_n = it_if->at("name").get<std::string>();
+                cfg.workers = it_if->value("workers", cfg.workers);
+                cfg.block_size = it_if->value("block_size", cfg.block_size);
+                cfg.block_nr = it_if->value("block_nr", cfg.block_nr);
+                cfg.frame_size = it_if->value("frame_size", cfg.frame_size);
+                cfg.block_tmt = it_if->value("block_timeout", cfg.block_tmt);
+                cfg.lock = it_if->value("lock_ring", cfg.lock);
+                if (cfg.workers == 0 || cfg.frame_size == 0 || cfg.block_nr == 0 ||
+                    cfg.block_size % getpagesize() != 0 ||
+                    cfg.block_size % cfg.frame_size != 0) {
+                    throw std::invalid_argument("invalid fanout configuration");
+                }
+                // fanout group (unique per interface)
+                cfg.group = (getpid() + std::distance(j_if_lst.begin(), it_if)) & 0xffff;
+                // add interface
+                Pcap_d &pcap_d = pcap_mngr.add_pcap(if_n);
+                pcap_d.set_workers(cfg.workers);
+                // init capture workers
+                for (std::size_t i = 0; i < cfg.workers; i++)
+                    cap_threads.push_back(std::thread(&thread_proc_fanout, &pcap_d, cfg, i));
+                mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                                          "plg_ndpi: [%s: fanout capture, %lu workers]",
+                                          if_n.c_str(),
+                                          cfg.workers);
+                continue;
+            }
             // sanity check
             if(!it_if->is_string()){
                 throw std::invalid_argument("interface != string");
@@ -1019,8 +1279,7 @@ static int process_cfg(mink_utils::PluginManager *pm) {
             // add interface
             Pcap_d &pcap_d = pcap_mngr.add_pcap(*it_if);
             // init process match thread
-            std::thread th(&thread_proc_packet, &pcap_d);
-            th.detach();
+            cap_threads.push_back(std::thread(&thread_proc_packet, &pcap_d));
         }
 
     } catch(std::exception &e) {
@@ -1036,6 +1295,8 @@ static int process_cfg(mink_utils::PluginManager *pm) {
 /* init handler */
 /****************/
 extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // module state can be left from previous init
+    cap_active = true;
     // process cfg
     if (process_cfg(pm)) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
@@ -1050,6 +1311,15 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
 /* terminate handler */
 /*********************/
 extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // stop capture threads (fanout workers wake
+    // up on poll timeout)
+    cap_active = false;
+    pcap_mngr.process_pcaps([](Pcap_d &d) { d.breakloop(); });
+    for (auto &th : cap_threads)
+        th.join();
+    cap_threads.clear();
+    // interfaces are re-added by next init
+    pcap_mngr.clear();
     return 0;
 }
 
@@ -1058,7 +1328,7 @@ extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescri
 /**********************/
 static void do_get_stats(const std::string &if_n, json *j_d) {
     // get pcap descriptor
-    auto pcap_d = pcap_mngr.get_pcap(if_n);
+    auto &pcap_d = pcap_mngr.get_pcap(if_n);
     // get stats
     std::map<std::string, uint64_t> out;
     pcap_d.get_stats(out);
@@ -1104,7 +1374,7 @@ static void impl_local_get_stats(mink_utils::Plugin_data_std *args) {
     // clear args (will be used for output)
     args->clear();
     // get pcap descriptor
-    auto pcap_d = pcap_mngr.get_pcap(if_s);
+    auto &pcap_d = pcap_mngr.get_pcap(if_s);
     // get stats
     std::map<std::string, uint64_t> out;
     pcap_d.get_stats(out);
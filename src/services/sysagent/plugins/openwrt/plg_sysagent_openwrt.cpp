@@ -12,6 +12,7 @@
 #include "gdt_def.h"
 #include <thread>
 #include <future>
+#include <condition_variable>
 #include <mink_plugin.h>
 #include <gdt_utils.h>
 #include <mink_err_codes.h>
@@ -28,7 +29,6 @@ extern "C" {
     #include <libubox/blobmsg_json.h>
 }
 #include <boost/beast/core/detail/base64.hpp>
-#include <zlib.h>
 
 /*********/
 /* types */
@@ -77,13 +77,20 @@ class ubus_correlation {
 public:
     ubus_correlation() = default;
     ubus_correlation(gdt::ServiceMessage *_smsg) : smsg(_smsg) {}
+    ubus_correlation(gdt::ServiceMessage *_smsg,
+                     mink_utils::PluginCompletion *_done)
+        : smsg(_smsg)
+        , done(_done) {}
     ubus_correlation(const ubus_correlation &o) = delete;
     ubus_correlation(ubus_correlation &&o)
         : ready(std::move(o.ready))
-        , smsg(o.smsg) {}
+        , smsg(o.smsg)
+        , done(o.done) {}
 
     std::promise<gdt::ServiceMessage *> ready;
     gdt::ServiceMessage *smsg;
+    // async request (no waiter)
+    mink_utils::PluginCompletion *done = nullptr;
 };
 
 
@@ -95,31 +102,81 @@ public:
     UbusHandler(){
         connect();
     }
+
+    void start() {
+        std::unique_lock<std::mutex> l(mtx_);
+        if (active_)
+            return;
+        active_ = true;
+        th_ = std::thread(&UbusHandler::run, this);
+    }
+
+    // stop ubus thread; requests still queued are
+    // completed with error (smsg is freed by caller)
+    void stop() {
+        std::unique_lock<std::mutex> l(mtx_);
+        if (!active_)
+            return;
+        active_ = false;
+        l.unlock();
+        cv_.notify_one();
+        th_.join();
+        l.lock();
+        std::deque<ubus_correlation> pending;
+        pending.swap(q_);
+        l.unlock();
+        for (auto &d : pending) {
+            set_error(d.smsg, mink::error::EC_UNKNOWN);
+            complete(d, mink::error::EC_UNKNOWN);
+        }
+    }
+
     void run() {
-        while (!mink::DaemonDescriptor::DAEMON_TERMINATED) {
-            std::unique_lock<std::mutex> l(mtx_);
-            if (!q_.empty()) {
-                auto &d = q_.front();
-                process(d);
-                // unlock to allow queuing while processing
-                d.ready.set_value(d.smsg);
-                l.unlock();
-                // pop
-                l.lock();
-                q_.pop_front();
-                l.unlock();
-                // next
+        std::unique_lock<std::mutex> l(mtx_);
+        while (active_ && !mink::DaemonDescriptor::DAEMON_TERMINATED) {
+            // wait for requests (timeout for
+            // termination check)
+            if (q_.empty()) {
+                cv_.wait_for(l, std::chrono::seconds(1));
                 continue;
             }
+            // take all queued requests, producers are
+            // not blocked while ubus calls are running
+            std::deque<ubus_correlation> batch;
+            batch.swap(q_);
             l.unlock();
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            for (auto &d : batch) {
+                process(d);
+                complete(d, 0);
+            }
+            l.lock();
         }
     }
 
     std::future<gdt::ServiceMessage *> add(ubus_correlation &d){
         std::unique_lock<std::mutex> l(mtx_);
         q_.push_back(std::move(d));
-        return q_.back().ready.get_future();
+        auto f = q_.back().ready.get_future();
+        l.unlock();
+        cv_.notify_one();
+        return f;
+    }
+
+    // async variant, completion is signalled
+    // from ubus thread
+    void add_async(ubus_correlation &d){
+        std::unique_lock<std::mutex> l(mtx_);
+        q_.push_back(std::move(d));
+        l.unlock();
+        cv_.notify_one();
+    }
+
+    // signal waiter or run completion (no locks held)
+    static void complete(ubus_correlation &d, int res) {
+        if (d.done)
+            d.done->done(res);
+        else
+            d.ready.set_value(d.smsg);
     }
 
     void set_error(gdt::ServiceMessage *smsg, int ec) {
@@ -235,7 +292,10 @@ public:
 
 private:
     std::mutex mtx_;
+    std::condition_variable cv_;
     std::deque<ubus_correlation> q_;
+    std::thread th_;
+    bool active_ = false;
     ubus_context *ctx = nullptr;
 };
 
@@ -259,8 +319,7 @@ extern "C" constexpr int COMMANDS[] = {
 /* init handler */
 /****************/
 extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
-    std::thread th_ubus(&UbusHandler::run, &uh);
-    th_ubus.detach();
+    uh.start();
     return 0;
 }
 
@@ -268,7 +327,7 @@ extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor
 /* terminate handler */
 /*********************/
 extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
-    //if(ctx) ubus_free(ctx);
+    uh.stop();
     return 0;
 }
 
@@ -372,57 +431,8 @@ static void ubus_event_cb(ubus_request *req, int type, blob_attr *msg){
                                 ->get_param_factory()
                                 ->new_param(gdt::SPT_OCTETS);
     if(sp){
-        // compress
-        z_stream zs;
-        zs.zalloc = Z_NULL;
-        zs.zfree = Z_NULL;
-        zs.opaque = Z_NULL;
-        size_t buff_sz = strlen(ic->ev_usr_cb->buff);
-        // input size
-        zs.avail_in = buff_sz;
-        // input data
-        zs.next_in = (Bytef *)ic->ev_usr_cb->buff;
-        //output buffer size
-        char z_out_buff[zs.avail_in * 2];
-        zs.avail_out = sizeof(z_out_buff);
-        zs.next_out = (Bytef *)z_out_buff;
-        // init struct
-        if(deflateInit(&zs, Z_BEST_COMPRESSION) != Z_OK){
-            set_ubus_error(ic->smsg, mink::error::EC_UNKNOWN);
-            // cleanup
-            blob_buf_free(&ic->msg);
-            delete ic->ev_usr_cb;
-            delete ic;
-            return;
-        }
-        // compress data
-        int zres = deflate(&zs, Z_FINISH);
-        if(zres != Z_STREAM_END){
-            set_ubus_error(ic->smsg, mink::error::EC_UNKNOWN);
-            // cleanup
-            blob_buf_free(&ic->msg);
-            delete ic->ev_usr_cb;
-            delete ic;
-            return;
-
-        }
-        // finish
-        if(deflateEnd(&zs) != Z_OK){
-            set_ubus_error(ic->smsg, mink::error::EC_UNKNOWN);
-            // cleanup
-            blob_buf_free(&ic->msg);
-            delete ic->ev_usr_cb;
-            delete ic;
-            return;
-        }
-        // switch buffers
-        // size check (realloc is fine since libubus is a C lib)
-        if (zs.total_out > buff_sz)
-            ic->ev_usr_cb->buff = (char *)realloc(ic->ev_usr_cb->buff,
-                                                  zs.total_out);
-
-        memcpy(ic->ev_usr_cb->buff, z_out_buff, zs.total_out);
-        sp->set_data(ic->ev_usr_cb->buff, zs.total_out);
+        // compressed by GDT layer if supported
+        sp->set_data(ic->ev_usr_cb->buff, strlen(ic->ev_usr_cb->buff));
         sp->set_id(PT_OWRT_UBUS_RESULT);
         sp->set_extra_type(0);
         pmap->push_back(sp);
@@ -499,4 +509,25 @@ extern "C" int run(mink_utils::PluginManager *pm,
     return 0;
 }
 
+/*************************/
+/* async command handler */
+/*************************/
+extern "C" int run_async(mink_utils::PluginManager *pm,
+                         mink_utils::PluginDescriptor *pd,
+                         int cmd_id,
+                         mink_utils::PluginInputData &p_id,
+                         mink_utils::PluginCompletion *c){
 
+    // sanity/type check
+    if (!(p_id.data() && p_id.type() == mink_utils::PLG_DT_GDT))
+        return 1;
+
+    // ubus calls are finished in ubus thread; other
+    // commands use sync handler
+    if (cmd_id != gdt_grpc::CMD_UBUS_CALL)
+        return mink_utils::PLG_ASYNC_NA;
+
+    ubus_correlation uc{static_cast<gdt::ServiceMessage *>(p_id.data()), c};
+    uh.add_async(uc);
+    return 0;
+}
@@ -24,7 +24,6 @@
 #include <gdt.pb.enums_only.h>
 #endif
 #include <boost/asio.hpp>
-#include <zlib.h>
 #include <sysagent.h>
 
 /**********************************************/
@@ -83,19 +82,6 @@ mink_utils::Guid guid;
 int udp_port = -1;
 
 
-/**********************/
-/* zLib error handler */
-/**********************/
-static void handle_zlib_error(gdt::ServiceMsgManager *smsgm,
-                              gdt::ServiceMessage *smsg,
-                              EVUserCB *ev_usr_cb){
-
-    smsg->vpmap.set_cstr(gdt_grpc::PT_MINK_ERROR,
-                         std::to_string(mink::error::EC_UNKNOWN).c_str());
-
-
-}
-
 /****************/
 /* Push via GDT */
 /****************/
@@ -118,6 +104,13 @@ static void gdt_push(const std::string data,
     // null check
     if (!gdtc) return;
 
+    // backpressure, wait for out queue capacity
+    if (smsgm->wait_capacity(gdtc, 100) != 0) {
+        mink::CURRENT_DAEMON->log(mink::LLT_WARNING,
+                                  "GDT out queue congested, dropping LOGLINE");
+        return;
+    }
+
     // allocate new service message
     gdt::ServiceMessage *smsg = smsgm->new_smsg();
     // msg sanity check
@@ -135,51 +128,11 @@ static void gdt_push(const std::string data,
         return;
     }
 
-    /************/
-    /* compress */
-    /************/
-    z_stream zs;
-    zs.zalloc = Z_NULL;
-    zs.zfree = Z_NULL;
-    zs.opaque = Z_NULL;
-    size_t buff_sz = data.size();
-    // input size
-    zs.avail_in = buff_sz;
-    // input data
-    zs.next_in = (Bytef *)data.data();
-    // async data buffer
+    // async data buffer (compressed by GDT layer if supported)
     EVUserCB *ev_usr_cb = new EVUserCB();
     // attach to smsg
     smsg->params.set_param(3, ev_usr_cb);
-    //output buffer size
-    ev_usr_cb->buff.resize(zs.avail_in * 2 + 8);
-    zs.avail_out = ev_usr_cb->buff.size();
-    zs.next_out = (Bytef *)ev_usr_cb->buff.data();
-    // init struct
-    if(deflateInit(&zs, Z_BEST_COMPRESSION) != Z_OK){
-        handle_zlib_error(smsgm, smsg, ev_usr_cb);
-        deflateEnd(&zs);
-        delete ev_usr_cb;
-        smsgm->free_smsg(smsg);
-        return;
-    }
-    // compress data
-    int zres = deflate(&zs, Z_FINISH);
-    if(zres != Z_STREAM_END){
-        handle_zlib_error(smsgm, smsg, ev_usr_cb);
-        deflateEnd(&zs);
-        delete ev_usr_cb;
-        smsgm->free_smsg(smsg);
-        return;
-    }
-
-    // finish
-    if(deflateEnd(&zs) != Z_OK){
-        handle_zlib_error(smsgm, smsg, ev_usr_cb);
-        delete ev_usr_cb;
-        smsgm->free_smsg(smsg);
-        return;
-    }
+    ev_usr_cb->buff.assign(data.cbegin(), data.cend());
 
     // set guid
     smsg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, guid.data(), 16);
@@ -194,10 +147,8 @@ static void gdt_push(const std::string data,
     smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id,
                          dd->get_daemon_id());
 
-    // resize buffer
-    ev_usr_cb->buff.resize(zs.total_out);
     // set sparam
-    sp->set_data(ev_usr_cb->buff.data(), zs.total_out);
+    sp->set_data(ev_usr_cb->buff.data(), ev_usr_cb->buff.size());
     sp->set_id(gdt_grpc::PT_SL_LOGLINE);
     sp->set_extra_type(0);
     ev_usr_cb->pmap.push_back(sp);
@@ -212,6 +163,9 @@ static void gdt_push(const std::string data,
     }
 
 
+    // bulk transfer, do not delay control traffic
+    smsg->set_priority(gdt::GDT_PRIO_BULK);
+
     // send service message
     int r = smsgm->send(smsg,
                         gdtc,
@@ -43,6 +43,12 @@ extern "C" constexpr int COMMANDS[] = {
     -1
 };
 
+/**************/
+/* hot reload */
+/**************/
+// stateless, safe to unload
+extern "C" constexpr int UNLOADABLE = 1;
+
 /****************/
 /* init handler */
 /****************/
@@ -10,9 +10,9 @@
 
 #include "daemon.h"
 #include <boost/asio/io_context.hpp>
-#include <boost/signals2.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
 #include <exception>
+#include <cctype>
 #include <memory>
 #include <mink_plugin.h>
 #include <gdt_utils.h>
@@ -26,11 +26,14 @@
 #include <thread>
 #include <sysagent.h>
 #include <json_rpc.h>
+#include "unix_framer.h"
 #include <mink_err_codes.h>
 #include <boost/bind/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/asio.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <deque>
 #include <boost/array.hpp>
 #include <boost/filesystem.hpp>
 
@@ -55,6 +58,8 @@ extern "C" constexpr int COMMANDS[] = {
 /* SIGNALS */
 /***********/
 const std::string SIG_UNIX_RX = "unix:RX";
+// interned signal id (set in init)
+static int sig_unix_rx = -1;
 
 /*************/
 /* Plugin ID */
@@ -64,15 +69,30 @@ static const char *PLG_ID = "plg_sysagent_unix.so";
 /****************/
 /* UNIX session */
 /****************/
+// Framing depends on connection encoding (see Unix_framer).
+// Requests are processed in worker pool, replies are
+// sent in completion order (correlated by JSON RPC id)
 class session : public boost::enable_shared_from_this<session> {
 public:
-    session(boost::asio::io_context &io_context, mink_utils::PluginManager *pm)
+    session(boost::asio::io_context &io_context,
+            boost::asio::thread_pool &workers,
+            mink_utils::PluginManager *pm)
         : socket_(io_context)
+        , workers_(workers)
         , pm_(pm) {}
 
     bl::socket &socket() { return socket_; }
 
     void start() {
+        do_read();
+    }
+
+    void do_read() {
+        // read in progress or too many outstanding requests
+        // (resumed when reply is sent)
+        if (reading_ || closed_ || inflight_ >= MAX_INFLIGHT)
+            return;
+        reading_ = true;
         socket_.async_read_some(boost::asio::buffer(data_),
                                 boost::bind(&session::handle_read,
                                             shared_from_this(),
@@ -84,117 +104,178 @@ public:
     void handle_read(mink_utils::PluginManager *pm,
                      const boost::system::error_code &error,
                      size_t bytes_transferred) {
-        if (error)
+        reading_ = false;
+        if (error) {
+            closed_ = true;
             return;
+        }
+
+        // extract complete frames (requests can be split
+        // or coalesced)
+        bool ok = framer_.feed(data_.data(),
+                               bytes_transferred,
+                               [this, pm](std::string &&req) {
+                                   dispatch(pm, std::move(req));
+                               });
+
+        // frame or partial frame too big, drop connection
+        if (!ok) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plg_unix: [request too big, closing connection]");
+            closed_ = true;
+            boost::system::error_code ec;
+            socket_.close(ec);
+            return;
+        }
+
+        do_read();
+    }
 
+    // run request in worker pool
+    void dispatch(mink_utils::PluginManager *pm, std::string &&req) {
+        ++inflight_;
+        auto self = shared_from_this();
+        auto rq = std::make_shared<std::string>(std::move(req));
+        boost::asio::post(workers_, [self, pm, rq]() {
+            auto rpl = std::make_shared<std::string>(self->process(pm, *rq));
+            // back to io thread
+            boost::asio::post(self->socket_.get_executor(), [self, rpl]() {
+                --self->inflight_;
+                self->send(std::move(*rpl));
+                self->do_read();
+            });
+        });
+    }
+
+    // worker thread
+    std::string process(mink_utils::PluginManager *pm, const std::string &req) const {
         // parse
-        std::string rpc_data(data_.data(), bytes_transferred);
-        json j = json::parse(rpc_data, nullptr, false);
-        std::string rpl;
+        json j = json_rpc::decode(req.data(), req.size(), framer_.encoding());
         // malformed
         if (j.is_discarded()){
-            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                      "JSON RPC malformed = %s",
-                                      rpc_data.c_str());
-
-            rpl = json_rpc::JsonRpc::gen_err(mink::error::EC_JSON_MALFORMED).dump();
-            rpl.append("\n");
-            boost::asio::async_write(socket_,
-                                     boost::asio::buffer(rpl),
-                                     boost::bind(&session::handle_write,
-                                                 shared_from_this(),
-                                                 pm,
-                                                 boost::asio::placeholders::error));
-            return;
+            if (framer_.encoding() == json_rpc::ENC_JSON)
+                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                          "JSON RPC malformed = %s",
+                                          req.c_str());
+
+            return encode(json_rpc::JsonRpc::gen_err(mink::error::EC_JSON_MALFORMED));
+        }
 
         // valid JSON RPC
-        }else{
-            int id = -1;
-            int m = -1;
-            try {
-                // create json rpc parser
-                json_rpc::JsonRpc jrpc(j);
-                // verify
-                jrpc.verify(true);
-                // get id
-                id = jrpc.get_id();
-                // get method
-                m = jrpc.get_method_id();
-                if (m <= 0) {
-                    throw std::invalid_argument("invalid JSON RPC method");
-                }
-                // run method
-                pm->run(m,
-                        mink_utils::PluginInputData(mink_utils::PLG_DT_JSON_RPC,
-                                                    &j),
-                        true);
-
-                // process signal
-                mink_utils::Plugin_data_std e_d;
-                e_d.push_back({{"", j.dump()}});
-                pm->process_signal(SIG_UNIX_RX, e_d);
-
-                // generate empty json rpc reply
-                auto j_res = json_rpc::JsonRpc::gen_response(id);
-                // use "result" data
-                if (j.find(Jrpc::RESULT_) != j.end())
-                    j_res[Jrpc::RESULT_] = j[Jrpc::RESULT_];
-
-                // or use "error" data
-                else if (j.find(Jrpc::ERROR_) != j.end())
-                    j_res[Jrpc::ERROR_] = j[Jrpc::ERROR_];
-
-                // res string
-                std::string s_res(j_res.dump() + "\n");
-                // send response
-                boost::asio::async_write(socket_,
-                                         boost::asio::buffer(s_res, s_res.size()),
-                                         boost::bind(&session::handle_write,
-                                                     shared_from_this(),
-                                                     pm,
-                                                     boost::asio::placeholders::error));
-
-            } catch (std::exception &e) {
-                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
-                                          "JSON RPC error = [%s]",
-                                          e.what());
-                // generate JSON RPC error
-                rpl = json_rpc::JsonRpc::gen_err(mink::error::EC_JSON_MALFORMED,
-                                                 id,
-                                                 e.what()).dump();
-                rpl.append("\n");
-                boost::asio::async_write(socket_,
-                                         boost::asio::buffer(rpl),
-                                         boost::bind(&session::handle_write,
-                                                     shared_from_this(),
-                                                     pm,
-                                                     boost::asio::placeholders::error));
+        int id = -1;
+        int m = -1;
+        try {
+            // create json rpc parser
+            json_rpc::JsonRpc jrpc(j);
+            // verify
+            jrpc.verify(true);
+            // get id
+            id = jrpc.get_id();
+            // get method
+            m = jrpc.get_method_id();
+            if (m <= 0) {
+                throw std::invalid_argument("invalid JSON RPC method");
             }
+            // run method
+            pm->run(m,
+                    mink_utils::PluginInputData(mink_utils::PLG_DT_JSON_RPC,
+                                                &j),
+                    true);
+
+            // process signal
+            std::string j_s = j.dump();
+            mink_utils::PluginData e_d;
+            e_d.add_ref(e_d.add_row(), "", j_s);
+            pm->process_signal(sig_unix_rx, e_d);
+
+            // generate empty json rpc reply
+            auto j_res = json_rpc::JsonRpc::gen_response(id);
+            // use "result" data
+            if (j.find(Jrpc::RESULT_) != j.end())
+                j_res[Jrpc::RESULT_] = j[Jrpc::RESULT_];
+
+            // or use "error" data
+            else if (j.find(Jrpc::ERROR_) != j.end())
+                j_res[Jrpc::ERROR_] = j[Jrpc::ERROR_];
+
+            return encode(j_res);
+
+        } catch (std::exception &e) {
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "JSON RPC error = [%s]",
+                                      e.what());
+            // generate JSON RPC error
+            return encode(json_rpc::JsonRpc::gen_err(mink::error::EC_JSON_MALFORMED,
+                                                     id,
+                                                     e.what()));
         }
     }
 
+    // io thread
+    void send(std::string &&rpl) {
+        if (closed_)
+            return;
+        wq_.push_back(std::move(rpl));
+        do_write();
+    }
+
+    void do_write() {
+        if (writing_ || wq_.empty())
+            return;
+        writing_ = true;
+        boost::asio::async_write(socket_,
+                                 boost::asio::buffer(wq_.front()),
+                                 boost::bind(&session::handle_write,
+                                             shared_from_this(),
+                                             pm_,
+                                             boost::asio::placeholders::error));
+    }
+
     void handle_write(mink_utils::PluginManager *pm,
                       const boost::system::error_code &error) {
-        if (error)
+        writing_ = false;
+        wq_.pop_front();
+        if (error) {
+            closed_ = true;
+            wq_.clear();
             return;
-
-        socket_.async_read_some(boost::asio::buffer(data_),
-                                boost::bind(&session::handle_read,
-                                            shared_from_this(),
-                                            pm,
-                                            boost::asio::placeholders::error,
-                                            boost::asio::placeholders::bytes_transferred));
+        }
+        do_write();
     }
 
+    // limits
+    static constexpr int MAX_INFLIGHT = 32;
+
 private:
+    // reply frame in connection encoding
+    std::string encode(const json &j) const {
+        return framer_.frame(json_rpc::encode(j, framer_.encoding()));
+    }
+
     // The socket used to communicate with the client.
     bl::socket socket_;
 
     // Buffer used to store data received from the client.
     boost::array<char, 65536> data_;
 
+    // request framing and connection encoding
+    // (set before first dispatch)
+    Unix_framer framer_;
+
+    // pending replies (io thread)
+    std::deque<std::string> wq_;
+
+    // request workers
+    boost::asio::thread_pool &workers_;
+
     // plugin manager
     mink_utils::PluginManager *pm_;
+
+    // io thread state
+    int inflight_ = 0;
+    bool reading_ = false;
+    bool writing_ = false;
+    bool closed_ = false;
 };
 
 /***************/
@@ -203,13 +284,15 @@ private:
 class server {
 public:
     server(boost::asio::io_context &io_context,
+           boost::asio::thread_pool &workers,
            const std::string &file,
            mink_utils::PluginManager *pm)
         : io_context_(io_context)
+        , workers_(workers)
         , acceptor_(io_context, bl::endpoint(file))
         , pm_(pm) {
 
-        session_ptr new_session(new session(io_context_, pm));
+        session_ptr new_session(new session(io_context_, workers_, pm));
         acceptor_.async_accept(new_session->socket(),
                                boost::bind(&server::handle_accept,
                                            this,
@@ -225,7 +308,7 @@ public:
             new_session->start();
         }
 
-        new_session.reset(new session(io_context_, pm));
+        new_session.reset(new session(io_context_, workers_, pm));
         acceptor_.async_accept(new_session->socket(),
                                boost::bind(&server::handle_accept,
                                            this,
@@ -236,6 +319,7 @@ public:
 
 private:
     boost::asio::io_context &io_context_;
+    boost::asio::thread_pool &workers_;
     bl::acceptor acceptor_;
     mink_utils::PluginManager *pm_;
 };
@@ -243,12 +327,17 @@ private:
 /**********************/
 /* UNIX server thread */
 /**********************/
-static void thread_unix(const std::string &s_fp, mink_utils::PluginManager *pm){
+static void thread_unix(const std::string &s_fp,
+                        const int workers,
+                        mink_utils::PluginManager *pm){
     try {
         // remove old socket
         bfs::remove(s_fp);
         boost::asio::io_context io_ctx;
-        server s(io_ctx, s_fp, pm);
+        // request workers (slow commands do not
+        // block the acceptor/io thread)
+        boost::asio::thread_pool wp(workers);
+        server s(io_ctx, wp, s_fp, pm);
         io_ctx.run();
     } catch (std::exception &e) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR, "plg_unix: [%s]", e.what());
@@ -291,8 +380,16 @@ static int process_cfg(mink_utils::PluginManager *pm) {
         }
         // socket string
         std::string s_sck = j_sck.get<std::string>();
+        // number of workers (optional)
+        int workers = 4;
+        auto it_w = it->find("workers");
+        if (it_w != it->end()) {
+            if (!it_w->is_number_unsigned() || it_w->get<int>() < 1)
+                throw std::invalid_argument("workers element != positive integer");
+            workers = it_w->get<int>();
+        }
         // init unix server thread
-        std::thread th(&thread_unix, s_sck, pm);
+        std::thread th(&thread_unix, s_sck, workers, pm);
         th.detach();
 
 
@@ -308,6 +405,8 @@ static int process_cfg(mink_utils::PluginManager *pm) {
 /* init handler */
 /****************/
 extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    // signals (before server is started)
+    sig_unix_rx = pm->signal_id(SIG_UNIX_RX);
     // process cfg
     if (process_cfg(pm)) {
         mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
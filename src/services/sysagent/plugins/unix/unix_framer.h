@@ -0,0 +1,165 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef SYSAGENTD_UNIX_FRAMER_H
+#define SYSAGENTD_UNIX_FRAMER_H
+
+#include <string>
+#include <cctype>
+#include <json_rpc.h>
+
+// Request framing for UNIX socket connections; framing
+// depends on connection encoding:
+//  - JSON text: one top-level object per request (newline
+//    terminator is optional) or one request per line
+//  - CBOR: 4 byte length prefix (network byte order)
+// Connection encoding is selected by first request
+class Unix_framer {
+public:
+    // append received data (requests can be split or
+    // coalesced) and pass complete frames to f; false
+    // if frame or partial frame is too big
+    template <typename F>
+    bool feed(const char *data, const std::size_t sz, F &&f) {
+        if (!enc_set_) {
+            enc_ = json_rpc::detect_encoding(data, sz);
+            enc_set_ = true;
+        }
+        rbuf_.append(data, sz);
+
+        // extract complete frames
+        std::size_t pos = 0;
+        bool too_big = false;
+        for (;;) {
+            std::size_t fs = 0;
+            std::size_t hs = 0;
+            if (enc_ == json_rpc::ENC_JSON) {
+                // skip whitespace between requests
+                while (pos < rbuf_.size() && std::isspace((unsigned char)rbuf_[pos]))
+                    ++pos;
+                if (pos == rbuf_.size())
+                    break;
+                // complete top-level object (with or
+                // without newline)
+                if (rbuf_[pos] == '{') {
+                    std::size_t end = json_obj_end(pos);
+                    if (end == std::string::npos)
+                        break;
+                    f(rbuf_.substr(pos, end - pos));
+                    pos = end;
+                    continue;
+                }
+                std::size_t nl = rbuf_.find('\n', pos);
+                if (nl == std::string::npos)
+                    break;
+                fs = nl - pos;
+                // empty line
+                if (fs == 0 || (fs == 1 && rbuf_[pos] == '\r')) {
+                    pos = nl + 1;
+                    continue;
+                }
+                f(rbuf_.substr(pos, fs));
+                pos = nl + 1;
+
+            } else {
+                if (rbuf_.size() - pos < 4)
+                    break;
+                auto b = reinterpret_cast<const unsigned char *>(rbuf_.data() + pos);
+                fs = (static_cast<std::size_t>(b[0]) << 24) |
+                     (static_cast<std::size_t>(b[1]) << 16) |
+                     (static_cast<std::size_t>(b[2]) << 8) |
+                     static_cast<std::size_t>(b[3]);
+                hs = 4;
+                // frame too big (do not wait for it)
+                if (fs > MAX_FRAME_SIZE) {
+                    too_big = true;
+                    break;
+                }
+                if (rbuf_.size() - pos - hs < fs)
+                    break;
+                f(rbuf_.substr(pos + hs, fs));
+                pos += hs + fs;
+            }
+        }
+        rbuf_.erase(0, pos);
+        if (scan_ > 0)
+            scan_ -= pos;
+
+        return !(too_big || rbuf_.size() > MAX_FRAME_SIZE + 4);
+    }
+
+    // reply frame in connection encoding
+    std::string frame(std::string &&s) const {
+        // newline terminated
+        if (enc_ == json_rpc::ENC_JSON) {
+            s.push_back('\n');
+            return std::move(s);
+        }
+        // length prefix
+        std::string f;
+        f.reserve(s.size() + 4);
+        for (int i = 3; i >= 0; i--)
+            f.push_back(static_cast<char>((s.size() >> (i * 8)) & 0xff));
+        f.append(s);
+        return f;
+    }
+
+    json_rpc::Encoding encoding() const { return enc_; }
+
+    // buffered partial frame size
+    std::size_t pending() const { return rbuf_.size(); }
+
+    static constexpr std::size_t MAX_FRAME_SIZE = 16 * 1024 * 1024;
+
+private:
+    // find end of JSON object starting at pos (string
+    // aware brace matching); npos if incomplete, scan is
+    // resumed on next read
+    std::size_t json_obj_end(std::size_t pos) {
+        std::size_t i = (scan_ > pos ? scan_ : pos);
+        for (; i < rbuf_.size(); i++) {
+            char c = rbuf_[i];
+            if (scan_esc_) {
+                scan_esc_ = false;
+            } else if (scan_str_) {
+                if (c == '\\')
+                    scan_esc_ = true;
+                else if (c == '"')
+                    scan_str_ = false;
+            } else if (c == '"') {
+                scan_str_ = true;
+            } else if (c == '{' || c == '[') {
+                ++scan_depth_;
+            } else if (c == '}' || c == ']') {
+                if (--scan_depth_ == 0) {
+                    scan_ = 0;
+                    return i + 1;
+                }
+            }
+        }
+        scan_ = i;
+        return std::string::npos;
+    }
+
+    // unprocessed input (partial frames)
+    std::string rbuf_;
+
+    // partial JSON object scan state
+    std::size_t scan_ = 0;
+    int scan_depth_ = 0;
+    bool scan_str_ = false;
+    bool scan_esc_ = false;
+
+    // connection encoding (set before first frame)
+    json_rpc::Encoding enc_ = json_rpc::ENC_JSON;
+    bool enc_set_ = false;
+};
+
+#endif /* ifndef SYSAGENTD_UNIX_FRAMER_H */
@@ -0,0 +1,346 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "subscription.h"
+#include "sysagent.h"
+#include <mink_err_codes.h>
+
+SubscriptionManager::~SubscriptionManager(){
+    stop();
+}
+
+void SubscriptionManager::start(){
+    std::unique_lock<std::mutex> l(mtx);
+    if (active)
+        return;
+    active = true;
+    th = std::thread(&SubscriptionManager::run, this);
+}
+
+void SubscriptionManager::stop(){
+    std::unique_lock<std::mutex> l(mtx);
+    if (!active)
+        return;
+    active = false;
+    l.unlock();
+    cv.notify_one();
+    th.join();
+}
+
+int SubscriptionManager::add(gdt::ServiceMessage *smsg,
+                             const mink_utils::Guid &guid,
+                             int cmd_id,
+                             const std::string &src_type,
+                             const std::string &src_id,
+                             uint32_t interval){
+    auto s = std::make_shared<Subscription>();
+    s->guid = guid;
+    s->cmd_id = cmd_id;
+    s->src_type = src_type;
+    s->src_id = src_id;
+    s->interval = (interval < MIN_INTERVAL ? MIN_INTERVAL : interval);
+
+    // copy plugin input (streamed params are owned
+    // by smsg and not supported)
+    auto it = smsg->vpmap.get_begin();
+    for (; it != smsg->vpmap.get_end(); ++it) {
+        if (it->second.get_type() == mink_utils::DPT_POINTER)
+            continue;
+        s->input.set(&it->second,
+                     it->first.key,
+                     it->first.index,
+                     it->first.fragment,
+                     it->first.context);
+    }
+    // not needed by plugins
+    s->input.erase_param(asn1::ParameterType::_pt_mink_sub_interval);
+
+    std::unique_lock<std::mutex> l(mtx);
+    if (subs.size() >= MAX_SUBS)
+        return 1;
+    // re-subscribe with the same guid replaces
+    // the old subscription
+    subs[guid] = s;
+    // first sample is sent immediately
+    heap.emplace(clock_t::now(), guid);
+    l.unlock();
+    cv.notify_one();
+
+    mink::CURRENT_DAEMON->log(mink::LLT_DEBUG,
+                              "New subscription: cmd = [%d], interval = [%u msec], "
+                              "subscriber = [%s:%s]",
+                              cmd_id,
+                              s->interval,
+                              src_type.c_str(),
+                              src_id.c_str());
+    return 0;
+}
+
+bool SubscriptionManager::remove(const mink_utils::Guid &guid,
+                                 const std::string &src_type,
+                                 const std::string &src_id){
+    std::unique_lock<std::mutex> l(mtx);
+    auto it = subs.find(guid);
+    if (it == subs.end())
+        return false;
+    // only subscriber can cancel
+    if (it->second->src_type != src_type || it->second->src_id != src_id)
+        return false;
+    // heap entry is skipped when it expires
+    subs.erase(it);
+    return true;
+}
+
+int SubscriptionManager::cancel(const mink_utils::Guid &guid,
+                                const std::string &src_type,
+                                const std::string &src_id,
+                                int ec){
+    auto dd = static_cast<SysagentdDescriptor *>(mink::CURRENT_DAEMON);
+    gdt::ServiceMsgManager *smsgm = dd->gdtsmm;
+
+    // set client if needed
+    if (!dd->rtrd_gdtc || !dd->rtrd_gdtc->is_registered())
+        dd->rtrd_gdtc = dd->gdts->get_registered_client("routingd");
+    gdt::GDTClient *gdtc = dd->rtrd_gdtc;
+    if (!gdtc) return 1;
+
+    // allocate new service message
+    gdt::ServiceMessage *smsg = smsgm->new_smsg();
+    if (!smsg) return 1;
+
+    // final push; subscriber ends the stream
+    // (grpcd) or drops the subscription (jrpcd)
+    smsg->set_service_id(asn1::ServiceId::_sid_sysagent);
+    smsg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, guid.data(), 16);
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_persistent_correlation,
+                         std::to_string(1).c_str());
+    smsg->vpmap.set_int(asn1::ParameterType::_pt_mink_sub_cancel, 1);
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_error,
+                         std::to_string(ec).c_str());
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type, dd->get_daemon_type());
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id, dd->get_daemon_id());
+
+    // sync vpmap
+    if (smsgm->vpmap_sparam_sync(smsg, nullptr) != 0) {
+        smsgm->free_smsg(smsg);
+        return 1;
+    }
+
+    // push
+    if (smsgm->send_pipelined(smsg,
+                              gdtc,
+                              src_type.c_str(),
+                              src_id.c_str(),
+                              &srvc_msg_sent)) {
+        smsgm->free_smsg(smsg);
+        return 1;
+    }
+    return 0;
+}
+
+std::size_t SubscriptionManager::size(){
+    std::unique_lock<std::mutex> l(mtx);
+    return subs.size();
+}
+
+void SubscriptionManager::run(){
+    std::unique_lock<std::mutex> l(mtx);
+    while (active) {
+        // nothing scheduled
+        if (heap.empty()) {
+            cv.wait(l);
+            continue;
+        }
+        // wait for earliest deadline (or new earlier entry)
+        auto dl = heap.top().first;
+        if (clock_t::now() < dl) {
+            cv.wait_until(l, dl);
+            continue;
+        }
+        mink_utils::Guid g = heap.top().second;
+        heap.pop();
+        // cancelled
+        auto it = subs.find(g);
+        if (it == subs.end())
+            continue;
+        // keep alive while sampling (can be
+        // cancelled in the meantime)
+        std::shared_ptr<Subscription> s = it->second;
+        l.unlock();
+        int r = sample(*s);
+        l.lock();
+        // still active (and not replaced)
+        it = subs.find(g);
+        if (it == subs.end() || it->second != s)
+            continue;
+        // too many errors or plugin error
+        if (r < 0) {
+            subs.erase(it);
+            mink::CURRENT_DAEMON->log(mink::LLT_WARNING,
+                                      "Subscription removed: cmd = [%d], "
+                                      "subscriber = [%s:%s]",
+                                      s->cmd_id,
+                                      s->src_type.c_str(),
+                                      s->src_id.c_str());
+            // subscriber would wait for pushes forever
+            l.unlock();
+            cancel(g, s->src_type, s->src_id, mink::error::EC_UNKNOWN);
+            l.lock();
+            continue;
+        }
+        // schedule next sample (fixed rate, skip
+        // missed samples if plugin was too slow)
+        auto next = dl + std::chrono::milliseconds(s->interval);
+        auto now = clock_t::now();
+        if (next < now)
+            next = now + std::chrono::milliseconds(s->interval);
+        heap.emplace(next, g);
+    }
+}
+
+// Returns 0 if sample was pushed or skipped (no changes,
+// congestion) and -1 if subscription should be removed
+int SubscriptionManager::sample(Subscription &s){
+    auto dd = static_cast<SysagentdDescriptor *>(mink::CURRENT_DAEMON);
+    gdt::ServiceMsgManager *smsgm = dd->gdtsmm;
+
+    // set client if needed
+    if (!dd->rtrd_gdtc || !dd->rtrd_gdtc->is_registered())
+        dd->rtrd_gdtc = dd->gdts->get_registered_client("routingd");
+    gdt::GDTClient *gdtc = dd->rtrd_gdtc;
+    // not connected, try again on next interval
+    if (!gdtc) return 0;
+
+    // backpressure, skip this sample
+    if (smsgm->wait_capacity(gdtc, 100) != 0)
+        return 0;
+
+    // allocate new service message
+    gdt::ServiceMessage *smsg = smsgm->new_smsg();
+    if (!smsg) return 0;
+
+    // service id
+    smsg->set_service_id(asn1::ServiceId::_sid_sysagent);
+
+    // plugin input
+    auto it = s.input.get_begin();
+    for (; it != s.input.get_end(); ++it) {
+        smsg->vpmap.set(&it->second,
+                        it->first.key,
+                        it->first.index,
+                        it->first.fragment,
+                        it->first.context);
+    }
+
+    // run plugin
+    if (dd->plg_mngr.run(s.cmd_id, mink_utils::PluginInputData(mink_utils::PLG_DT_GDT, smsg))) {
+        smsgm->free_smsg(smsg);
+        return -1;
+    }
+
+    // extra params (large data, always pushed)
+    using spmap_t = std::vector<gdt::ServiceParam *>;
+    gdt::GDTCallbackMethod *ev_usr_cb = nullptr;
+    spmap_t *pmap = nullptr;
+    const mink_utils::VariantParam *vp_cb = smsg->vpmap.get_param(0);
+    const mink_utils::VariantParam *vp_pmap = smsg->vpmap.get_param(1);
+    if (vp_cb) ev_usr_cb = static_cast<gdt::GDTCallbackMethod *>((void *)*vp_cb);
+    if (vp_pmap) pmap = static_cast<spmap_t *>((void *)*vp_pmap);
+
+    // credentials are not pushed back
+    smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_id);
+    smsg->vpmap.erase_param(asn1::ParameterType::_pt_mink_auth_password);
+
+    // full snapshot if nothing was pushed yet, if some
+    // of the previously pushed params disappeared (delta
+    // cannot signal removal) and periodically
+    bool full = (s.last.size() == 0 || ++s.samples >= FULL_SAMPLES);
+    auto lit = s.last.get_begin();
+    for (; !full && lit != s.last.get_end(); ++lit) {
+        if (!smsg->vpmap.get_param(lit->first.key,
+                                   lit->first.index,
+                                   lit->first.fragment,
+                                   lit->first.context))
+            full = true;
+    }
+    if (full) {
+        s.last.clear_params();
+        s.samples = 0;
+    }
+
+    // delta; remove params that did not change
+    // since last push
+    std::vector<mink_utils::ParamTuple<uint32_t>> unchanged;
+    auto pit = smsg->vpmap.get_begin();
+    for (; pit != smsg->vpmap.get_end(); ++pit) {
+        if (pit->second.get_type() == mink_utils::DPT_POINTER)
+            continue;
+        const mink_utils::VariantParam *vp = s.last.get_param(pit->first.key,
+                                                              pit->first.index,
+                                                              pit->first.fragment,
+                                                              pit->first.context);
+        if (vp && *vp == pit->second) {
+            unchanged.push_back(pit->first);
+            continue;
+        }
+        s.last.set(&pit->second,
+                   pit->first.key,
+                   pit->first.index,
+                   pit->first.fragment,
+                   pit->first.context);
+    }
+    for (auto &pt : unchanged)
+        smsg->vpmap.erase_param(pt.key, pt.index, pt.fragment, pt.context);
+
+    // subscriber replaces its state with snapshot
+    // contents (params not present were removed)
+    if (full)
+        smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_sub_snapshot,
+                             std::to_string(1).c_str());
+
+    // nothing to push
+    if (!ev_usr_cb && smsg->vpmap.size() == 0) {
+        smsgm->free_smsg(smsg);
+        return 0;
+    }
+
+    // correlation (persistent, more replies follow)
+    smsg->vpmap.set_octets(asn1::ParameterType::_pt_mink_guid, s.guid.data(), 16);
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_persistent_correlation,
+                         std::to_string(1).c_str());
+    // set source daemon
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_type, dd->get_daemon_type());
+    smsg->vpmap.set_cstr(asn1::ParameterType::_pt_mink_daemon_id, dd->get_daemon_id());
+
+    // sync vpmap
+    if (smsgm->vpmap_sparam_sync(smsg, pmap) != 0) {
+        smsgm->free_smsg(smsg);
+        delete ev_usr_cb;
+        s.last.clear_params();
+        return (++s.errors >= MAX_ERRORS ? -1 : 0);
+    }
+    // set extra params
+    smsg->params.set_param(3, ev_usr_cb);
+
+    // push
+    if (smsgm->send_pipelined(smsg,
+                              gdtc,
+                              s.src_type.c_str(),
+                              s.src_id.c_str(),
+                              &srvc_msg_sent)) {
+        smsgm->free_smsg(smsg);
+        delete ev_usr_cb;
+        // resend everything on next sample
+        s.last.clear_params();
+        return (++s.errors >= MAX_ERRORS ? -1 : 0);
+    }
+    s.errors = 0;
+    return 0;
+}
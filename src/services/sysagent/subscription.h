@@ -0,0 +1,112 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef SYSAGENTD_SUBSCRIPTION_H
+#define SYSAGENTD_SUBSCRIPTION_H
+
+#include <gdt_utils.h>
+#include <mink_utils.h>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <condition_variable>
+#include <unordered_map>
+#include <chrono>
+#include "events.h"
+
+// Periodic command subscription; command is sampled
+// on every interval and only changed params are pushed
+// back to subscriber (persistent correlation); full
+// snapshot is pushed when params disappear and on
+// every FULL_SAMPLES samples
+struct Subscription {
+    // subscriber correlation
+    mink_utils::Guid guid;
+    std::string src_type;
+    std::string src_id;
+    // command to sample
+    int cmd_id = 0;
+    // sampling interval (msec)
+    uint32_t interval = 0;
+    // request params (plugin input)
+    mink_utils::VariantParamMap<uint32_t> input;
+    // last pushed values (delta reference)
+    mink_utils::VariantParamMap<uint32_t> last;
+    // consecutive push errors
+    int errors = 0;
+    // samples since last full snapshot
+    int samples = 0;
+};
+
+// Subscription manager; one timer thread, next sample
+// deadlines are kept in a min-heap
+class SubscriptionManager {
+public:
+    SubscriptionManager() = default;
+    ~SubscriptionManager();
+    SubscriptionManager(const SubscriptionManager &o) = delete;
+    SubscriptionManager &operator=(const SubscriptionManager &o) = delete;
+
+    void start();
+    void stop();
+    int add(gdt::ServiceMessage *smsg,
+            const mink_utils::Guid &guid,
+            int cmd_id,
+            const std::string &src_type,
+            const std::string &src_id,
+            uint32_t interval);
+    bool remove(const mink_utils::Guid &guid,
+                const std::string &src_type,
+                const std::string &src_id);
+    // notify subscriber that subscription was
+    // dropped (final push, sub cancel and error)
+    int cancel(const mink_utils::Guid &guid,
+               const std::string &src_type,
+               const std::string &src_id,
+               int ec);
+    std::size_t size();
+
+    // limits
+    static constexpr uint32_t MIN_INTERVAL = 100;
+    static constexpr std::size_t MAX_SUBS = 1024;
+    static constexpr int MAX_ERRORS = 3;
+    static constexpr int FULL_SAMPLES = 60;
+
+private:
+    using clock_t = std::chrono::steady_clock;
+    using entry_t = std::pair<clock_t::time_point, mink_utils::Guid>;
+    struct EntryCmp {
+        bool operator()(const entry_t &a, const entry_t &b) const {
+            return a.first > b.first;
+        }
+    };
+    struct GuidHash {
+        std::size_t operator()(const mink_utils::Guid &g) const {
+            return mink_utils::hash_fnv1a_64bit(g.data(), 16);
+        }
+    };
+
+    void run();
+    int sample(Subscription &s);
+
+    std::unordered_map<mink_utils::Guid,
+                       std::shared_ptr<Subscription>,
+                       GuidHash> subs;
+    std::priority_queue<entry_t, std::vector<entry_t>, EntryCmp> heap;
+    // sent handler (frees smsg)
+    EVSrvcMsgSent srvc_msg_sent;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::thread th;
+    bool active = false;
+};
+
+#endif /* ifndef SYSAGENTD_SUBSCRIPTION_H */
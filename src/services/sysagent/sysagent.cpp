@@ -10,6 +10,9 @@
 
 #include <getopt.h>
 #include <regex>
+#include <cctype>
+#include <poll.h>
+#include <sys/inotify.h>
 #include "sysagent.h"
 
 // filter for scandir
@@ -38,6 +41,12 @@ SysagentdDescriptor::SysagentdDescriptor(const char *_type, const char *_desc)
     dparams.set_int(2, 1000);
     // --gdt-sparam-pool
     dparams.set_int(3, 5000);
+    // --exec-workers
+    dparams.set_int(5, 8);
+    // --exec-queue
+    dparams.set_int(6, 256);
+    // --plugins-watch
+    dparams.set_int(7, 0);
 }
 
 SysagentdDescriptor::~SysagentdDescriptor(){
@@ -65,6 +74,8 @@ void SysagentdDescriptor::print_help(){
     std::cout << "=============" << std::endl;
     std::cout << " --plugins-cfg      Plugins configuration file"
               << std::endl;
+    std::cout << " --plugins-watch    Load new and reload rebuilt plugins (inotify)"
+              << std::endl;
     std::cout << std::endl;
     std::cout << "GDT Options:" << std::endl;
     std::cout << "=============" << std::endl;
@@ -78,10 +89,25 @@ void SysagentdDescriptor::print_help(){
               << std::endl;
     std::cout << " --gdt-sparam-pool  GDT Service message parameter pool (default = 5000)"
               << std::endl;
+    std::cout << std::endl;
+    std::cout << "Command Executor Options:" << std::endl;
+    std::cout << "=========================" << std::endl;
+    std::cout << " --exec-workers     Number of command worker threads   (default = 8, min = 2)"
+              << std::endl;
+    std::cout << " --exec-queue       Max queued requests per command    (default = 256)"
+              << std::endl;
 
 }
 
 void SysagentdDescriptor::init() {
+    // command executor (requests are accepted
+    // as soon as GDT is connected)
+    if (plg_mngr.exec.start(dparams.get_pval<int>(5),
+                            dparams.get_pval<int>(6))) {
+        mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                  "Cannot start command executor, terminating...");
+        exit(EXIT_FAILURE);
+    }
     init_gdt();
 #ifdef MINK_ENABLE_CONFIGD
     if (init_cfg(true)) {
@@ -91,6 +117,11 @@ void SysagentdDescriptor::init() {
     }
 #endif
     init_plugins(plg_dir.c_str());
+    init_stats();
+    // plugin dir watcher
+    if (dparams.get_pval<int>(7) && !plg_dir.empty())
+        plg_watch_th = std::thread(&SysagentdDescriptor::watch_plugins, this);
+    subs.start();
 }
 
 void SysagentdDescriptor::process_args(int argc, char **argv){
@@ -103,6 +134,9 @@ void SysagentdDescriptor::process_args(int argc, char **argv){
                                     {"gdt-smsg-pool", required_argument, 0, 0},
                                     {"gdt-sparam-pool", required_argument, 0, 0},
                                     {"plugins-cfg", required_argument, 0, 0},
+                                    {"exec-workers", required_argument, 0, 0},
+                                    {"exec-queue", required_argument, 0, 0},
+                                    {"plugins-watch", no_argument, 0, 0},
                                     {0, 0, 0, 0}};
 
     if (argc < 5) {
@@ -165,6 +199,33 @@ void SysagentdDescriptor::process_args(int argc, char **argv){
                 break;
             }
 
+            // exec-workers
+            case 5:
+                // at least one worker has to be left
+                // for other commands (starvation guard)
+                if (atoi(optarg) < 2) {
+                    std::cout << "ERROR: Minimum number of command workers is 2!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(5, atoi(optarg));
+                break;
+
+            // exec-queue
+            case 6:
+                if (atoi(optarg) < 1) {
+                    std::cout << "ERROR: Invalid command queue size!"
+                              << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                dparams.set_int(6, atoi(optarg));
+                break;
+
+            // plugins-watch
+            case 7:
+                dparams.set_int(7, 1);
+                break;
+
             default:
                 break;
             }
@@ -432,6 +493,86 @@ void SysagentdDescriptor::init_plugins(const char *pdir){
 
 }
 
+// check for ".so" file name suffix
+static bool has_so_suffix(const char *fname){
+    size_t l = strlen(fname);
+    return (l > 3 && strcmp(&fname[l - 3], ".so") == 0);
+}
+
+void SysagentdDescriptor::watch_plugins(){
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                  "Cannot watch plugin directory (inotify)");
+        return;
+    }
+    // rebuilt (close/rename) or removed plugins
+    if (inotify_add_watch(fd,
+                          plg_dir.c_str(),
+                          IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM) < 0) {
+        mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                  "Cannot watch plugin directory [%s]",
+                                  plg_dir.c_str());
+        close(fd);
+        return;
+    }
+
+    alignas(inotify_event) char buff[4096];
+    while (!mink::DaemonDescriptor::DAEMON_TERMINATED) {
+        pollfd pfd{fd, POLLIN, 0};
+        if (poll(&pfd, 1, 1000) <= 0)
+            continue;
+        ssize_t n = read(fd, buff, sizeof(buff));
+        if (n <= 0)
+            continue;
+        // process events
+        for (char *p = buff; p < buff + n;) {
+            auto ev = reinterpret_cast<inotify_event *>(p);
+            p += sizeof(inotify_event) + ev->len;
+            // only .so files (editor/linker temp files
+            // like plg.so.tmp are skipped)
+            if (ev->len == 0 || !has_so_suffix(ev->name))
+                continue;
+            std::string fp = plg_dir + "/" + ev->name;
+            // removed
+            if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                if (plg_mngr.unload(fp) == 0)
+                    mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                                              "Plugin [%s] unloaded",
+                                              ev->name);
+                continue;
+            }
+            // new or rebuilt
+            bool loaded = plg_mngr.is_loaded(fp);
+            int r = plg_mngr.reload(fp);
+            if (r == 0) {
+                mink::CURRENT_DAEMON->log(mink::LLT_INFO,
+                                          "Plugin [%s] %s",
+                                          ev->name,
+                                          (loaded ? "reloaded" : "loaded"));
+                // stats for new commands and signals
+                add_exec_traps();
+                add_signal_traps();
+            } else if (r == 5) {
+                mink::CURRENT_DAEMON->log(mink::LLT_WARNING,
+                                          "Plugin [%s] cannot be replaced while "
+                                          "mapped, restart required",
+                                          ev->name);
+            } else if (r == 2) {
+                mink::CURRENT_DAEMON->log(mink::LLT_WARNING,
+                                          "Plugin [%s] cannot be unloaded, "
+                                          "restart required",
+                                          ev->name);
+            } else {
+                mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                          "Cannot load plugin [%s]",
+                                          ev->name);
+            }
+        }
+    }
+    close(fd);
+}
+
 static void rtrds_connect(SysagentdDescriptor *d){
     // connect to routing daemons
     std::smatch regex_groups;
@@ -509,10 +650,182 @@ void SysagentdDescriptor::init_gdt(){
     }
 }
 
+// executor traps (suffix, field)
+static const std::pair<const char *, ExecStatsHandler::Field> EXEC_TRAPS[] = {
+    {"_DEPTH", ExecStatsHandler::ES_DEPTH},
+    {"_ACTIVE", ExecStatsHandler::ES_ACTIVE},
+    {"_DONE", ExecStatsHandler::ES_DONE},
+    {"_REJECTED", ExecStatsHandler::ES_REJECTED},
+    {"_LAT_AVG", ExecStatsHandler::ES_LAT_AVG},
+    {"_LAT_MAX", ExecStatsHandler::ES_LAT_MAX}
+};
+
+ExecStatsHandler::ExecStatsHandler(mink_utils::CmdExecutor *_exec,
+                                   int _cmd_id,
+                                   Field _f) : exec(_exec),
+                                               cmd_id(_cmd_id),
+                                               f(_f) {}
+
+void ExecStatsHandler::run(){
+    std::vector<mink_utils::CmdExecStats> st;
+    exec->stats(st);
+    uint64_t lat_sum = 0;
+    value = 0;
+    for (auto &cs : st) {
+        if (cmd_id >= 0 && cs.cmd_id != cmd_id)
+            continue;
+        switch (f) {
+            case ES_DEPTH:
+                value += cs.depth;
+                break;
+            case ES_ACTIVE:
+                value += cs.active;
+                break;
+            case ES_DONE:
+                value += cs.done;
+                break;
+            case ES_REJECTED:
+                value += cs.rejected;
+                break;
+            case ES_LAT_AVG:
+                lat_sum += cs.lat_avg * cs.done;
+                value += cs.done;
+                break;
+            case ES_LAT_MAX:
+                if (cs.lat_max > value)
+                    value = cs.lat_max;
+                break;
+        }
+    }
+    // weighted by number of completed tasks
+    if (f == ES_LAT_AVG)
+        value = (value > 0 ? lat_sum / value : 0);
+}
+
+void SysagentdDescriptor::init_stats(){
+    // gdt stats
+    gdt_stats = new gdt::GDTStatsSession(5, gdts);
+    // start stats
+    gdt_stats->start();
+
+    // command executor totals
+    for (auto &t : EXEC_TRAPS)
+        gdt_stats->add_trap(gdt::TrapId(std::string("EXEC") + t.first),
+                            new ExecStatsHandler(&plg_mngr.exec, -1, t.second));
+    // per command
+    add_exec_traps();
+    // plugin signals
+    add_signal_traps();
+
+    // connect stats with routing daemons
+    std::smatch regex_groups;
+    std::regex addr_regex("(\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}):(\\d+)");
+    for (size_t i = 0; i < rtrd_lst.size(); i++) {
+        if (!std::regex_match(rtrd_lst[i], regex_groups, addr_regex))
+            continue;
+        gdt::GDTClient *gdtc =
+            gdt_stats->get_gdt_session()->connect(regex_groups[1].str().c_str(),
+                                                  atoi(regex_groups[2].str().c_str()),
+                                                  16,
+                                                  (local_ip.empty() ? nullptr : local_ip.c_str()),
+                                                  0);
+        if (gdtc != nullptr)
+            gdt_stats->setup_client(gdtc);
+    }
+}
+
+void SysagentdDescriptor::add_exec_traps(){
+    if (!gdt_stats)
+        return;
+    // EXEC_CMD_<id>_<field>, existing traps are skipped
+    std::vector<int> cmds;
+    plg_mngr.commands(cmds);
+    for (auto cmd_id : cmds) {
+        std::string tmp("EXEC_CMD_");
+        tmp.append(std::to_string(cmd_id));
+        for (auto &t : EXEC_TRAPS) {
+            auto h = new ExecStatsHandler(&plg_mngr.exec, cmd_id, t.second);
+            if (gdt_stats->add_trap(gdt::TrapId(tmp + t.first), h))
+                delete h;
+        }
+    }
+}
+
+// signal traps (suffix, field)
+static const std::pair<const char *, SignalStatsHandler::Field> SIG_TRAPS[] = {
+    {"_SUBS", SignalStatsHandler::SS_SUBS},
+    {"_EMITTED", SignalStatsHandler::SS_EMITTED},
+    {"_DELIVERED", SignalStatsHandler::SS_DELIVERED},
+    {"_DROPPED", SignalStatsHandler::SS_DROPPED},
+    {"_COALESCED", SignalStatsHandler::SS_COALESCED}
+};
+
+SignalStatsHandler::SignalStatsHandler(mink_utils::PluginManager *_pm,
+                                       const std::string &_name,
+                                       Field _f) : pm(_pm),
+                                                   name(_name),
+                                                   f(_f) {}
+
+void SignalStatsHandler::run(){
+    std::vector<mink_utils::SignalStats> st;
+    pm->signal_stats(st);
+    value = 0;
+    for (auto &ss : st) {
+        if (ss.name != name)
+            continue;
+        switch (f) {
+            case SS_SUBS:
+                value = ss.subs;
+                break;
+            case SS_EMITTED:
+                value = ss.emitted;
+                break;
+            case SS_DELIVERED:
+                value = ss.delivered;
+                break;
+            case SS_DROPPED:
+                value = ss.dropped;
+                break;
+            case SS_COALESCED:
+                value = ss.coalesced;
+                break;
+        }
+        break;
+    }
+}
+
+void SysagentdDescriptor::add_signal_traps(){
+    if (!gdt_stats)
+        return;
+    // SIG_<name>_<field> (name in upper case, ':'
+    // replaced), existing traps are skipped
+    std::vector<mink_utils::SignalStats> st;
+    plg_mngr.signal_stats(st);
+    for (auto &ss : st) {
+        std::string tmp("SIG_");
+        for (char c : ss.name)
+            tmp.push_back(std::isalnum((unsigned char)c) ? std::toupper((unsigned char)c) : '_');
+        for (auto &t : SIG_TRAPS) {
+            auto h = new SignalStatsHandler(&plg_mngr, ss.name, t.second);
+            if (gdt_stats->add_trap(gdt::TrapId(tmp + t.first), h))
+                delete h;
+        }
+    }
+}
+
 void SysagentdDescriptor::terminate(){
+    // plugin dir watcher (exits on DAEMON_TERMINATED)
+    if (plg_watch_th.joinable())
+        plg_watch_th.join();
+    subs.stop();
+    plg_mngr.exec.stop();
+    // stop stats
+    if (gdt_stats)
+        gdt_stats->stop();
     gdt::destroy_session(gdts);
 #ifdef MINK_ENABLE_CONFIGD
     delete config;
 #endif
-
+    // gdt stats
+    delete gdt_stats;
 }
@@ -15,6 +15,7 @@
 #include <atomic.h>
 #include <mink_config.h>
 #include <vector>
+#include <thread>
 #ifdef MINK_ENABLE_CONFIGD
 #include <config_gdt.h>
 #include "events.h"
@@ -29,6 +30,7 @@
 #include <sstream>
 #include <nlohmann/json.hpp>
 #include "events.h"
+#include "subscription.h"
 
 // daemon name and description
 constexpr const char *DAEMON_TYPE = "sysagentd";
@@ -47,6 +49,48 @@ struct PluginsConfig {
     json cfg;
 };
 
+// command executor stats trap (cmd_id < 0 for
+// totals of all commands)
+class ExecStatsHandler : public gdt::GDTTrapHandler {
+public:
+    enum Field {
+        ES_DEPTH,
+        ES_ACTIVE,
+        ES_DONE,
+        ES_REJECTED,
+        ES_LAT_AVG,
+        ES_LAT_MAX
+    };
+    ExecStatsHandler(mink_utils::CmdExecutor *_exec, int _cmd_id, Field _f);
+    void run() override;
+
+private:
+    mink_utils::CmdExecutor *exec;
+    int cmd_id;
+    Field f;
+};
+
+// plugin signal stats trap
+class SignalStatsHandler : public gdt::GDTTrapHandler {
+public:
+    enum Field {
+        SS_SUBS,
+        SS_EMITTED,
+        SS_DELIVERED,
+        SS_DROPPED,
+        SS_COALESCED
+    };
+    SignalStatsHandler(mink_utils::PluginManager *_pm,
+                       const std::string &_name,
+                       Field _f);
+    void run() override;
+
+private:
+    mink_utils::PluginManager *pm;
+    std::string name;
+    Field f;
+};
+
 // daemon descriptor definition
 class SysagentdDescriptor : public mink::DaemonDescriptor {
 public:
@@ -58,7 +102,11 @@ public:
     void process_args(int argc, char **argv) override;
     void print_help() override;
     void init_gdt();
+    void init_stats();
+    void add_exec_traps();
+    void add_signal_traps();
     void init_plugins(const char *pdir);
+    void watch_plugins();
     void init();
     void terminate() override;
     // configd
@@ -103,8 +151,12 @@ public:
     pmap_t dparams;
     // plugin manager
     mink_utils::PluginManager plg_mngr;
+    // plugin dir watcher
+    std::thread plg_watch_th;
     // db manager
     mink_db::SqliteManager dbm;
+    // periodic command subscriptions
+    SubscriptionManager subs;
 };
 
 
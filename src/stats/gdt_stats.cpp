@@ -360,6 +360,34 @@ gdt::GDTStatsHandler::GDTStatsHandler(mink::Atomic<uint64_t> *_sval_p)
 
 void gdt::GDTStatsHandler::run() { value = sval_p->get(); }
 
+// GDTLatencyHandler
+gdt::GDTLatencyHandler::GDTLatencyHandler(GDTLatencyHistogram *_hist,
+                                          unsigned int _permille)
+    : hist(_hist), permille(_permille) {}
+
+void gdt::GDTLatencyHandler::run() {
+    value = (permille > 0 ? hist->percentile(permille) : hist->get_max());
+}
+
+// latency traps (percentile suffix, permille)
+static const std::pair<const char *, unsigned int> LAT_TRAPS[] = {
+    {"_P50", 500}, {"_P90", 900}, {"_P99", 990}, {"_P999", 999}, {"_MAX", 0}
+};
+
+static void add_lat_traps(gdt::GDTStatsSession *gdt_stats,
+                          const std::string &prefix,
+                          gdt::GDTLatencyHistogram *hist) {
+    for (auto &t : LAT_TRAPS)
+        gdt_stats->add_trap(gdt::TrapId(prefix + t.first),
+                            new gdt::GDTLatencyHandler(hist, t.second));
+}
+
+static void remove_lat_traps(gdt::GDTStatsSession *gdt_stats,
+                             const std::string &prefix) {
+    for (auto &t : LAT_TRAPS)
+        delete gdt_stats->remove_trap(gdt::TrapId(prefix + t.first));
+}
+
 // GDTStatsClientCreated
 void gdt::GDTStatsClientCreated::run(GDTCallbackArgs *args) {
     auto gdtc = (GDTClient *)args->get_arg(GDT_CB_INPUT_ARGS, 
@@ -393,6 +421,12 @@ void gdt::GDTStatsClientCreated::run(GDTCallbackArgs *args) {
                         new GDTStatsHandler(&gdtc->get_stats(GDT_INBOUND_STATS)->strm_timeout));
     gdt_stats->add_trap(gdt::TrapId(std::string(tmp + "_STREAM_LOOPBACK")),
                         new GDTStatsHandler(&gdtc->get_stats(GDT_INBOUND_STATS)->strm_loopback));
+    add_lat_traps(gdt_stats, tmp + "_LAT_STREAM",
+                  &gdtc->get_stats(GDT_INBOUND_STATS)->lat_stream);
+    add_lat_traps(gdt_stats, tmp + "_LAT_PROCESS",
+                  &gdtc->get_stats(GDT_INBOUND_STATS)->lat_process);
+    add_lat_traps(gdt_stats, tmp + "_LAT_TRACE",
+                  &gdtc->get_stats(GDT_INBOUND_STATS)->lat_trace);
 
     // out stats
     tmp.assign("GDT_OUT_");
@@ -421,6 +455,16 @@ void gdt::GDTStatsClientCreated::run(GDTCallbackArgs *args) {
                         new GDTStatsHandler(&gdtc->get_stats(GDT_OUTBOUND_STATS)->strm_timeout));
     gdt_stats->add_trap(gdt::TrapId(std::string(tmp + "_STREAM_LOOPBACK")),
                         new GDTStatsHandler(&gdtc->get_stats(GDT_OUTBOUND_STATS)->strm_loopback));
+    gdt_stats->add_trap(gdt::TrapId(std::string(tmp + "_QUEUE_DEPTH")),
+                        new GDTStatsHandler(&gdtc->get_stats(GDT_OUTBOUND_STATS)->queue_depth));
+    gdt_stats->add_trap(gdt::TrapId(std::string(tmp + "_QUEUE_HWM")),
+                        new GDTStatsHandler(&gdtc->get_stats(GDT_OUTBOUND_STATS)->queue_hwm));
+    gdt_stats->add_trap(gdt::TrapId(std::string(tmp + "_QUEUE_CONGESTED")),
+                        new GDTStatsHandler(&gdtc->get_stats(GDT_OUTBOUND_STATS)->queue_congested));
+    add_lat_traps(gdt_stats, tmp + "_LAT_STREAM",
+                  &gdtc->get_stats(GDT_OUTBOUND_STATS)->lat_stream);
+    add_lat_traps(gdt_stats, tmp + "_LAT_QUEUE",
+                  &gdtc->get_stats(GDT_OUTBOUND_STATS)->lat_queue);
 }
 
 // GDTStatsClientDestroyed
@@ -445,6 +489,9 @@ void gdt::GDTStatsClientDestroyed::run(GDTCallbackArgs *args) {
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_POOL_ERR")));
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_STREAM_TIMEOUT")));
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_STREAM_LOOPBACK")));
+    remove_lat_traps(gdt_stats, tmp + "_LAT_STREAM");
+    remove_lat_traps(gdt_stats, tmp + "_LAT_PROCESS");
+    remove_lat_traps(gdt_stats, tmp + "_LAT_TRACE");
 
     // out stats
     tmp.assign("GDT_OUT_");
@@ -462,6 +509,11 @@ void gdt::GDTStatsClientDestroyed::run(GDTCallbackArgs *args) {
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_POOL_ERR")));
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_STREAM_TIMEOUT")));
     delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_STREAM_LOOPBACK")));
+    delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_QUEUE_DEPTH")));
+    delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_QUEUE_HWM")));
+    delete gdt_stats->remove_trap(gdt::TrapId(std::string(tmp + "_QUEUE_CONGESTED")));
+    remove_lat_traps(gdt_stats, tmp + "_LAT_STREAM");
+    remove_lat_traps(gdt_stats, tmp + "_LAT_QUEUE");
 }
 
 // GDTStatsSession
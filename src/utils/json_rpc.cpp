@@ -29,11 +29,234 @@ const char *json_rpc::JsonRpc::MINK_DTYPE_          = "MINK_DTYPE";
 const char *json_rpc::JsonRpc::MINK_DID_            = "MINK_DID";
 const char *json_rpc::JsonRpc::MINK_CREDENTIALS_    = "MINK_CREDENTIALS";
 const char *json_rpc::JsonRpc::MINK_TIMEOUT_        = "MINK_TIMEOUT";
+const char *json_rpc::JsonRpc::MINK_INTERVAL_       = "MINK_INTERVAL";
+const char *json_rpc::JsonRpc::MINK_UNSUBSCRIBE_    = "MINK_UNSUBSCRIBE";
+const char *json_rpc::JsonRpc::MINK_PIPELINED_      = "MINK_PIPELINED";
 
 json_rpc::JsonRpc::JsonRpc(const json &data) : data_(data){
 
 }
 
+/************/
+/* Encoding */
+/************/
+std::string json_rpc::encode(const json &j, const Encoding enc){
+    if (enc == ENC_CBOR) {
+        std::string out;
+        json::to_cbor(j, out);
+        return out;
+    }
+    return j.dump(-1, ' ', false, json::error_handler_t::replace);
+}
+
+json json_rpc::decode(const char *data, const std::size_t len, const Encoding enc){
+    if (enc == ENC_CBOR) {
+        auto d = reinterpret_cast<const uint8_t *>(data);
+        return json::from_cbor(d, d + len, true, false);
+    }
+    return json::parse(data, data + len, nullptr, false);
+}
+
+json_rpc::Encoding json_rpc::detect_encoding(const char *data, const std::size_t len){
+    if (len == 0)
+        return ENC_JSON;
+    // CBOR item or length prefixed CBOR frame
+    switch (data[0]) {
+        case '{':
+        case '[':
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+            return ENC_JSON;
+        default:
+            return ENC_CBOR;
+    }
+}
+
+/*****************/
+/* JsonRpcWriter */
+/*****************/
+json_rpc::JsonRpcWriter::JsonRpcWriter(std::string &out,
+                                       const Encoding enc) : out_(out),
+                                                             enc_(enc) {}
+
+void json_rpc::JsonRpcWriter::begin_result(const int id){
+    first_ = true;
+    // {"jsonrpc": "2.0", "id": id, "result": [ (indefinite length)
+    if (enc_ == ENC_CBOR) {
+        cbor_head(out_, 5, 3);
+        cbor_str(out_, "jsonrpc", 7);
+        cbor_str(out_, "2.0", 3);
+        cbor_str(out_, "id", 2);
+        cbor_int(out_, id);
+        cbor_str(out_, "result", 6);
+        out_.push_back(static_cast<char>(0x9f));
+        return;
+    }
+    // same layout as gen_response + result array
+    out_.append("{\"jsonrpc\":\"2.0\",\"id\":");
+    out_.append(std::to_string(id));
+    out_.append(",\"result\":[");
+    first_ = true;
+}
+
+void json_rpc::JsonRpcWriter::add_item(const std::string &name,
+                                       const char *val,
+                                       const std::size_t len,
+                                       const int idx){
+    // {"idx": idx, name: val}
+    if (enc_ == ENC_CBOR) {
+        cbor_head(out_, 5, 2);
+        cbor_str(out_, "idx", 3);
+        cbor_int(out_, idx);
+        cbor_str(out_, name.data(), name.size());
+        cbor_str(out_, val, len);
+        return;
+    }
+    if (!first_)
+        out_.push_back(',');
+    first_ = false;
+    out_.append("{\"idx\":");
+    out_.append(std::to_string(idx));
+    out_.push_back(',');
+    append_str(out_, name.data(), name.size());
+    out_.push_back(':');
+    append_str(out_, val, len);
+    out_.push_back('}');
+}
+
+void json_rpc::JsonRpcWriter::end_result(){
+    // break (end of indefinite array)
+    if (enc_ == ENC_CBOR) {
+        out_.push_back(static_cast<char>(0xff));
+        return;
+    }
+    out_.append("]}");
+}
+
+void json_rpc::JsonRpcWriter::cbor_head(std::string &out,
+                                        const uint8_t major,
+                                        const uint64_t arg){
+    const char mt = static_cast<char>(major << 5);
+    // argument in network byte order
+    auto be = [&out](uint64_t v, int n) {
+        for (int i = n - 1; i >= 0; i--)
+            out.push_back(static_cast<char>((v >> (i * 8)) & 0xff));
+    };
+    if (arg < 24) {
+        out.push_back(static_cast<char>(mt | arg));
+    } else if (arg <= 0xff) {
+        out.push_back(static_cast<char>(mt | 24));
+        be(arg, 1);
+    } else if (arg <= 0xffff) {
+        out.push_back(static_cast<char>(mt | 25));
+        be(arg, 2);
+    } else if (arg <= 0xffffffff) {
+        out.push_back(static_cast<char>(mt | 26));
+        be(arg, 4);
+    } else {
+        out.push_back(static_cast<char>(mt | 27));
+        be(arg, 8);
+    }
+}
+
+void json_rpc::JsonRpcWriter::cbor_int(std::string &out, const int64_t v){
+    if (v >= 0)
+        cbor_head(out, 0, static_cast<uint64_t>(v));
+    else
+        cbor_head(out, 1, static_cast<uint64_t>(-1 - v));
+}
+
+void json_rpc::JsonRpcWriter::cbor_str(std::string &out,
+                                       const char *s,
+                                       const std::size_t len){
+    auto c = reinterpret_cast<const unsigned char *>(s);
+    // validate, binary data is sent as is (major type 2)
+    bool txt = true;
+    for (std::size_t i = 0; i < len;) {
+        if (c[i] < 0x80) {
+            ++i;
+            continue;
+        }
+        std::size_t n = utf8_seq(c, i, len);
+        if (n == 0) {
+            txt = false;
+            break;
+        }
+        i += n;
+    }
+    cbor_head(out, (txt ? 3 : 2), len);
+    out.append(s, len);
+}
+
+std::size_t json_rpc::JsonRpcWriter::utf8_seq(const unsigned char *c,
+                                              const std::size_t i,
+                                              const std::size_t len){
+    unsigned char b = c[i];
+    // utf-8 sequence length
+    std::size_t n = 0;
+    if (b >= 0xc2 && b <= 0xdf) n = 2;
+    else if (b >= 0xe0 && b <= 0xef) n = 3;
+    else if (b >= 0xf0 && b <= 0xf4) n = 4;
+    // validate continuation bytes
+    bool ok = (n > 0 && i + n <= len);
+    for (std::size_t k = 1; ok && k < n; k++)
+        ok = ((c[i + k] & 0xc0) == 0x80);
+    // overlong, surrogates and > U+10FFFF
+    if (ok && n == 3) {
+        if ((b == 0xe0 && c[i + 1] < 0xa0) || (b == 0xed && c[i + 1] > 0x9f))
+            ok = false;
+    } else if (ok && n == 4) {
+        if ((b == 0xf0 && c[i + 1] < 0x90) || (b == 0xf4 && c[i + 1] > 0x8f))
+            ok = false;
+    }
+    return (ok ? n : 0);
+}
+
+void json_rpc::JsonRpcWriter::append_str(std::string &out,
+                                         const char *s,
+                                         const std::size_t len){
+    static const char *hex = "0123456789abcdef";
+    auto c = reinterpret_cast<const unsigned char *>(s);
+    out.push_back('"');
+    for (std::size_t i = 0; i < len;) {
+        unsigned char b = c[i];
+        // ascii
+        if (b < 0x80) {
+            switch (b) {
+                case '"':  out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\b': out.append("\\b"); break;
+                case '\f': out.append("\\f"); break;
+                case '\n': out.append("\\n"); break;
+                case '\r': out.append("\\r"); break;
+                case '\t': out.append("\\t"); break;
+                default:
+                    if (b < 0x20) {
+                        out.append("\\u00");
+                        out.push_back(hex[b >> 4]);
+                        out.push_back(hex[b & 0x0f]);
+                    } else
+                        out.push_back(static_cast<char>(b));
+            }
+            ++i;
+            continue;
+        }
+        // utf-8 sequence
+        std::size_t n = utf8_seq(c, i, len);
+        if (n > 0) {
+            out.append(s + i, n);
+            i += n;
+        } else {
+            // replacement character
+            out.append("\xef\xbf\xbd");
+            ++i;
+        }
+    }
+    out.push_back('"');
+}
+
 json json_rpc::JsonRpc::gen_err(const int code, const std::string &msg){
     json j;
     j[JSON_RPC_] = const_cast<char*>(VERSION_);
@@ -49,6 +272,7 @@ json json_rpc::JsonRpc::gen_err(const int code,
     j[JSON_RPC_] = const_cast<char*>(VERSION_);
     j[ERROR_][CODE_] = code;
     j[ERROR_][MESSAGE_] = msg;
+    j[ID_] = id;
     return j;
 }
 
@@ -183,6 +407,42 @@ int json_rpc::JsonRpc::get_mink_timeout() const {
     return it.value().get<json::number_unsigned_t>();
 }
 
+int json_rpc::JsonRpc::get_mink_interval() const {
+    if (!mink_verified_)
+        throw std::invalid_argument("MINK: unverified");
+
+    // subscription interval (msec), 0 = regular request
+    const auto &it = data_[PARAMS_].find(MINK_INTERVAL_);
+    if (it == data_[PARAMS_].cend())
+        return 0;
+
+    return it.value().get<json::number_unsigned_t>();
+}
+
+int json_rpc::JsonRpc::get_mink_unsubscribe() const {
+    if (!mink_verified_)
+        throw std::invalid_argument("MINK: unverified");
+
+    // id of subscription request, -1 if not found
+    const auto &it = data_[PARAMS_].find(MINK_UNSUBSCRIBE_);
+    if (it == data_[PARAMS_].cend())
+        return -1;
+
+    return it.value().get<json::number_integer_t>();
+}
+
+bool json_rpc::JsonRpc::get_mink_pipelined() const {
+    if (!mink_verified_)
+        throw std::invalid_argument("MINK: unverified");
+
+    // pipelined mode (no delivery errors), off by default
+    const auto &it = data_[PARAMS_].find(MINK_PIPELINED_);
+    if (it == data_[PARAMS_].cend())
+        return false;
+
+    return it.value().get<bool>();
+}
+
 const std::string &json_rpc::JsonRpc::get_auth_crdts() const {
     if (!mink_verified_)
         throw std::invalid_argument("MINK: unverified");
@@ -224,6 +484,18 @@ const std::string *json_rpc::JsonRpc::get_mink_did() const {
         return (*it).get_ptr<const json::string_t *const>();
 }
 
+const json *json_rpc::JsonRpc::get_mink_did_list() const {
+    if (!mink_verified_)
+        throw std::invalid_argument("MINK: unverified");
+
+    // fan-out (list of destination ids)
+    const auto &it = data_[PARAMS_].find(MINK_DID_);
+    if (it == data_[PARAMS_].end() || !(*it).is_array())
+        return nullptr;
+    else
+        return &(*it);
+}
+
 
 int json_rpc::JsonRpc::get_id() const {
     if (!verified_)
@@ -285,9 +557,34 @@ void json_rpc::JsonRpc::verify(bool check_mink){
             throw std::invalid_argument("MINK: destination type != string");
 
         // find destination id (optional)
+        // string or list of strings (fan-out)
         it = j_params.find(MINK_DID_);
-        if (it != j_params.end() && !(*it).is_string())
-            throw std::invalid_argument("MINK: destination id != string");
+        if (it != j_params.end()) {
+            if ((*it).is_array()) {
+                if ((*it).empty())
+                    throw std::invalid_argument("MINK: destination id list empty");
+                for (const auto &did : *it) {
+                    if (!did.is_string())
+                        throw std::invalid_argument("MINK: destination id != string");
+                }
+            } else if (!(*it).is_string())
+                throw std::invalid_argument("MINK: destination id != string | array");
+        }
+
+        // subscription interval (optional)
+        it = j_params.find(MINK_INTERVAL_);
+        if (it != j_params.end() && !(*it).is_number_unsigned())
+            throw std::invalid_argument("MINK: interval != unsigned integer");
+
+        // unsubscribe (optional)
+        it = j_params.find(MINK_UNSUBSCRIBE_);
+        if (it != j_params.end() && !(*it).is_number_integer())
+            throw std::invalid_argument("MINK: unsubscribe id != integer");
+
+        // pipelined mode (optional)
+        it = j_params.find(MINK_PIPELINED_);
+        if (it != j_params.end() && !(*it).is_boolean())
+            throw std::invalid_argument("MINK: pipelined != boolean");
 
         // mink verified
         has_mink_service_ = true;
@@ -11,22 +11,35 @@
 #include <dlfcn.h>
 #include <memory>
 #include <mink_plugin.h>
+#include <mink_utils.h>
 #include <algorithm>
+#include <cstring>
 
 std::string const mink_utils::PLG_INIT_FN("init");
 std::string const mink_utils::PLG_TERM_FN("terminate");
 std::string const mink_utils::PLG_CMD_HNDLR("run");
 std::string const mink_utils::PLG_CMD_HNDLR_LOCAL("run_local");
+std::string const mink_utils::PLG_CMD_HNDLR_ASYNC("run_async");
 std::string const mink_utils::PLG_CMD_LST("COMMANDS");
 
+std::string const mink_utils::PLG_UNLOADABLE("UNLOADABLE");
+
+constexpr std::chrono::seconds mink_utils::PluginManager::UNLOAD_TIMEOUT;
+
+// plugin being initialised on this thread (signal
+// handlers registered in init are owned by it)
+static thread_local std::shared_ptr<mink_utils::PluginDescriptor> loading_pd;
+
 mink_utils::PluginManager::~PluginManager(){
+    // no tasks running after this
+    exec.stop();
+    sig_exec.stop();
     // close plugins
-    std::all_of(plgs.cbegin(), plgs.cend(), [this](PluginDescriptor *pd) {
+    std::all_of(plgs.cbegin(), plgs.cend(), [this](const std::shared_ptr<PluginDescriptor> &pd) {
         // terminate
-        pd->termh(this, pd);
+        pd->termh(this, pd.get());
         // free mem
         dlclose(pd->handle);
-        delete pd;
         return true;
     });
 }
@@ -52,60 +65,230 @@ mink_utils::PluginDescriptor *mink_utils::PluginManager::load(const std::string
         reinterpret_cast<plg_cmd_hndlr_t>(dlsym(h, PLG_CMD_HNDLR.c_str()));
     plg_cmd_hndlr_t cmdh_l =
         reinterpret_cast<plg_cmd_hndlr_t>(dlsym(h, PLG_CMD_HNDLR_LOCAL.c_str()));
+    plg_cmd_hndlr_async_t cmdh_a =
+        reinterpret_cast<plg_cmd_hndlr_async_t>(dlsym(h, PLG_CMD_HNDLR_ASYNC.c_str()));
+    const int *unl =
+        reinterpret_cast<const int *>(dlsym(h, PLG_UNLOADABLE.c_str()));
 
     // first 4 must exist
     if (!(reg_hooks && init && term && cmdh)) {
         dlclose(h);
         return nullptr;
     }
+
+    // serialise load/unload
+    std::unique_lock<std::mutex> l(plg_mtx);
+    auto c_hooks = std::atomic_load(&hooks);
+
     // check if all requested hooks are free
     const int *tmp_rh = reg_hooks;
-    while (*tmp_rh != -1){
-        if(hooks.find(*tmp_rh++) != hooks.end()){
+    while (c_hooks && *tmp_rh != -1){
+        if(c_hooks->find(*tmp_rh++) != c_hooks->end()){
             dlclose(h);
             return nullptr;
         }
     }
     // create descriptor
-    auto pd = new mink_utils::PluginDescriptor();
+    auto pd = std::make_shared<mink_utils::PluginDescriptor>();
     // set data
     pd->handle = h;
     pd->name = std::string(fpath);
     pd->type = 0;
     pd->cmdh = cmdh;
     pd->cmdh_l = cmdh_l;
+    pd->cmdh_a = cmdh_a;
     pd->termh = term;
     pd->data = nullptr;
-
-    // attach hooks to plugin
+    pd->unloadable = (unl && *unl);
     tmp_rh = reg_hooks;
     while (*tmp_rh != -1)
-        hooks.insert(std::make_pair(*tmp_rh++, pd));
+        pd->cmds.push_back(*tmp_rh++);
 
     // run init method
-    if (!init(this, pd)) {
-        // add to list
-        plgs.push_back(pd);
+    loading_pd = pd;
+    int r = init(this, pd.get());
+    loading_pd.reset();
+    if (r) {
+        // hooks not attached
+        sig_remove(pd.get());
+        dlclose(h);
+        return nullptr;
     }
 
+    // attach hooks to plugin (new map is
+    // swapped in, readers keep old snapshot)
+    auto n_hooks = std::make_shared<hooks_t>();
+    if (c_hooks)
+        *n_hooks = *c_hooks;
+    for (int cmd : pd->cmds)
+        n_hooks->insert(std::make_pair(cmd, pd));
+    std::atomic_store(&hooks, std::shared_ptr<const hooks_t>(n_hooks));
+
+    // add to list
+    plgs.push_back(pd);
+
     // return descriptor
-    return pd;
+    return pd.get();
 }
 
 int mink_utils::PluginManager::unload(PluginDescriptor *pd){
-    // TODO
+    std::unique_lock<std::mutex> l(plg_mtx);
+    auto it = std::find_if(plgs.begin(),
+                           plgs.end(),
+                           [pd](const std::shared_ptr<PluginDescriptor> &p) {
+                               return p.get() == pd;
+                           });
+    if (it == plgs.end())
+        return 1;
+    // code cannot be unmapped
+    if (!(*it)->unloadable)
+        return 2;
+    std::shared_ptr<PluginDescriptor> sp = *it;
+    plgs.erase(it);
+
+    // detach hooks
+    auto n_hooks = std::make_shared<hooks_t>(*std::atomic_load(&hooks));
+    for (int cmd : sp->cmds) {
+        // command might be owned by other plugin
+        auto hit = n_hooks->find(cmd);
+        if (hit != n_hooks->end() && hit->second == sp)
+            n_hooks->erase(hit);
+    }
+    std::atomic_store(&hooks, std::shared_ptr<const hooks_t>(n_hooks));
+    // detach signal handlers (kept for re-attach,
+    // each one holds a plugin reference)
+    sig_subs_t subs;
+    sig_remove(pd, &subs);
+    // plugin is no longer reachable; do not block
+    // load/unload of other plugins while draining
+    l.unlock();
+
+    // wait for in-flight commands and signals (each
+    // one holds a plugin or signal handler reference)
+    auto busy = [&sp, &subs]() {
+        if (sp.use_count() > static_cast<long>(subs.size() + 1))
+            return true;
+        return std::any_of(subs.cbegin(),
+                           subs.cend(),
+                           [](const sig_subs_t::value_type &s) {
+                               return s.second.use_count() > 1;
+                           });
+    };
+    auto ts = std::chrono::steady_clock::now();
+    while (busy()) {
+        if (std::chrono::steady_clock::now() - ts > UNLOAD_TIMEOUT) {
+            // keep plugin mapped and re-attach it
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plugin [%s] busy, cannot unload",
+                                      sp->name.c_str());
+            l.lock();
+            auto r_hooks = std::make_shared<hooks_t>(*std::atomic_load(&hooks));
+            for (int cmd : sp->cmds) {
+                // claimed by other plugin while detached
+                if (!r_hooks->insert(std::make_pair(cmd, sp)).second) {
+                    mink::CURRENT_DAEMON->log(
+                        mink::LLT_ERROR,
+                        "plugin [%s] command [%d] taken by plugin [%s], "
+                        "not re-attached",
+                        sp->name.c_str(),
+                        cmd,
+                        r_hooks->at(cmd)->name.c_str());
+                }
+            }
+            std::atomic_store(&hooks, std::shared_ptr<const hooks_t>(r_hooks));
+            sig_restore(subs);
+            plgs.push_back(sp);
+            return 3;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    subs.clear();
+
+    // terminate and unmap
+    sp->termh(this, pd);
+    dlclose(sp->handle);
     return 0;
 }
 
+int mink_utils::PluginManager::unload(const std::string &fpath){
+    PluginDescriptor *pd = nullptr;
+    {
+        std::unique_lock<std::mutex> l(plg_mtx);
+        for (auto &p : plgs) {
+            if (p->name == fpath) {
+                pd = p.get();
+                break;
+            }
+        }
+    }
+    return (pd ? unload(pd) : 1);
+}
+
+int mink_utils::PluginManager::reload(const std::string &fpath){
+    PluginDescriptor *pd = nullptr;
+    {
+        std::unique_lock<std::mutex> l(plg_mtx);
+        for (auto &p : plgs) {
+            if (p->name == fpath) {
+                pd = p.get();
+                break;
+            }
+        }
+    }
+    // unload old version
+    if (pd) {
+        int r = unload(pd);
+        if (r)
+            return r;
+        // image marked NODELETE (e.g. STB_GNU_UNIQUE symbols
+        // pulled in by libstdc++/nlohmann) stays mapped after
+        // dlclose; dlopen would return old code again
+        void *h = dlopen(fpath.c_str(), RTLD_NOW | RTLD_NOLOAD);
+        if (h) {
+            dlclose(h);
+            mink::CURRENT_DAEMON->log(mink::LLT_ERROR,
+                                      "plugin [%s] still mapped after unload, "
+                                      "restart required to load new version",
+                                      fpath.c_str());
+            // keep old version running
+            load(fpath);
+            return 5;
+        }
+    }
+    // load new version
+    return (load(fpath) ? 0 : 4);
+}
+
+bool mink_utils::PluginManager::is_loaded(const std::string &fpath){
+    std::unique_lock<std::mutex> l(plg_mtx);
+    return std::any_of(plgs.cbegin(),
+                       plgs.cend(),
+                       [&fpath](const std::shared_ptr<PluginDescriptor> &p) {
+                           return p->name == fpath;
+                       });
+}
+
+void mink_utils::PluginManager::commands(std::vector<int> &out){
+    out.clear();
+    auto c_hooks = std::atomic_load(&hooks);
+    if (!c_hooks) return;
+    for (auto &h : *c_hooks)
+        out.push_back(h.first);
+}
+
 int mink_utils::PluginManager::run(int cmd_id, PluginInputData &data, bool is_local) {
-    // plugin for cmd
-    auto pd = hooks.find(cmd_id);
-    if(pd == hooks.end()) return 1;
+    // plugin for cmd (reference is held while
+    // plugin handler is running)
+    auto c_hooks = std::atomic_load(&hooks);
+    if (!c_hooks) return 1;
+    auto it = c_hooks->find(cmd_id);
+    if(it == c_hooks->end()) return 1;
+    std::shared_ptr<PluginDescriptor> pd = it->second;
     // local
     if (is_local) {
         // handler implemented
-        if (pd->second->cmdh_l) {
-            return pd->second->cmdh_l(this, pd->second, cmd_id, data);
+        if (pd->cmdh_l) {
+            return pd->cmdh_l(this, pd.get(), cmd_id, data);
 
         // local handler not found
         } else {
@@ -114,7 +297,7 @@ int mink_utils::PluginManager::run(int cmd_id, PluginInputData &data, bool is_lo
     }
 
     // remote
-    return pd->second->cmdh(this, pd->second, cmd_id, data);
+    return pd->cmdh(this, pd.get(), cmd_id, data);
 
 }
 
@@ -122,16 +305,560 @@ int mink_utils::PluginManager::run(int cmd_id, PluginInputData &&data, bool is_l
     return run(cmd_id, data, is_local);
 }
 
-int mink_utils::PluginManager::register_signal(const std::string &s, SignalHandler *h) {
-    signals[s].connect(std::ref(*h));
+int mink_utils::PluginManager::run_async(int cmd_id,
+                                         PluginInputData data,
+                                         PluginCompletion::cb_t &&cb) {
+    // plugin for cmd
+    auto c_hooks = std::atomic_load(&hooks);
+    if (!c_hooks) return 1;
+    auto it = c_hooks->find(cmd_id);
+    if(it == c_hooks->end()) return 1;
+    std::shared_ptr<PluginDescriptor> pd = it->second;
+    // callback is shared by async handler and sync
+    // fallback
+    auto scb = std::make_shared<PluginCompletion::cb_t>(std::move(cb));
+    // async handler implemented
+    if (pd->cmdh_a) {
+        // plugin reference is held until completion
+        auto c = new PluginCompletion([scb, pd](int res) { (*scb)(res); });
+        int r = pd->cmdh_a(this, pd.get(), cmd_id, data, c);
+        // accepted, plugin owns completion handle
+        if (r == 0)
+            return 0;
+        delete c;
+        if (r != PLG_ASYNC_NA)
+            return r;
+    }
+    // sync handler in executor
+    int r = exec.submit(cmd_id, [this, cmd_id, data, scb]() mutable {
+        (*scb)(run(cmd_id, data));
+    }, [scb]() {
+        // discarded on shutdown
+        (*scb)(mink::error::EC_UNKNOWN);
+    });
+    return (r ? mink::error::EC_BUSY : 0);
+}
+
+int mink_utils::PluginManager::signal_id(const std::string &s) {
+    std::unique_lock<std::mutex> l(sig_mtx);
+    auto it = sig_ids.find(s);
+    if (it != sig_ids.end())
+        return it->second;
+    // table full
+    int sid = sig_ids.size();
+    if (sid >= MAX_SIGNALS)
+        return -1;
+    signals[sid].name = s;
+    sig_ids.emplace(s, sid);
+    return sid;
+}
+
+int mink_utils::PluginManager::register_signal(const std::string &s,
+                                               SignalHandler *h,
+                                               const SignalOpts &opts) {
+    if (!h)
+        return 1;
+    int sid = signal_id(s);
+    if (sid < 0)
+        return 1;
+
+    auto sub = std::make_shared<SignalSubscriber>();
+    sub->h = h;
+    sub->opts = opts;
+    sub->owner = loading_pd;
+    if (sub->opts.qsize == 0)
+        sub->opts.qsize = 1;
+    if (sub->opts.lanes == 0)
+        sub->opts.lanes = 1;
+
+    std::unique_lock<std::mutex> l(sig_mtx);
+    // async lanes (one executor key each)
+    for (std::size_t i = 0; i < sub->opts.lanes; i++) {
+        sub->lanes.emplace_back(new SignalLane());
+        sub->lanes.back()->id = sig_sub_cnt++;
+        sub->lanes.back()->idx = i;
+    }
+    // async workers (started once, one per CPU)
+    if (opts.mode == SD_ASYNC) {
+        std::size_t n = std::thread::hardware_concurrency();
+        if (n < SIG_WORKERS)
+            n = SIG_WORKERS;
+        sig_exec.start(n, 1);
+    }
+    // copy-on-write subscriber list
+    Signal &sig = signals[sid];
+    auto subs = std::atomic_load(&sig.subs);
+    auto n_subs = std::make_shared<Signal::subs_t>();
+    if (subs)
+        *n_subs = *subs;
+    n_subs->push_back(sub);
+    std::atomic_store(&sig.subs, std::shared_ptr<const Signal::subs_t>(n_subs));
     return 0;
 }
 
-std::string mink_utils::PluginManager::process_signal(const std::string &s, Plugin_data_std &d) {
-    // find signal
-    auto it = signals.find(s);
-    if (it != signals.cend()) {
-        return *it->second(d);
+void mink_utils::PluginManager::sig_remove(const PluginDescriptor *pd, sig_subs_t *out) {
+    std::unique_lock<std::mutex> l(sig_mtx);
+    for (auto &it : sig_ids) {
+        Signal &sig = signals[it.second];
+        auto subs = std::atomic_load(&sig.subs);
+        if (!subs)
+            continue;
+        auto n_subs = std::make_shared<Signal::subs_t>();
+        for (auto &sub : *subs) {
+            if (sub->owner.get() != pd)
+                n_subs->push_back(sub);
+            else if (out)
+                out->push_back(std::make_pair(it.second, sub));
+        }
+        if (n_subs->size() != subs->size())
+            std::atomic_store(&sig.subs, std::shared_ptr<const Signal::subs_t>(n_subs));
+    }
+}
+
+void mink_utils::PluginManager::sig_restore(const sig_subs_t &subs) {
+    std::unique_lock<std::mutex> l(sig_mtx);
+    for (auto &s : subs) {
+        Signal &sig = signals[s.first];
+        auto c_subs = std::atomic_load(&sig.subs);
+        auto n_subs = std::make_shared<Signal::subs_t>();
+        if (c_subs)
+            *n_subs = *c_subs;
+        n_subs->push_back(s.second);
+        std::atomic_store(&sig.subs, std::shared_ptr<const Signal::subs_t>(n_subs));
+    }
+}
+
+std::string mink_utils::PluginManager::process_signal(const std::string &s, PluginData &d) {
+    int sid = -1;
+    {
+        std::unique_lock<std::mutex> l(sig_mtx);
+        auto it = sig_ids.find(s);
+        if (it == sig_ids.end())
+            return "";
+        sid = it->second;
+    }
+    return process_signal(sid, d);
+}
+
+std::string mink_utils::PluginManager::process_signal(int sid, PluginData &d) {
+    if (sid < 0 || sid >= MAX_SIGNALS)
+        return "";
+    Signal &sig = signals[sid];
+    ++sig.emitted;
+    // subscriber snapshot
+    auto subs = std::atomic_load(&sig.subs);
+    if (!subs)
+        return "";
+    std::string res;
+    for (auto &sub : *subs) {
+        if (sub->opts.mode == SD_ASYNC) {
+            sig_enqueue(sig, sub, d);
+            continue;
+        }
+        res = (*sub->h)(d);
+        ++sig.delivered;
+    }
+    return res;
+}
+
+mink_utils::SignalLane &mink_utils::PluginManager::sig_lane(SignalSubscriber &sub,
+                                                            const PluginData &d) {
+    if (sub.lanes.size() == 1)
+        return *sub.lanes[0];
+    // round-robin (unordered)
+    if (sub.opts.order_key.empty())
+        return *sub.lanes[sub.rr++ % sub.lanes.size()];
+    // order key; events without key are ordered
+    // among themselves
+    const PluginColumn *c = (d.empty() ? nullptr : d.find(0, sub.opts.order_key));
+    if (!c)
+        return *sub.lanes[0];
+    uint64_t h;
+    if (c->value.type == PVT_STRING || c->value.type == PVT_BYTES)
+        h = hash_fnv1a_64bit(c->value.s.data(), c->value.s.size());
+    else
+        h = hash_fnv1a_64bit(&c->value.i, sizeof(c->value.i));
+    return *sub.lanes[h % sub.lanes.size()];
+}
+
+void mink_utils::PluginManager::sig_enqueue(Signal &sig,
+                                            const std::shared_ptr<SignalSubscriber> &sub,
+                                            const PluginData &d) {
+    SignalLane *ln = &sig_lane(*sub, d);
+    std::unique_lock<std::mutex> l(ln->mtx);
+    // coalesce; replace undelivered event
+    if (sub->opts.policy == SP_COALESCE && !ln->q.empty()) {
+        ln->q.back()->assign(d);
+        ++sig.coalesced;
+        return;
+    }
+    // queue full
+    if (ln->q.size() >= sub->opts.qsize) {
+        ++sig.dropped;
+        if (sub->opts.policy == SP_DROP_NEW)
+            return;
+        ln->q.pop_front();
+    }
+    ln->q.emplace_back(new PluginData());
+    ln->q.back()->assign(d);
+    // schedule drain (one per lane, handler is never
+    // run concurrently for the same lane)
+    if (ln->scheduled)
+        return;
+    ln->scheduled = true;
+    l.unlock();
+    if (sig_exec.submit(ln->id, [this, &sig, sub, ln] { sig_drain(sig, sub, ln); })) {
+        // executor stopped, retried on next emit
+        l.lock();
+        ln->scheduled = false;
+    }
+}
+
+void mink_utils::PluginManager::sig_drain(Signal &sig,
+                                          std::shared_ptr<SignalSubscriber> sub,
+                                          SignalLane *ln) {
+    for (std::size_t i = 0; i < SIG_BATCH; i++) {
+        std::unique_lock<std::mutex> l(ln->mtx);
+        if (ln->q.empty()) {
+            ln->scheduled = false;
+            return;
+        }
+        std::unique_ptr<PluginData> d = std::move(ln->q.front());
+        ln->q.pop_front();
+        l.unlock();
+        sub->h->run_lane(*d, ln->idx);
+        ++sig.delivered;
+    }
+    // batch done; requeue to let other lanes run
+    if (sig_exec.submit(ln->id, [this, &sig, sub, ln] { sig_drain(sig, sub, ln); })) {
+        std::unique_lock<std::mutex> l(ln->mtx);
+        ln->scheduled = false;
+    }
+}
+
+void mink_utils::PluginManager::signal_stats(std::vector<SignalStats> &out) {
+    std::unique_lock<std::mutex> l(sig_mtx);
+    out.clear();
+    for (auto &it : sig_ids) {
+        Signal &sig = signals[it.second];
+        auto subs = std::atomic_load(&sig.subs);
+        SignalStats st;
+        st.name = sig.name;
+        st.subs = (subs ? subs->size() : 0);
+        st.emitted = sig.emitted;
+        st.delivered = sig.delivered;
+        st.dropped = sig.dropped;
+        st.coalesced = sig.coalesced;
+        out.push_back(st);
+    }
+}
+
+int mink_utils::PluginManager::submit(int cmd_id,
+                                      CmdExecutor::task_t &&t,
+                                      CmdExecutor::task_t &&cancel) {
+    return exec.submit(cmd_id, std::move(t), std::move(cancel));
+}
+
+/**************/
+/* PluginData */
+/**************/
+std::string mink_utils::PluginValue::str() const {
+    switch (type) {
+        case PVT_INT:
+            return std::to_string(i);
+        case PVT_DOUBLE:
+            return std::to_string(d);
+        case PVT_STRING:
+        case PVT_BYTES:
+            return std::string(s);
+        default:
+            return "";
+    }
+}
+
+std::size_t mink_utils::PluginData::row_size(std::size_t r) const {
+    if (r >= rows_.size())
+        return 0;
+    std::size_t e = (r + 1 < rows_.size() ? rows_[r + 1] : cols_.size());
+    return e - rows_[r];
+}
+
+std::size_t mink_utils::PluginData::add_row() {
+    rows_.push_back(cols_.size());
+    return rows_.size() - 1;
+}
+
+void mink_utils::PluginData::clear() {
+    cols_.clear();
+    rows_.clear();
+    // keep first block
+    big_.clear();
+    if (arena_.size() > 1)
+        arena_.resize(1);
+    if (!arena_.empty()) {
+        a_ptr_ = arena_[0].get();
+        a_free_ = ARENA_BLOCK_SIZE;
+    }
+}
+
+boost::string_view mink_utils::PluginData::store(boost::string_view s) {
+    std::size_t sz = s.size() + 1;
+    char *p = nullptr;
+    // large string, dedicated block
+    if (sz > ARENA_BLOCK_SIZE / 4) {
+        big_.emplace_back(new char[sz]);
+        p = big_.back().get();
+
+    } else {
+        // new block
+        if (sz > a_free_) {
+            arena_.emplace_back(new char[ARENA_BLOCK_SIZE]);
+            a_ptr_ = arena_.back().get();
+            a_free_ = ARENA_BLOCK_SIZE;
+        }
+        p = a_ptr_;
+        a_ptr_ += sz;
+        a_free_ -= sz;
+    }
+    if (!s.empty())
+        memcpy(p, s.data(), s.size());
+    p[s.size()] = '\0';
+    return boost::string_view(p, s.size());
+}
+
+int mink_utils::PluginData::insert(std::size_t r, const PluginColumn &c) {
+    if (r >= rows_.size())
+        return 1;
+    // keys are unique per row
+    if (find(r, c.key))
+        return 1;
+    // append to row (last row is the common case)
+    std::size_t e = (r + 1 < rows_.size() ? rows_[r + 1] : cols_.size());
+    cols_.insert(cols_.begin() + e, c);
+    for (std::size_t i = r + 1; i < rows_.size(); i++)
+        ++rows_[i];
+    return 0;
+}
+
+int mink_utils::PluginData::add(std::size_t r, boost::string_view k, int64_t v) {
+    if (r >= rows_.size() || find(r, k))
+        return 1;
+    PluginColumn c;
+    c.key = store(k);
+    c.value.type = PVT_INT;
+    c.value.i = v;
+    return insert(r, c);
+}
+
+int mink_utils::PluginData::add(std::size_t r, boost::string_view k, double v) {
+    if (r >= rows_.size() || find(r, k))
+        return 1;
+    PluginColumn c;
+    c.key = store(k);
+    c.value.type = PVT_DOUBLE;
+    c.value.d = v;
+    return insert(r, c);
+}
+
+int mink_utils::PluginData::add(std::size_t r,
+                                boost::string_view k,
+                                boost::string_view v,
+                                PluginValueType t) {
+    if (r >= rows_.size() || find(r, k))
+        return 1;
+    PluginColumn c;
+    c.key = store(k);
+    c.value.type = t;
+    c.value.s = store(v);
+    return insert(r, c);
+}
+
+int mink_utils::PluginData::add_ref(std::size_t r,
+                                    boost::string_view k,
+                                    boost::string_view v,
+                                    PluginValueType t) {
+    PluginColumn c;
+    c.key = k;
+    c.value.type = t;
+    c.value.s = v;
+    return insert(r, c);
+}
+
+const mink_utils::PluginColumn *mink_utils::PluginData::get(std::size_t r,
+                                                            std::size_t c) const {
+    if (c >= row_size(r))
+        return nullptr;
+    return &cols_[rows_[r] + c];
+}
+
+const mink_utils::PluginColumn *mink_utils::PluginData::find(std::size_t r,
+                                                             boost::string_view k) const {
+    std::size_t n = row_size(r);
+    for (std::size_t i = 0; i < n; i++) {
+        const PluginColumn &c = cols_[rows_[r] + i];
+        if (c.key == k)
+            return &c;
+    }
+    return nullptr;
+}
+
+void mink_utils::PluginData::assign(const PluginData &o) {
+    if (&o == this)
+        return;
+    clear();
+    cols_.reserve(o.cols_.size());
+    rows_ = o.rows_;
+    for (auto &c : o.cols_) {
+        PluginColumn nc = c;
+        nc.key = store(c.key);
+        if (c.value.type == PVT_STRING || c.value.type == PVT_BYTES)
+            nc.value.s = store(c.value.s);
+        cols_.push_back(nc);
+    }
+}
+
+void mink_utils::PluginData::from_std(const Plugin_data_std &d) {
+    clear();
+    for (auto &row : d) {
+        std::size_t r = add_row();
+        for (auto &c : row)
+            add(r, c.first, c.second);
+    }
+}
+
+void mink_utils::PluginData::to_std(Plugin_data_std &d) const {
+    d.clear();
+    d.reserve(rows_.size());
+    for (std::size_t r = 0; r < rows_.size(); r++) {
+        std::map<std::string, std::string> row;
+        std::size_t n = row_size(r);
+        for (std::size_t i = 0; i < n; i++) {
+            const PluginColumn &c = cols_[rows_[r] + i];
+            row.emplace(c.key, c.value.str());
+        }
+        d.push_back(std::move(row));
+    }
+}
+
+/***************/
+/* CmdExecutor */
+/***************/
+mink_utils::CmdExecutor::~CmdExecutor(){
+    stop();
+}
+
+int mink_utils::CmdExecutor::start(std::size_t _workers,
+                                   std::size_t _qsize,
+                                   std::size_t _max_active){
+    std::unique_lock<std::mutex> l(mtx);
+    if (active || _workers == 0 || _qsize == 0)
+        return 1;
+    qsize = _qsize;
+    // leave at least one worker for other commands
+    if (_max_active == 0)
+        _max_active = (_workers > 1 ? _workers - 1 : 1);
+    max_active = std::min(_max_active, _workers);
+    active = true;
+    for (std::size_t i = 0; i < _workers; i++)
+        workers.emplace_back(&CmdExecutor::run, this);
+    return 0;
+}
+
+void mink_utils::CmdExecutor::stop(){
+    std::unique_lock<std::mutex> l(mtx);
+    if (!active)
+        return;
+    active = false;
+    l.unlock();
+    cv.notify_all();
+    for (auto &th : workers)
+        th.join();
+    workers.clear();
+    l.lock();
+    // discard queued tasks
+    std::deque<Task> pending;
+    ready.clear();
+    for (auto &cq : queues) {
+        for (auto &tsk : cq.second.q)
+            pending.push_back(std::move(tsk));
+        cq.second.q.clear();
+        cq.second.ready = false;
+    }
+    l.unlock();
+    // notify owners (no locks held)
+    for (auto &tsk : pending) {
+        if (tsk.cancel)
+            tsk.cancel();
+    }
+}
+
+// add to ready list if runnable (mtx locked)
+void mink_utils::CmdExecutor::schedule(int cmd_id, CmdQueue &cq){
+    if (cq.ready || cq.q.empty() || cq.active >= max_active)
+        return;
+    cq.ready = true;
+    ready.push_back(cmd_id);
+    cv.notify_one();
+}
+
+int mink_utils::CmdExecutor::submit(int cmd_id, task_t &&t, task_t &&cancel){
+    std::unique_lock<std::mutex> l(mtx);
+    if (!active)
+        return 1;
+    CmdQueue &cq = queues[cmd_id];
+    cq.st.cmd_id = cmd_id;
+    // saturated
+    if (cq.q.size() >= qsize) {
+        ++cq.st.rejected;
+        return 1;
+    }
+    cq.q.push_back({std::move(t), std::move(cancel), clock_t::now()});
+    schedule(cmd_id, cq);
+    return 0;
+}
+
+void mink_utils::CmdExecutor::run(){
+    std::unique_lock<std::mutex> l(mtx);
+    while (true) {
+        cv.wait(l, [this] { return !active || !ready.empty(); });
+        if (!active)
+            return;
+        // next command (round-robin)
+        int cmd_id = ready.front();
+        ready.pop_front();
+        CmdQueue &cq = queues[cmd_id];
+        cq.ready = false;
+        Task tsk = std::move(cq.q.front());
+        cq.q.pop_front();
+        ++cq.active;
+        // more tasks for this command; back of the line
+        schedule(cmd_id, cq);
+        l.unlock();
+
+        // run
+        tsk.t();
+        tsk.t = nullptr;
+        auto lat = std::chrono::duration_cast<std::chrono::microseconds>(
+                       clock_t::now() - tsk.ts).count();
+
+        l.lock();
+        --cq.active;
+        ++cq.st.done;
+        cq.lat_sum += lat;
+        if (static_cast<uint64_t>(lat) > cq.st.lat_max)
+            cq.st.lat_max = lat;
+        schedule(cmd_id, cq);
+    }
+}
+
+void mink_utils::CmdExecutor::stats(std::vector<CmdExecStats> &out){
+    std::unique_lock<std::mutex> l(mtx);
+    out.clear();
+    for (auto &cq : queues) {
+        CmdExecStats st = cq.second.st;
+        st.depth = cq.second.q.size();
+        st.active = cq.second.active;
+        st.lat_avg = (st.done > 0 ? cq.second.lat_sum / st.done : 0);
+        out.push_back(st);
     }
-    return "";
 }
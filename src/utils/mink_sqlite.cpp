@@ -15,11 +15,14 @@
 #include <gdt.pb.enums_only.h>
 #include <algorithm>
 #include <gdt_def.h>
+#include <chrono>
+#include <random>
 
 // aliases
 using msqlm = mink_db::SqliteManager;
 using vparam = mink_utils::VariantParam;
 using ptype = asn1::ParameterType;
+using auth_res_t = std::tuple<int, int, int>;
 
 /******************/
 /* sql statements */
@@ -74,10 +77,7 @@ const char *msqlm::SQL_USER_CMD_SPECIFIC_AUTH =
 /***************/
 /* CmdUbusAuth */
 /***************/
-bool mink_db::CmdUbusAuth::do_auth(sqlite3 *db, const vpmap &vp){
-    if (!db)
-        throw std::invalid_argument("invalid db connection");
-
+bool mink_db::CmdUbusAuth::do_auth(SqliteManager &dbm, const vpmap &vp){
      // look for cmd id
     const vparam *vp_cmd_id = vp.get_param(ptype::_pt_mink_command_id);
     if (!vp_cmd_id)
@@ -106,15 +106,8 @@ bool mink_db::CmdUbusAuth::do_auth(sqlite3 *db, const vpmap &vp){
     std::string req_upath(static_cast<char *>(*vp_upath));
     std::string req_umethod(static_cast<char *>(*vp_umethod));
 
-    // prepare statement
-    sqlite3_stmt *stmt = nullptr;
-    int r = sqlite3_prepare_v2(db, 
-                               msqlm::SQL_USER_CMD_SPECIFIC_AUTH, 
-                               -1, 
-                               &stmt,
-                               nullptr);
-    if (r != SQLITE_OK)
-        throw std::invalid_argument("sql:cannot prepare statement");
+    // prepared statement
+    sqlite3_stmt *stmt = dbm.get_stmt(QueryType::USER_CMD_SPECIFIC_AUTH);
 
     // username
     if (sqlite3_bind_text(stmt, 1, usr.c_str(), usr.size(), SQLITE_STATIC))
@@ -150,38 +143,130 @@ bool mink_db::CmdUbusAuth::do_auth(sqlite3 *db, const vpmap &vp){
     }
 
     // cleanup
-    if(sqlite3_clear_bindings(stmt))
-        throw std::invalid_argument("sql:cannot clear bindings");
-    if(sqlite3_reset(stmt))
-        throw std::invalid_argument("sql:cannot reset statement");
-    if(sqlite3_finalize(stmt))
-        throw std::invalid_argument("sql:cannot finalize statement");
+    dbm.release_stmt(stmt);
 
     // return auth res
     return res;
 }
 
+std::string mink_db::CmdUbusAuth::cache_key(const vpmap &vp){
+    // username, ubus path and ubus method
+    const vparam *vp_usr = vp.get_param(ptype::_pt_mink_auth_id);
+    const vparam *vp_upath = vp.get_param(gdt_grpc::PT_OWRT_UBUS_PATH);
+    const vparam *vp_umethod = vp.get_param(gdt_grpc::PT_OWRT_UBUS_METHOD);
+    if (!(vp_usr && vp_upath && vp_umethod))
+        return "";
+
+    std::string k(static_cast<char *>(*vp_usr));
+    k.append(1, '\0');
+    k.append(static_cast<char *>(*vp_upath));
+    k.append(1, '\0');
+    k.append(static_cast<char *>(*vp_umethod));
+    return k;
+}
+
 void msqlm::create_cmd_spec_hndlrs(){
     // cmd specific authorisation handlers
     cmd_spec_auth_map[gdt_grpc::CMD_UBUS_CALL] = new CmdUbusAuth();
 }
 
+/***********/
+/* SHA-256 */
+/***********/
+static inline uint32_t sha256_rotr(uint32_t x, int n){
+    return (x >> n) | (x << (32 - n));
+}
+
+static void sha256_block(uint32_t *h, const unsigned char *p){
+    static const uint32_t k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+        0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+        0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+        0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+        0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+        0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 |
+               (uint32_t)p[i * 4 + 2] << 8 | (uint32_t)p[i * 4 + 3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = sha256_rotr(w[i - 15], 7) ^ sha256_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = sha256_rotr(w[i - 2], 17) ^ sha256_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3];
+    uint32_t e = h[4], f = h[5], g = h[6], hh = h[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t s1 = sha256_rotr(e, 6) ^ sha256_rotr(e, 11) ^ sha256_rotr(e, 25);
+        uint32_t t1 = hh + s1 + ((e & f) ^ (~e & g)) + k[i] + w[i];
+        uint32_t s0 = sha256_rotr(a, 2) ^ sha256_rotr(a, 13) ^ sha256_rotr(a, 22);
+        uint32_t t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+        hh = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+    h[4] += e; h[5] += f; h[6] += g; h[7] += hh;
+}
+
+// SHA-256 digest (32 bytes) of data
+static std::string sha256(const std::string &data){
+    uint32_t h[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    // padding: 0x80, zeros, 64bit big endian bit length
+    std::string m(data);
+    uint64_t bits = (uint64_t)data.size() * 8;
+    m.append(1, '\x80');
+    while (m.size() % 64 != 56)
+        m.append(1, '\0');
+    for (int i = 7; i >= 0; i--)
+        m.append(1, (char)(bits >> (i * 8)));
+    for (std::size_t i = 0; i < m.size(); i += 64)
+        sha256_block(h, (const unsigned char *)m.data() + i);
+    // wipe password copy
+    std::fill(m.begin(), m.end(), '\0');
+
+    std::string res;
+    for (int i = 0; i < 8; i++)
+        for (int j = 3; j >= 0; j--)
+            res.append(1, (char)(h[i] >> (j * 8)));
+    return res;
+}
+
 /*****************/
 /* SqliteManager */
 /*****************/
 msqlm::SqliteManager() {
+    // auth cache salt
+    gen_cache_salt();
     // cmd specific authorisation handlers
     create_cmd_spec_hndlrs();
 }
 
 msqlm::SqliteManager(const std::string &db_f) { 
+    // auth cache salt
+    gen_cache_salt();
     connect(db_f);
     // cmd specific authorisation handlers
     create_cmd_spec_hndlrs();
 }
 
+void msqlm::gen_cache_salt(){
+    std::random_device rd;
+    cache_salt.clear();
+    for (int i = 0; i < 4; i++) {
+        uint32_t r = rd();
+        cache_salt.append((const char *)&r, sizeof(r));
+    }
+}
+
 msqlm::~SqliteManager(){
-    if (db) sqlite3_close(db);
+    close();
     std::all_of(cmd_spec_auth_map.cbegin(), cmd_spec_auth_map.cend(),
                 [](const std::pair<const int, CmdSpecificAuth *> &c) {
                     delete c.second;
@@ -189,38 +274,206 @@ msqlm::~SqliteManager(){
                 });
 }
 
-bool msqlm::cmd_specific_auth(const vpmap &vp, const std::string &u){
+// monotonic msec timestamp
+static uint64_t now_msec(){
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+sqlite3_stmt *msqlm::get_stmt(QueryType qt){
     if (!db)
         throw std::invalid_argument("invalid db connection");
 
+    // already prepared
+    auto it = stmts.find(qt);
+    if (it != stmts.end())
+        return it->second;
+
+    // sql
+    const char *sql = nullptr;
+    switch (qt) {
+        case QueryType::USER_AUTH:
+            sql = SQL_USER_AUTH;
+            break;
+        case QueryType::USER_ADD:
+            sql = SQL_USER_ADD;
+            break;
+        case QueryType::USER_DEL:
+            sql = SQL_USER_DEL;
+            break;
+        case QueryType::USER_CMD_DEL:
+            sql = SQL_USER_CMD_DEL;
+            break;
+        case QueryType::USER_CMD_AUTH:
+            sql = SQL_USER_CMD_AUTH;
+            break;
+        case QueryType::USER_CMD_SPECIFIC_AUTH:
+            sql = SQL_USER_CMD_SPECIFIC_AUTH;
+            break;
+    }
+
+    // prepare statement (kept until connection is closed)
+    sqlite3_stmt *stmt = nullptr;
+    int r = sqlite3_prepare_v3(db, 
+                               sql, 
+                               -1, 
+                               SQLITE_PREPARE_PERSISTENT,
+                               &stmt,
+                               nullptr);
+    if (r != SQLITE_OK)
+        throw std::invalid_argument("sql:cannot prepare statement");
+
+    stmts[qt] = stmt;
+    return stmt;
+}
+
+void msqlm::release_stmt(sqlite3_stmt *stmt){
+    // reset for next use; statement is not finalized
+    if(sqlite3_clear_bindings(stmt))
+        throw std::invalid_argument("sql:cannot clear bindings");
+    if(sqlite3_reset(stmt))
+        throw std::invalid_argument("sql:cannot reset statement");
+}
+
+void msqlm::close(){
+    // finalize cached statements
+    for (auto &s : stmts)
+        sqlite3_finalize(s.second);
+    stmts.clear();
+    if (db) sqlite3_close(db);
+    db = nullptr;
+}
+
+void msqlm::check_reopen(){
+    // db file was replaced, current connection
+    // still points to the old inode
+    if (!db_replaced.load())
+        return;
+    db_replaced.store(false);
+    close();
+    connect(db_file);
+}
+
+void msqlm::check_db_file(uint64_t now){
+    // rate limit stat calls
+    if (now - db_chk_ts < DB_CHECK_INTERVAL)
+        return;
+    db_chk_ts = now;
+
+    struct stat st = {};
+    struct stat wal_st = {};
+    if (stat(db_file.c_str(), &st))
+        return;
+    // WAL mode: changes are not visible in main file
+    stat((db_file + "-wal").c_str(), &wal_st);
+
+    // check if changed
+    if (st.st_ino != db_st.st_ino ||
+        st.st_size != db_st.st_size ||
+        st.st_mtim.tv_sec != db_st.st_mtim.tv_sec ||
+        st.st_mtim.tv_nsec != db_st.st_mtim.tv_nsec ||
+        wal_st.st_size != db_wal_st.st_size ||
+        wal_st.st_mtim.tv_sec != db_wal_st.st_mtim.tv_sec ||
+        wal_st.st_mtim.tv_nsec != db_wal_st.st_mtim.tv_nsec) {
+
+        // new file
+        if (st.st_ino != db_st.st_ino)
+            db_replaced.store(true);
+
+        db_st = st;
+        db_wal_st = wal_st;
+        auth_cache.clear();
+    }
+}
+
+bool msqlm::cache_get(const std::string &k, auth_res_t &res){
+    std::unique_lock<std::mutex> l(cache_mtx);
+    if (cache_ttl == 0)
+        return false;
+
+    uint64_t now = now_msec();
+    // invalidate if db file has changed
+    check_db_file(now);
+    // find
+    auto it = auth_cache.find(k);
+    if (it == auth_cache.end())
+        return false;
+    // expired
+    if (now - it->second.ts > cache_ttl) {
+        auth_cache.erase(it);
+        return false;
+    }
+    res = it->second.res;
+    return true;
+}
+
+void msqlm::cache_set(const std::string &k, const auth_res_t &res){
+    std::unique_lock<std::mutex> l(cache_mtx);
+    if (cache_ttl == 0)
+        return;
+    // size limit reached, start over
+    if (auth_cache.size() >= AUTH_CACHE_MAX)
+        auth_cache.clear();
+    auth_cache[k] = AuthCacheEntry{res, now_msec()};
+}
+
+void msqlm::set_auth_cache_ttl(uint32_t ttl_msec){
+    std::unique_lock<std::mutex> l(cache_mtx);
+    cache_ttl = ttl_msec;
+    auth_cache.clear();
+}
+
+void msqlm::auth_cache_clear(){
+    std::unique_lock<std::mutex> l(cache_mtx);
+    auth_cache.clear();
+}
+
+bool msqlm::cmd_specific_auth(const vpmap &vp, const std::string &u){
      // look for cmd id
     const vparam *vp_cmd_id = vp.get_param(ptype::_pt_mink_command_id);
     if (!vp_cmd_id)
         return false;
 
     // check if specific cmd handler exists
-    auto it = cmd_spec_auth_map.find(static_cast<int>(*vp_cmd_id));
+    int cmd_id = static_cast<int>(*vp_cmd_id);
+    auto it = cmd_spec_auth_map.find(cmd_id);
     // handler not found, auth = success
     if (it == cmd_spec_auth_map.cend())
         return true;
 
+    // check cache
+    std::string k = it->second->cache_key(vp);
+    auth_res_t cr;
+    if (!k.empty()) {
+        k = "s:" + std::to_string(cmd_id) + ":" + k;
+        if (cache_get(k, cr))
+            return std::get<0>(cr);
+    }
+
     // run specific handler
-    return it->second->do_auth(db, vp);
+    std::unique_lock<std::mutex> l(stmt_mtx);
+    check_reopen();
+    bool res = it->second->do_auth(*this, vp);
+    l.unlock();
+
+    // cache decision
+    if (!k.empty())
+        cache_set(k, std::make_tuple(res, 0, 0));
+
+    return res;
 } 
 
 bool msqlm::cmd_auth(const int cmd_id, const std::string &u){
-    if (!db)
-        throw std::invalid_argument("invalid db connection");
+    // check cache
+    std::string k = "c:" + std::to_string(cmd_id) + ":" + u;
+    auth_res_t cr;
+    if (cache_get(k, cr))
+        return std::get<0>(cr);
 
-    // prepare statement
-    sqlite3_stmt *stmt = nullptr;
-    int r = sqlite3_prepare_v2(db, 
-                               SQL_USER_CMD_AUTH, 
-                               -1, 
-                               &stmt,
-                               nullptr);
-    if (r != SQLITE_OK)
-        throw std::invalid_argument("sql:cannot prepare statement");
+    // prepared statement
+    std::unique_lock<std::mutex> l(stmt_mtx);
+    check_reopen();
+    sqlite3_stmt *stmt = get_stmt(QueryType::USER_CMD_AUTH);
 
     // cmd id
     if (sqlite3_bind_int(stmt, 1, cmd_id))
@@ -236,30 +489,31 @@ bool msqlm::cmd_auth(const int cmd_id, const std::string &u){
         res = sqlite3_data_count(stmt) > 0;
 
     // cleanup
-    if(sqlite3_clear_bindings(stmt))
-        throw std::invalid_argument("sql:cannot clear bindings");
-    if(sqlite3_reset(stmt))
-        throw std::invalid_argument("sql:cannot reset statement");
-    if(sqlite3_finalize(stmt))
-        throw std::invalid_argument("sql:cannot finalize statement");
+    release_stmt(stmt);
+    l.unlock();
+
+    // cache decision
+    cache_set(k, std::make_tuple(res, 0, 0));
 
     // default auth value
     return res;
 } 
 
 std::tuple<int, int, int> msqlm::user_auth(const std::string &u, const std::string &p){
-    if (!db)
-        throw std::invalid_argument("invalid db connection");
-
-    // prepare statement
-    sqlite3_stmt *stmt = nullptr;
-    int r = sqlite3_prepare_v2(db, 
-                               SQL_USER_AUTH, 
-                               -1, 
-                               &stmt,
-                               nullptr);
-    if (r != SQLITE_OK)
-        throw std::invalid_argument("sql:cannot prepare statement");
+    // check cache (successful auth only, failed
+    // attempts always reach the db); password is
+    // kept only as salted hash
+    std::string k = "u:" + u;
+    k.append(1, '\0');
+    k.append(sha256(cache_salt + p));
+    auth_res_t cr;
+    if (cache_get(k, cr))
+        return cr;
+
+    // prepared statement
+    std::unique_lock<std::mutex> l(stmt_mtx);
+    check_reopen();
+    sqlite3_stmt *stmt = get_stmt(QueryType::USER_AUTH);
 
     // username
     if (sqlite3_bind_text(stmt, 1, u.c_str(), u.size(), SQLITE_STATIC))
@@ -284,13 +538,12 @@ std::tuple<int, int, int> msqlm::user_auth(const std::string &u, const std::stri
         auth = sqlite3_column_int(stmt, 3);
     }
     // cleanup
-    if(sqlite3_clear_bindings(stmt))
-        throw std::invalid_argument("sql:cannot clear bindings");
-    if(sqlite3_reset(stmt))
-        throw std::invalid_argument("sql:cannot reset statement");
-    if(sqlite3_finalize(stmt))
-        throw std::invalid_argument("sql:cannot finalize statement");
+    release_stmt(stmt);
+    l.unlock();
 
+    // cache successful auth
+    if (auth == 1)
+        cache_set(k, std::make_tuple(auth, usr_id, usr_flags));
 
     // default auth value
     return std::make_tuple(auth, usr_id, usr_flags);
@@ -304,4 +557,10 @@ void msqlm::connect(const std::string &db_f){
     if (r)
         throw std::invalid_argument("cannot open database file");
 
+    // save db file state (cache invalidation)
+    db_file = db_f;
+    std::unique_lock<std::mutex> l(cache_mtx);
+    stat(db_file.c_str(), &db_st);
+    stat((db_file + "-wal").c_str(), &db_wal_st);
+    auth_cache.clear();
 }
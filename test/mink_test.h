@@ -0,0 +1,38 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef MINK_TEST_H
+#define MINK_TEST_H
+
+#include <cstdio>
+#include <cstdlib>
+
+// automake test driver exit code for skipped tests
+#define MINK_TEST_SKIP 77
+
+// fail test on false condition
+#define MINK_CHECK(c)                                               \
+    do {                                                            \
+        if (!(c)) {                                                 \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n",       \
+                         __FILE__, __LINE__, #c);                   \
+            std::exit(EXIT_FAILURE);                                \
+        }                                                           \
+    } while (0)
+
+// run named test case
+#define MINK_RUN(t)                                                 \
+    do {                                                            \
+        std::fprintf(stderr, "RUN  %s\n", #t);                      \
+        t();                                                        \
+        std::fprintf(stderr, "OK   %s\n", #t);                      \
+    } while (0)
+
+#endif /* ifndef MINK_TEST_H */
@@ -0,0 +1,195 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <mink_plugin.h>
+#include <mink_err_codes.h>
+#include "mink_test.h"
+
+using mink_utils::CmdExecutor;
+using mink_utils::CmdExecStats;
+
+// blocks workers until opened
+struct Gate {
+    std::mutex mtx;
+    std::condition_variable cv;
+    int entered = 0;
+    bool open = false;
+
+    void pass() {
+        std::unique_lock<std::mutex> l(mtx);
+        ++entered;
+        cv.notify_all();
+        cv.wait(l, [this] { return open; });
+    }
+    void wait_entered(int n) {
+        std::unique_lock<std::mutex> l(mtx);
+        cv.wait(l, [this, n] { return entered >= n; });
+    }
+    void release() {
+        std::unique_lock<std::mutex> l(mtx);
+        open = true;
+        cv.notify_all();
+    }
+};
+
+// open gate after executor has stopped accepting tasks (new
+// command id each time, queue full is not mistaken for stop)
+static void release_on_stop(CmdExecutor &ex, Gate &g) {
+    for (int i = 1000; ex.submit(i, [] {}) == 0; i++)
+        std::this_thread::yield();
+    g.release();
+}
+
+static CmdExecStats cmd_stats(CmdExecutor &ex, int cmd_id) {
+    std::vector<CmdExecStats> v;
+    ex.stats(v);
+    for (const auto &st : v) {
+        if (st.cmd_id == cmd_id)
+            return st;
+    }
+    return CmdExecStats();
+}
+
+// invalid parameters and state
+static void test_start() {
+    CmdExecutor ex;
+    MINK_CHECK(ex.submit(1, [] {}) == 1);
+    MINK_CHECK(ex.start(0, 1) == 1);
+    MINK_CHECK(ex.start(1, 0) == 1);
+    MINK_CHECK(ex.start(2, 1) == 0);
+    MINK_CHECK(ex.start(2, 1) == 1);
+    ex.stop();
+    MINK_CHECK(ex.submit(1, [] {}) == 1);
+}
+
+// queue is bounded per command id
+static void test_queue_bound() {
+    CmdExecutor ex;
+    Gate g;
+    std::atomic<int> done(0);
+    MINK_CHECK(ex.start(1, 2) == 0);
+    // occupy the only worker
+    MINK_CHECK(ex.submit(1, [&g, &done] { g.pass(); ++done; }) == 0);
+    g.wait_entered(1);
+    MINK_CHECK(ex.submit(1, [&done] { ++done; }) == 0);
+    MINK_CHECK(ex.submit(1, [&done] { ++done; }) == 0);
+    MINK_CHECK(ex.submit(1, [&done] { ++done; }) == 1);
+    // other command ids have their own queue
+    MINK_CHECK(ex.submit(2, [&done] { ++done; }) == 0);
+
+    CmdExecStats st = cmd_stats(ex, 1);
+    MINK_CHECK(st.depth == 2);
+    MINK_CHECK(st.active == 1);
+    MINK_CHECK(st.rejected == 1);
+
+    g.release();
+    ex.stop();
+    // stop discards queued tasks, nothing was run twice
+    MINK_CHECK(done >= 1 && done <= 4);
+}
+
+// one command id can not take every worker
+static void test_max_active() {
+    CmdExecutor ex;
+    Gate g;
+    Gate g2;
+    MINK_CHECK(ex.start(2, 8) == 0);
+    MINK_CHECK(ex.submit(1, [&g] { g.pass(); }) == 0);
+    MINK_CHECK(ex.submit(1, [&g] { g.pass(); }) == 0);
+    g.wait_entered(1);
+    // second worker is free for other commands
+    MINK_CHECK(ex.submit(2, [&g2] { g2.pass(); }) == 0);
+    g2.wait_entered(1);
+
+    CmdExecStats st = cmd_stats(ex, 1);
+    MINK_CHECK(st.active == 1);
+    MINK_CHECK(st.depth == 1);
+
+    g2.release();
+    g.release();
+    // queued task runs when first one completes
+    g.wait_entered(2);
+    ex.stop();
+}
+
+// running tasks complete, queued tasks are cancelled
+static void test_stop() {
+    CmdExecutor ex;
+    Gate g;
+    std::atomic<int> done(0);
+    std::atomic<int> cancelled(0);
+    MINK_CHECK(ex.start(1, 4) == 0);
+    MINK_CHECK(ex.submit(1, [&g, &done] { g.pass(); ++done; },
+                         [&cancelled] { ++cancelled; }) == 0);
+    g.wait_entered(1);
+    for (int i = 0; i < 3; i++) {
+        MINK_CHECK(ex.submit(1, [&done] { ++done; },
+                             [&cancelled] { ++cancelled; }) == 0);
+    }
+    // task without cancel handler
+    MINK_CHECK(ex.submit(1, [&done] { ++done; }) == 0);
+
+    // release running task while stop is waiting for it
+    std::thread th(release_on_stop, std::ref(ex), std::ref(g));
+    ex.stop();
+    th.join();
+    MINK_CHECK(done == 1);
+    MINK_CHECK(cancelled == 3);
+    MINK_CHECK(ex.submit(1, [] {}) == 1);
+    MINK_CHECK(cmd_stats(ex, 1).depth == 0);
+}
+
+// plugin manager async fallback to sync handler
+static void test_run_async() {
+    mink_utils::PluginManager pm(nullptr);
+    MINK_CHECK(pm.load(TEST_PLUGIN) != nullptr);
+    MINK_CHECK(pm.exec.start(1, 1) == 0);
+
+    Gate g;
+    std::function<int()> blk = [&g] { g.pass(); return 0; };
+    std::function<int()> ok = [] { return 5; };
+    mink_utils::PluginInputData d_blk(mink_utils::PLG_DT_SPECIFIC, &blk);
+    mink_utils::PluginInputData d_ok(mink_utils::PLG_DT_SPECIFIC, &ok);
+
+    std::atomic<int> res1(1);
+    std::atomic<int> res2(1);
+    std::atomic<int> calls3(0);
+    // unknown command
+    MINK_CHECK(pm.run_async(1, d_ok, [](int) {}) == 1);
+    // occupy worker
+    MINK_CHECK(pm.run_async(9001, d_blk, [&res1](int r) { res1 = r; }) == 0);
+    g.wait_entered(1);
+    MINK_CHECK(pm.run_async(9001, d_ok, [&res2](int r) { res2 = r; }) == 0);
+    // queue full
+    MINK_CHECK(pm.run_async(9001, d_ok, [&calls3](int r) { ++calls3; }) == mink::error::EC_BUSY);
+
+    std::thread th(release_on_stop, std::ref(pm.exec), std::ref(g));
+    pm.exec.stop();
+    th.join();
+    MINK_CHECK(res1 == 0);
+    // queued request is completed with error
+    MINK_CHECK(res2 == mink::error::EC_UNKNOWN);
+    // rejected request callback is never called
+    MINK_CHECK(calls3 == 0);
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_start);
+    MINK_RUN(test_queue_bound);
+    MINK_RUN(test_max_active);
+    MINK_RUN(test_stop);
+    MINK_RUN(test_run_async);
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <netinet/in.h>
+#include <flow_table.h>
+#include "mink_test.h"
+
+// flow record (fields used by flow table)
+struct Flow {
+    u_int32_t hashval;
+    u_int64_t last_seen_ms;
+    u_int64_t key[5];
+    u_int32_t lru_prev;
+    u_int32_t lru_next;
+    int id;
+};
+
+// freed records
+static int freed = 0;
+
+struct Flow_free {
+    void operator()(Flow *f) const { ++freed; }
+};
+
+using Table = Flow_table<Flow, Flow_free>;
+
+// unique key for flow n
+static void make_key(u_int32_t n, u_int64_t *k) {
+    Table::make_key(Table::addr4(htonl(0x0a000001)),
+                    1000 + (n & 0x7fff),
+                    Table::addr4(htonl(0x0a000002 + (n >> 15))),
+                    80,
+                    IPPROTO_TCP,
+                    0,
+                    k);
+}
+
+// key and hash of flow n
+struct Key {
+    u_int64_t k[Table::KEY_SZ];
+    u_int64_t h;
+    explicit Key(u_int32_t n) {
+        make_key(n, k);
+        h = Table::hash(k);
+    }
+    // forced hash (collisions)
+    Key(u_int32_t n, u_int64_t _h) : h(_h) { make_key(n, k); }
+};
+
+static Flow *insert(Table &t, const Key &k, int id, u_int64_t ts = 0) {
+    Flow *f = t.insert(k.k, k.h);
+    MINK_CHECK(f != nullptr);
+    f->id = id;
+    f->last_seen_ms = ts;
+    return f;
+}
+
+// both directions map to the same key
+static void test_make_key() {
+    u_int64_t k1[Table::KEY_SZ];
+    u_int64_t k2[Table::KEY_SZ];
+    const Table::Addr a = Table::addr4(htonl(0xc0a80001));
+    const Table::Addr b = Table::addr4(htonl(0x08080808));
+    int fwd1 = Table::make_key(a, 5000, b, 53, IPPROTO_UDP, 7, k1);
+    int fwd2 = Table::make_key(b, 53, a, 5000, IPPROTO_UDP, 7, k2);
+    MINK_CHECK(fwd1 != fwd2);
+    MINK_CHECK(std::equal(k1, k1 + Table::KEY_SZ, k2));
+    MINK_CHECK(Table::hash(k1) == Table::hash(k2));
+    // vlan is part of key
+    Table::make_key(a, 5000, b, 53, IPPROTO_UDP, 8, k2);
+    MINK_CHECK(!std::equal(k1, k1 + Table::KEY_SZ, k2));
+
+    // IPv4 mapped IPv6 address
+    unsigned char v6[16] = {0};
+    v6[10] = 0xff;
+    v6[11] = 0xff;
+    v6[12] = 0xc0;
+    v6[13] = 0xa8;
+    v6[15] = 0x01;
+    Table::Addr m = Table::addr6(v6);
+    MINK_CHECK(m.hi == a.hi && m.lo == a.lo);
+}
+
+// insert and find
+static void test_insert_find() {
+    freed = 0;
+    {
+        Table t(2048);
+        for (u_int32_t i = 0; i < 2000; i++)
+            insert(t, Key(i), i);
+        MINK_CHECK(t.size() == 2000);
+        for (u_int32_t i = 0; i < 2000; i++) {
+            Key k(i);
+            Flow *f = t.find(k.k, k.h);
+            MINK_CHECK(f != nullptr && f->id == (int)i);
+            MINK_CHECK(f->hashval == (u_int32_t)k.h);
+        }
+        Key m(5000);
+        MINK_CHECK(t.find(m.k, m.h) == nullptr);
+        MINK_CHECK(freed == 0);
+    }
+    // remaining flows are freed
+    MINK_CHECK(freed == 2000);
+}
+
+// backward shift delete keeps probe chains intact
+static void test_delete() {
+    Table t(64);
+    // 128 slots; clusters at the start and wrapping
+    // around the end of the table
+    std::vector<Key> keys;
+    for (u_int32_t i = 0; i < 60; i++)
+        keys.emplace_back(i, (i % 3 == 0 ? 126 : i % 3 == 1 ? 127 : 2));
+    for (u_int32_t i = 0; i < keys.size(); i++)
+        insert(t, keys[i], i);
+
+    std::vector<u_int32_t> order(keys.size());
+    for (u_int32_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::mt19937 rng(1);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<bool> removed(keys.size(), false);
+    for (u_int32_t n : order) {
+        Flow *f = t.find(keys[n].k, keys[n].h);
+        MINK_CHECK(f != nullptr && f->id == (int)n);
+        t.remove(f);
+        removed[n] = true;
+        for (u_int32_t i = 0; i < keys.size(); i++) {
+            f = t.find(keys[i].k, keys[i].h);
+            MINK_CHECK(removed[i] ? f == nullptr : (f != nullptr && f->id == (int)i));
+        }
+    }
+    MINK_CHECK(t.size() == 0);
+
+    // records are reused
+    for (u_int32_t i = 0; i < keys.size(); i++)
+        insert(t, keys[i], i);
+    MINK_CHECK(t.size() == keys.size());
+}
+
+// idle flows are expired in LRU order
+static void test_expire() {
+    freed = 0;
+    Table t(16);
+    for (u_int32_t i = 0; i < 10; i++)
+        insert(t, Key(i), i, i * 1000);
+    // flow 0 is used again
+    Key k0(0);
+    t.find(k0.k, k0.h)->last_seen_ms = 20000;
+
+    // nothing idle
+    MINK_CHECK(t.expire(Table::IDLE_TIMEOUT, Table::EXPIRE_MAX) == 0);
+    // flows 1..5 idle, at most 3 per call
+    const u_int64_t now = Table::IDLE_TIMEOUT + 5500;
+    MINK_CHECK(t.expire(now, 3) == 3);
+    MINK_CHECK(t.expire(now, 3) == 2);
+    MINK_CHECK(t.expire(now, 3) == 0);
+    MINK_CHECK(t.size() == 5);
+    MINK_CHECK(freed == 5);
+    for (u_int32_t i = 0; i < 10; i++) {
+        Key k(i);
+        MINK_CHECK((t.find(k.k, k.h) != nullptr) == (i == 0 || i > 5));
+    }
+}
+
+// LRU flow is evicted when table is full
+static void test_max_flows() {
+    freed = 0;
+    Table t(4);
+    for (u_int32_t i = 0; i < 4; i++)
+        insert(t, Key(i), i);
+    // flow 0 is used again, flow 1 is LRU
+    Key k0(0);
+    MINK_CHECK(t.find(k0.k, k0.h) != nullptr);
+    insert(t, Key(4), 4);
+    MINK_CHECK(t.size() == 4);
+    MINK_CHECK(freed == 1);
+    Key k1(1);
+    MINK_CHECK(t.find(k1.k, k1.h) == nullptr);
+    for (u_int32_t i : {0, 2, 3, 4}) {
+        Key k(i);
+        Flow *f = t.find(k.k, k.h);
+        MINK_CHECK(f != nullptr && f->id == (int)i);
+    }
+    // inserted record is zeroed
+    Flow *f = t.insert(k1.k, k1.h);
+    MINK_CHECK(f->id == 0 && f->last_seen_ms == 0);
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_make_key);
+    MINK_RUN(test_insert_find);
+    MINK_RUN(test_delete);
+    MINK_RUN(test_expire);
+    MINK_RUN(test_max_flows);
+    return 0;
+}
@@ -0,0 +1,257 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <condition_variable>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <gdt_utils.h>
+#include "mink_test.h"
+
+// test param id (unknown to idt map, sent as raw octets)
+static const uint32_t PT_DATA = 7000;
+static const std::chrono::seconds RX_TIMEOUT(5);
+
+/*******************/
+/* Receiver events */
+/*******************/
+// received param data and message completion flag
+struct Rx {
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::string data;
+    bool done = false;
+
+    void append(gdt::ServiceParam *sp) {
+        std::lock_guard<std::mutex> l(mtx);
+        data.append(reinterpret_cast<const char *>(sp->get_data()),
+                    sp->get_data_size());
+    }
+};
+
+static Rx rx;
+
+static gdt::ServiceParam *cb_sparam(gdt::GDTCallbackArgs *args) {
+    return args->get<gdt::ServiceParam>(gdt::GDT_CB_INPUT_ARGS,
+                                        gdt::GDT_CB_ARGS_SRVC_PARAM);
+}
+
+class EVParamStreamData : public gdt::GDTCallbackMethod {
+public:
+    void run(gdt::GDTCallbackArgs *args) override {
+        rx.append(cb_sparam(args));
+    }
+};
+
+class EVParamStreamNew : public gdt::GDTCallbackMethod {
+public:
+    void run(gdt::GDTCallbackArgs *args) override {
+        gdt::ServiceParam *sparam = cb_sparam(args);
+        sparam->set_callback(gdt::GDT_ET_SRVC_PARAM_STREAM_NEXT, &prm_strm_data);
+        sparam->set_callback(gdt::GDT_ET_SRVC_PARAM_STREAM_END, &prm_strm_data);
+        rx.append(sparam);
+    }
+
+    EVParamStreamData prm_strm_data;
+};
+
+class EVSrvcMsgRecv : public gdt::GDTCallbackMethod {
+public:
+    void run(gdt::GDTCallbackArgs *args) override {
+        std::lock_guard<std::mutex> l(rx.mtx);
+        rx.done = true;
+        rx.cv.notify_all();
+    }
+};
+
+class EVSrvcMsgRX : public gdt::GDTCallbackMethod {
+public:
+    void run(gdt::GDTCallbackArgs *args) override {
+        gdt::ServiceMessage *smsg = args->get<gdt::ServiceMessage>(gdt::GDT_CB_INPUT_ARGS,
+                                                                   gdt::GDT_CB_ARGS_SRVC_MSG);
+        smsg->set_callback(gdt::GDT_ET_SRVC_MSG_COMPLETE, &msg_recv);
+        smsg->set_callback(gdt::GDT_ET_SRVC_PARAM_STREAM_NEW, &prm_strm_new);
+        smsg->set_callback(gdt::GDT_ET_SRVC_SHORT_PARAM_NEW, &prm_short_new);
+    }
+
+    EVSrvcMsgRecv msg_recv;
+    EVParamStreamNew prm_strm_new;
+    EVParamStreamData prm_short_new;
+};
+
+/***********/
+/* Fixture */
+/***********/
+static gdt::ParamIdTypeMap idt_map;
+static EVSrvcMsgRX srv_msg_rx;
+static EVSrvcMsgRX cli_msg_rx;
+static gdt::ServiceMsgManager srv_smm(&idt_map, &srv_msg_rx, nullptr, 100, 1000);
+static gdt::ServiceMsgManager cli_smm(&idt_map, &cli_msg_rx, nullptr, 100, 1000);
+static gdt::GDTSession *srv_gdts = nullptr;
+static gdt::GDTSession *cli_gdts = nullptr;
+static gdt::GDTClient *gdtc = nullptr;
+
+// send single param message to server and wait for it
+static std::string send_recv(const std::string &data) {
+    {
+        std::lock_guard<std::mutex> l(rx.mtx);
+        rx.data.clear();
+        rx.done = false;
+    }
+
+    gdt::ServiceMessage *msg = cli_smm.new_smsg();
+    MINK_CHECK(msg != nullptr);
+    msg->set_service_id(asn1::ServiceId::_sid_sysagent);
+    gdt::ServiceParam *sp = cli_smm.get_param_factory()->new_param(gdt::SPT_OCTETS);
+    MINK_CHECK(sp != nullptr);
+    sp->set_data(data.data(), data.size());
+    sp->set_id(PT_DATA);
+    sp->set_index(0);
+    sp->set_extra_type(0);
+    std::vector<gdt::ServiceParam *> pmap{sp};
+    MINK_CHECK(cli_smm.vpmap_sparam_sync(msg, &pmap) == 0);
+    MINK_CHECK(cli_smm.send(msg, gdtc, "srvd", "srvd1", true) == 0);
+
+    std::unique_lock<std::mutex> l(rx.mtx);
+    MINK_CHECK(rx.cv.wait_for(l, RX_TIMEOUT, [] { return rx.done; }));
+    return rx.data;
+}
+
+static std::string text_data(std::size_t sz) {
+    std::string s;
+    while (s.size() < sz)
+        s += "{\"jsonrpc\":\"2.0\",\"method\":\"status\",\"result\":\"ok\"}\n";
+    s.resize(sz);
+    return s;
+}
+
+static std::string random_data(std::size_t sz) {
+    std::mt19937 rng(1);
+    std::string s(sz, '\0');
+    for (auto &c : s)
+        c = static_cast<char>(rng());
+    return s;
+}
+
+static uint64_t compressed() {
+    return cli_smm.stats.get(gdt::SST_TX_SPARAM_COMPRESSED);
+}
+
+/*********/
+/* Tests */
+/*********/
+// both sides advertise compression during registration
+static void test_caps_negotiated() {
+    MINK_CHECK(gdtc->has_peer_cap(gdt::GDT_CAP_COMPRESSION));
+    MINK_CHECK(gdtc->has_peer_cap(gdt::GDT_CAP_PIPELINING));
+
+    gdt::GDTClient *srv_c = nullptr;
+    for (int i = 0; (i < 100) && (srv_c == nullptr); i++) {
+        srv_c = srv_gdts->get_client(0U);
+        if (srv_c == nullptr)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    MINK_CHECK(srv_c != nullptr);
+    MINK_CHECK(srv_c->has_peer_cap(gdt::GDT_CAP_COMPRESSION));
+}
+
+// compressible param above threshold
+static void test_compressed_round_trip() {
+    const std::string data = text_data(64 * 1024);
+    uint64_t c = compressed();
+    MINK_CHECK(send_recv(data) == data);
+    MINK_CHECK(compressed() == c + 1);
+    MINK_CHECK(srv_smm.stats.get(gdt::SST_RX_SPARAM_INFLATE_ERROR) == 0);
+}
+
+// compressed size not multiple of fragment size
+static void test_compressed_odd_size() {
+    const std::string data = text_data(10 * 1024 + 17);
+    uint64_t c = compressed();
+    MINK_CHECK(send_recv(data) == data);
+    MINK_CHECK(compressed() == c + 1);
+}
+
+// incompressible data is sent as is
+static void test_incompressible() {
+    const std::string data = random_data(16 * 1024);
+    uint64_t c = compressed();
+    MINK_CHECK(send_recv(data) == data);
+    MINK_CHECK(compressed() == c);
+}
+
+// params below threshold are sent as is
+static void test_below_threshold() {
+    const std::string data = text_data(gdt::ServiceMsgManager::COMPRESSION_THRESHOLD - 1);
+    uint64_t c = compressed();
+    MINK_CHECK(send_recv(data) == data);
+    MINK_CHECK(compressed() == c);
+}
+
+// threshold 0 disables compression
+static void test_disabled() {
+    const std::string data = text_data(64 * 1024);
+    uint64_t c = compressed();
+    cli_smm.set_compression_threshold(0);
+    MINK_CHECK(send_recv(data) == data);
+    cli_smm.set_compression_threshold(gdt::ServiceMsgManager::COMPRESSION_THRESHOLD);
+    MINK_CHECK(compressed() == c);
+}
+
+// peer without compression cap (older version)
+static void test_legacy_peer() {
+    const std::string data = text_data(64 * 1024);
+    uint64_t c = compressed();
+    gdtc->set_peer_caps(gdt::GDT_CAP_NONE);
+    MINK_CHECK(send_recv(data) == data);
+    gdtc->set_peer_caps(gdt::GDT_LOCAL_CAPS);
+    MINK_CHECK(compressed() == c);
+}
+
+int main(int argc, char **argv) {
+    // server
+    srv_gdts = gdt::init_session("srvd", "srvd1", 100, 5, false, 5);
+    MINK_CHECK(srv_gdts != nullptr);
+    srv_smm.setup_server(srv_gdts, nullptr, nullptr);
+    srv_gdts->start_server("127.0.0.1", 0);
+    // SCTP not available
+    if (srv_gdts->get_server_socket() <= 0) {
+        gdt::destroy_session(srv_gdts);
+        return MINK_TEST_SKIP;
+    }
+    sockaddr_in si;
+    socklen_t si_l = sizeof(si);
+    MINK_CHECK(getsockname(srv_gdts->get_server_socket(), (sockaddr *)&si, &si_l) == 0);
+
+    // client
+    cli_gdts = gdt::init_session("clid", "clid1", 100, 5, false, 5);
+    MINK_CHECK(cli_gdts != nullptr);
+    gdtc = cli_gdts->connect("127.0.0.1", ntohs(si.sin_port), 16, nullptr, 0);
+    MINK_CHECK(gdtc != nullptr);
+    cli_smm.setup_client(gdtc);
+
+    MINK_RUN(test_caps_negotiated);
+    MINK_RUN(test_compressed_round_trip);
+    MINK_RUN(test_compressed_odd_size);
+    MINK_RUN(test_incompressible);
+    MINK_RUN(test_below_threshold);
+    MINK_RUN(test_disabled);
+    MINK_RUN(test_legacy_peer);
+
+    gdt::destroy_session(cli_gdts);
+    gdt::destroy_session(srv_gdts);
+    return 0;
+}
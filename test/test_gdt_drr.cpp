@@ -0,0 +1,185 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <vector>
+#include <memory>
+#include <gdt.h>
+#include "mink_test.h"
+
+// enough for every test case (out queue is bounded by stream count)
+static const int MAX_STREAMS = 256;
+
+// payloads are not sent, client is not connected
+static std::unique_ptr<gdt::GDTClient> new_client() {
+    return std::unique_ptr<gdt::GDTClient>(new gdt::GDTClient(-1,
+                                                              "127.0.0.1",
+                                                              0,
+                                                              "127.0.0.1",
+                                                              0,
+                                                              gdt::GDT_CD_OUTBOUND,
+                                                              MAX_STREAMS,
+                                                              5,
+                                                              5));
+}
+
+// payload pool for a single test case
+struct Payloads {
+    std::vector<std::unique_ptr<gdt::GDTPayload>> v;
+
+    gdt::GDTPayload *add(gdt::GDTPriority prio, unsigned int sz) {
+        v.emplace_back(new gdt::GDTPayload());
+        gdt::GDTPayload *p = v.back().get();
+        p->priority = prio;
+        p->raw_data_length = sz;
+        return p;
+    }
+};
+
+// number of payloads of priority class in next n scheduled payloads
+static unsigned int count_class(gdt::GDTClient *c,
+                                gdt::GDTPriority prio,
+                                unsigned int n) {
+    unsigned int res = 0;
+    for (unsigned int i = 0; i < n; i++) {
+        gdt::GDTPayload *p = c->schedule_out();
+        MINK_CHECK(p != nullptr);
+        if (p->priority == prio)
+            ++res;
+    }
+    return res;
+}
+
+// CONTROL class never waits behind queued payloads
+static void test_control_first() {
+    auto c = new_client();
+    Payloads pl;
+    for (int i = 0; i < 10; i++) {
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE)) == 0);
+    }
+    // first payload already staged
+    MINK_CHECK(c->schedule_out() != nullptr);
+
+    gdt::GDTPayload *ctrl = pl.add(gdt::GDT_PRIO_CONTROL, 64);
+    MINK_CHECK(c->push_out_queue(ctrl) == 0);
+    MINK_CHECK(c->schedule_out() == ctrl);
+}
+
+// order is preserved within priority class
+static void test_class_fifo() {
+    auto c = new_client();
+    Payloads pl;
+    std::vector<gdt::GDTPayload *> bulk;
+    for (int i = 0; i < 20; i++) {
+        bulk.push_back(pl.add(gdt::GDT_PRIO_BULK, 100 + i));
+        MINK_CHECK(c->push_out_queue(bulk.back()) == 0);
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_NORMAL, 100 + i)) == 0);
+    }
+    std::size_t next = 0;
+    for (gdt::GDTPayload *p = c->schedule_out(); p != nullptr; p = c->schedule_out()) {
+        if (p->priority == gdt::GDT_PRIO_BULK) {
+            MINK_CHECK(next < bulk.size());
+            MINK_CHECK(p == bulk[next++]);
+        }
+    }
+    MINK_CHECK(next == bulk.size());
+}
+
+// default weights, BULK gets 1/5 of bandwidth under load
+static void test_default_quantum() {
+    auto c = new_client();
+    Payloads pl;
+    for (int i = 0; i < 100; i++) {
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE)) == 0);
+    }
+    // skip first round (initial staging)
+    count_class(c.get(), gdt::GDT_PRIO_BULK, 5);
+    // 10 full rounds
+    MINK_CHECK(count_class(c.get(), gdt::GDT_PRIO_BULK, 50) == 10);
+}
+
+// quantum follows configured weights
+static void test_weights() {
+    auto c = new_client();
+    Payloads pl;
+    c->set_prio_weight(gdt::GDT_PRIO_NORMAL, 1);
+    c->set_prio_weight(gdt::GDT_PRIO_BULK, 1);
+    for (int i = 0; i < 100; i++) {
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE)) == 0);
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+    }
+    count_class(c.get(), gdt::GDT_PRIO_BULK, 2);
+    MINK_CHECK(count_class(c.get(), gdt::GDT_PRIO_BULK, 40) == 20);
+
+    // weight 0 is treated as 1
+    auto c2 = new_client();
+    Payloads pl2;
+    c2->set_prio_weight(gdt::GDT_PRIO_NORMAL, 3);
+    c2->set_prio_weight(gdt::GDT_PRIO_BULK, 0);
+    for (int i = 0; i < 100; i++) {
+        MINK_CHECK(c2->push_out_queue(pl2.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE)) == 0);
+        MINK_CHECK(c2->push_out_queue(pl2.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+    }
+    count_class(c2.get(), gdt::GDT_PRIO_BULK, 4);
+    MINK_CHECK(count_class(c2.get(), gdt::GDT_PRIO_BULK, 40) == 10);
+}
+
+// quantum is in bytes, small payloads get more turns
+static void test_byte_quantum() {
+    auto c = new_client();
+    Payloads pl;
+    c->set_prio_weight(gdt::GDT_PRIO_NORMAL, 1);
+    c->set_prio_weight(gdt::GDT_PRIO_BULK, 1);
+    for (int i = 0; i < 100; i++) {
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE / 4)) == 0);
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+    }
+    count_class(c.get(), gdt::GDT_PRIO_BULK, 5);
+    // 4 NORMAL payloads per BULK payload
+    MINK_CHECK(count_class(c.get(), gdt::GDT_PRIO_BULK, 50) == 10);
+}
+
+// NORMAL payload does not wait behind queued BULK burst
+static void test_bulk_burst() {
+    auto c = new_client();
+    Payloads pl;
+    for (int i = 0; i < 100; i++)
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+    MINK_CHECK(c->schedule_out()->priority == gdt::GDT_PRIO_BULK);
+
+    gdt::GDTPayload *n = pl.add(gdt::GDT_PRIO_NORMAL, gdt::MEM_CSIZE);
+    MINK_CHECK(c->push_out_queue(n) == 0);
+    gdt::GDTPayload *p = c->schedule_out();
+    if (p != n)
+        p = c->schedule_out();
+    MINK_CHECK(p == n);
+}
+
+// idle class does not limit active class
+static void test_work_conserving() {
+    auto c = new_client();
+    Payloads pl;
+    for (int i = 0; i < 50; i++)
+        MINK_CHECK(c->push_out_queue(pl.add(gdt::GDT_PRIO_BULK, gdt::MEM_CSIZE)) == 0);
+    MINK_CHECK(count_class(c.get(), gdt::GDT_PRIO_BULK, 50) == 50);
+    MINK_CHECK(c->schedule_out() == nullptr);
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_control_first);
+    MINK_RUN(test_class_fifo);
+    MINK_RUN(test_default_quantum);
+    MINK_RUN(test_weights);
+    MINK_RUN(test_byte_quantum);
+    MINK_RUN(test_bulk_burst);
+    MINK_RUN(test_work_conserving);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <json_rpc.h>
+#include "mink_test.h"
+
+using json_rpc::JsonRpcWriter;
+
+struct Item {
+    std::string name;
+    std::string val;
+    int idx;
+};
+
+// serialize reply with selected encoding
+static std::string write(int id,
+                         const std::vector<Item> &items,
+                         json_rpc::Encoding enc) {
+    std::string out;
+    JsonRpcWriter w(out, enc);
+    w.begin_result(id);
+    for (const auto &it : items)
+        w.add_item(it.name, it.val.data(), it.val.size(), it.idx);
+    w.end_result();
+    return out;
+}
+
+// check reply layout
+static void check_reply(const json &j, int id, const std::vector<Item> &items) {
+    MINK_CHECK(!j.is_discarded());
+    MINK_CHECK(j.at("jsonrpc") == "2.0");
+    MINK_CHECK(j.at("id") == id);
+    const json &r = j.at("result");
+    MINK_CHECK(r.is_array());
+    MINK_CHECK(r.size() == items.size());
+    for (std::size_t i = 0; i < items.size(); i++) {
+        MINK_CHECK(r[i].at("idx") == items[i].idx);
+        MINK_CHECK(r[i].at(items[i].name) == items[i].val);
+    }
+}
+
+// CBOR and JSON writers produce the same reply
+static void test_round_trip() {
+    const std::vector<Item> items = {
+        {"uptime", "12345", 0},
+        {"hostname", "mink-node-1", 1},
+        {"quote", "\"a\\b\"\n\t\x01", 2},
+        {"utf8", "\xc5\xa1\xe2\x82\xac\xf0\x9f\x98\x80", 3},
+        {"empty", "", 4},
+        {"neg", "-1", -7}
+    };
+    for (int id : {0, 1, 23, 24, 255, 256, 65535, 65536, -1, -25, 2147483647}) {
+        std::string c = write(id, items, json_rpc::ENC_CBOR);
+        std::string t = write(id, items, json_rpc::ENC_JSON);
+        json jc = json_rpc::decode(c.data(), c.size(), json_rpc::ENC_CBOR);
+        json jt = json_rpc::decode(t.data(), t.size(), json_rpc::ENC_JSON);
+        check_reply(jc, id, items);
+        check_reply(jt, id, items);
+        MINK_CHECK(jc == jt);
+        MINK_CHECK(json_rpc::detect_encoding(c.data(), c.size()) == json_rpc::ENC_CBOR);
+        MINK_CHECK(json_rpc::detect_encoding(t.data(), t.size()) == json_rpc::ENC_JSON);
+    }
+}
+
+// empty result array
+static void test_empty_result() {
+    std::string c = write(5, {}, json_rpc::ENC_CBOR);
+    check_reply(json_rpc::decode(c.data(), c.size(), json_rpc::ENC_CBOR), 5, {});
+    std::string t = write(5, {}, json_rpc::ENC_JSON);
+    check_reply(json_rpc::decode(t.data(), t.size(), json_rpc::ENC_JSON), 5, {});
+}
+
+// values longer than 1 and 2 byte length argument
+static void test_long_values() {
+    const std::vector<Item> items = {
+        {"a", std::string(200, 'a'), 0},
+        {"b", std::string(70000, 'b'), 1}
+    };
+    std::string c = write(1, items, json_rpc::ENC_CBOR);
+    check_reply(json_rpc::decode(c.data(), c.size(), json_rpc::ENC_CBOR), 1, items);
+}
+
+// invalid UTF-8 is sent as CBOR byte string (JSON text
+// replaces it with U+FFFD)
+static void test_binary_value() {
+    const std::string bin("\x00\xff\xfe\x80", 4);
+    const std::vector<Item> items = {{"bin", bin, 0}};
+
+    std::string c = write(1, items, json_rpc::ENC_CBOR);
+    json jc = json_rpc::decode(c.data(), c.size(), json_rpc::ENC_CBOR);
+    MINK_CHECK(!jc.is_discarded());
+    const json &v = jc.at("result")[0].at("bin");
+    MINK_CHECK(v.is_binary());
+    MINK_CHECK(std::string(v.get_binary().begin(), v.get_binary().end()) == bin);
+
+    std::string t = write(1, items, json_rpc::ENC_JSON);
+    json jt = json_rpc::decode(t.data(), t.size(), json_rpc::ENC_JSON);
+    MINK_CHECK(!jt.is_discarded());
+    MINK_CHECK(jt.at("result")[0].at("bin") == std::string("\x00\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd", 10));
+}
+
+// integer head encoding at argument size boundaries
+static void test_cbor_int() {
+    const std::vector<int64_t> vals = {
+        0, 23, 24, 255, 256, 65535, 65536, 4294967295LL, 4294967296LL,
+        INT64_MAX, -1, -24, -25, -256, -257, -65537, INT64_MIN
+    };
+    for (int64_t v : vals) {
+        std::string out;
+        JsonRpcWriter::cbor_int(out, v);
+        json j = json_rpc::decode(out.data(), out.size(), json_rpc::ENC_CBOR);
+        MINK_CHECK(!j.is_discarded());
+        MINK_CHECK(j.get<int64_t>() == v);
+    }
+    // shortest form
+    std::string out;
+    JsonRpcWriter::cbor_int(out, 23);
+    MINK_CHECK(out.size() == 1);
+    out.clear();
+    JsonRpcWriter::cbor_int(out, 24);
+    MINK_CHECK(out.size() == 2);
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_round_trip);
+    MINK_RUN(test_empty_result);
+    MINK_RUN(test_long_values);
+    MINK_RUN(test_binary_value);
+    MINK_RUN(test_cbor_int);
+    return 0;
+}
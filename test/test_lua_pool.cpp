@@ -0,0 +1,156 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <lua_state_pool.h>
+#include "mink_test.h"
+
+// first argument selects action; "taint" changes shared
+// tables, "check" reports first change still visible
+static const char *SCRIPT = R"(
+local mode = ...
+if mode == "taint" then
+    x = 1
+    _G.leak = 1
+    _G.print = nil
+    string.upper = nil
+    table.extra = 1
+    package.loaded.fake = {}
+    local smt = getmetatable("")
+    smt.__add = function() return 0 end
+    smt.__index = nil
+    setmetatable(_G, { __index = function() return 1 end })
+    return "tainted"
+end
+if x ~= nil then return "env" end
+if leak ~= nil then return "global" end
+if undefined_name ~= nil then return "global metatable" end
+if print == nil then return "removed global" end
+if string.upper == nil or table.extra ~= nil then return "library" end
+if package.loaded.fake ~= nil then return "package.loaded" end
+if getmetatable("").__add ~= nil then return "string metatable" end
+if ("a"):upper() ~= "A" then return "string methods" end
+return "clean"
+)";
+
+// test script file
+static std::string path;
+
+// write script to file
+static void write_script(const std::string &p, const std::string &src) {
+    int fd = open(p.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    MINK_CHECK(fd >= 0);
+    MINK_CHECK(write(fd, src.data(), src.size()) == static_cast<ssize_t>(src.size()));
+    close(fd);
+}
+
+// run script once with pooled state
+static std::string call(Lua_state_pool &pool,
+                        const char *mode,
+                        lua_State **L = nullptr) {
+    Lua_state_pool::State st;
+    std::string err;
+    MINK_CHECK(pool.acquire(path, st, err) == 0);
+    if (L)
+        *L = st.L;
+    Lua_state_pool::push_chunk(st.L);
+    lua_pushstring(st.L, mode);
+    MINK_CHECK(lua_pcall(st.L, 1, 1, 0) == 0);
+    std::string res = (lua_isstring(st.L, -1) ? lua_tostring(st.L, -1) : "");
+    pool.release(path, st);
+    return res;
+}
+
+// changes made by one call are not visible to the next one
+static void test_isolation() {
+    Lua_state_pool pool;
+    lua_State *L1 = nullptr;
+    lua_State *L2 = nullptr;
+    MINK_CHECK(call(pool, "check", &L1) == "clean");
+    MINK_CHECK(call(pool, "taint", &L2) == "tainted");
+    // same warm state was reused
+    MINK_CHECK(L1 == L2);
+    MINK_CHECK(call(pool, "check", &L2) == "clean");
+    MINK_CHECK(L1 == L2);
+    // repeated use
+    for (int i = 0; i < 100; i++) {
+        MINK_CHECK(call(pool, "taint") == "tainted");
+        MINK_CHECK(call(pool, "check") == "clean");
+    }
+}
+
+// concurrent calls get separate states
+static void test_separate_states() {
+    Lua_state_pool pool;
+    Lua_state_pool::State st1;
+    Lua_state_pool::State st2;
+    std::string err;
+    MINK_CHECK(pool.acquire(path, st1, err) == 0);
+    MINK_CHECK(pool.acquire(path, st2, err) == 0);
+    MINK_CHECK(st1.L != st2.L);
+    pool.release(path, st1);
+    pool.release(path, st2);
+    MINK_CHECK(call(pool, "check") == "clean");
+}
+
+// script changes are picked up (old states are dropped)
+static void test_reload() {
+    Lua_state_pool pool;
+    MINK_CHECK(call(pool, "check") == "clean");
+    write_script(path, "return \"reloaded\"");
+    // different mtime even on coarse timestamps
+    struct timespec ts[2] = { {0, UTIME_OMIT}, {1, 0} };
+    MINK_CHECK(utimensat(AT_FDCWD, path.c_str(), ts, 0) == 0);
+    // check is throttled
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(Lua_state_pool::MTIME_CHECK_MS + 100));
+    MINK_CHECK(call(pool, "check") == "reloaded");
+    write_script(path, SCRIPT);
+}
+
+// missing and invalid script
+static void test_errors() {
+    Lua_state_pool pool;
+    Lua_state_pool::State st;
+    std::string err;
+    MINK_CHECK(pool.acquire(path + ".missing", st, err) == 1);
+    MINK_CHECK(!err.empty());
+
+    const std::string bad = path + ".bad";
+    write_script(bad, "return (");
+    err.clear();
+    MINK_CHECK(pool.acquire(bad, st, err) == 1);
+    MINK_CHECK(!err.empty());
+    unlink(bad.c_str());
+}
+
+int main(int argc, char **argv) {
+    char tmpl[] = "/tmp/test_lua_pool_XXXXXX";
+    int fd = mkstemp(tmpl);
+    if (fd < 0)
+        return MINK_TEST_SKIP;
+    close(fd);
+    path = tmpl;
+    write_script(path, SCRIPT);
+
+    MINK_RUN(test_isolation);
+    MINK_RUN(test_separate_states);
+    MINK_RUN(test_reload);
+    MINK_RUN(test_errors);
+
+    unlink(tmpl);
+    return 0;
+}
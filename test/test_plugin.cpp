@@ -0,0 +1,52 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Test plugin; sync handler runs test function passed
+// as PLG_DT_SPECIFIC data (std::function<int()>)
+
+#include <functional>
+#include <mink_plugin.h>
+
+/**********************************************/
+/* list of command implemented by this plugin */
+/**********************************************/
+extern "C" constexpr int COMMANDS[] = {
+    9001,
+    9002,
+    // end of list marker
+    -1
+};
+
+/****************/
+/* init handler */
+/****************/
+extern "C" int init(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    return 0;
+}
+
+/*********************/
+/* terminate handler */
+/*********************/
+extern "C" int terminate(mink_utils::PluginManager *pm, mink_utils::PluginDescriptor *pd){
+    return 0;
+}
+
+/*******************/
+/* command handler */
+/*******************/
+extern "C" int run(mink_utils::PluginManager *pm,
+                   mink_utils::PluginDescriptor *pd,
+                   int cmd_id,
+                   mink_utils::PluginInputData &p_id){
+    if (p_id.type() != mink_utils::PLG_DT_SPECIFIC || p_id.data() == nullptr)
+        return -1;
+    auto f = static_cast<std::function<int()> *>(p_id.data());
+    return (*f)();
+}
@@ -0,0 +1,189 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string>
+#include <cstring>
+#include <mink_plugin.h>
+#include "mink_test.h"
+
+using mink_utils::PluginData;
+using mink_utils::PluginColumn;
+
+// rows and typed columns
+static void test_add() {
+    PluginData d;
+    MINK_CHECK(d.empty());
+    // no rows yet
+    MINK_CHECK(d.add(0, "k", 1) == 1);
+
+    std::size_t r0 = d.add_row();
+    std::size_t r1 = d.add_row();
+    MINK_CHECK(r0 == 0 && r1 == 1);
+    MINK_CHECK(d.size() == 2);
+    MINK_CHECK(d.add(r1, "i", 42) == 0);
+    MINK_CHECK(d.add(r1, "d", 1.5) == 0);
+    MINK_CHECK(d.add(r1, "s", "text") == 0);
+    MINK_CHECK(d.add(r1, "b", boost::string_view("\x00\x01", 2),
+                     mink_utils::PVT_BYTES) == 0);
+    // columns added to earlier row
+    MINK_CHECK(d.add(r0, "i", int64_t(-1)) == 0);
+    MINK_CHECK(d.add(r0, "s", "row0") == 0);
+    // duplicate key in row
+    MINK_CHECK(d.add(r1, "i", 7) == 1);
+    MINK_CHECK(d.add(r1, "s", "other") == 1);
+    MINK_CHECK(d.add_ref(r1, "d", "other") == 1);
+    // missing row
+    MINK_CHECK(d.add(2, "x", 1) == 1);
+
+    MINK_CHECK(d.row_size(r0) == 2);
+    MINK_CHECK(d.row_size(r1) == 4);
+    MINK_CHECK(d.row_size(2) == 0);
+
+    const PluginColumn *c = d.get(r1, 0);
+    MINK_CHECK(c && c->key == "i" && c->value.type == mink_utils::PVT_INT);
+    MINK_CHECK(c->value.i == 42);
+    c = d.find(r1, "d");
+    MINK_CHECK(c && c->value.type == mink_utils::PVT_DOUBLE && c->value.d == 1.5);
+    c = d.find(r1, "s");
+    MINK_CHECK(c && c->value.s == "text");
+    c = d.find(r1, "b");
+    MINK_CHECK(c && c->value.type == mink_utils::PVT_BYTES);
+    MINK_CHECK(c->value.s == boost::string_view("\x00\x01", 2));
+    c = d.get(r0, 1);
+    MINK_CHECK(c && c->key == "s" && c->value.s == "row0");
+    MINK_CHECK(d.get(r0, 2) == nullptr);
+    MINK_CHECK(d.find(r0, "d") == nullptr);
+    MINK_CHECK(d.find(5, "i") == nullptr);
+}
+
+// strings are copied to arena (NUL terminated)
+static void test_arena() {
+    PluginData d;
+    std::size_t r = d.add_row();
+    std::string k = "key";
+    std::string v = "value";
+    MINK_CHECK(d.add(r, k, v) == 0);
+    const PluginColumn *c = d.find(r, "key");
+    MINK_CHECK(c->key.data() != k.data());
+    MINK_CHECK(c->value.s.data() != v.data());
+    MINK_CHECK(c->value.s.data()[c->value.s.size()] == '\0');
+    // source can change
+    k[0] = 'x';
+    v[0] = 'x';
+    MINK_CHECK(c->key == "key" && c->value.s == "value");
+
+    // many values and large values (dedicated blocks)
+    for (int i = 0; i < 1000; i++) {
+        std::string kk = "k" + std::to_string(i);
+        std::string vv(i % 3 == 0 ? 2000 : i % 50, static_cast<char>('a' + i % 26));
+        MINK_CHECK(d.add(r, kk, vv) == 0);
+    }
+    for (int i = 0; i < 1000; i++) {
+        std::string vv(i % 3 == 0 ? 2000 : i % 50, static_cast<char>('a' + i % 26));
+        c = d.find(r, "k" + std::to_string(i));
+        MINK_CHECK(c && c->value.s == vv);
+        MINK_CHECK(strlen(c->value.s.data()) == vv.size());
+    }
+}
+
+// referenced data is not copied
+static void test_add_ref() {
+    static const char key[] = "ref";
+    static const char val[] = "static value";
+    PluginData d;
+    std::size_t r = d.add_row();
+    MINK_CHECK(d.add_ref(r, key, val) == 0);
+    const PluginColumn *c = d.find(r, "ref");
+    MINK_CHECK(c && c->key.data() == key && c->value.s.data() == val);
+    MINK_CHECK(d.add_ref(3, key, val) == 1);
+}
+
+// clear keeps arena usable
+static void test_clear() {
+    PluginData d;
+    for (int n = 0; n < 3; n++) {
+        std::size_t r = d.add_row();
+        for (int i = 0; i < 200; i++)
+            MINK_CHECK(d.add(r, "k" + std::to_string(i), std::string(40, 'v')) == 0);
+        MINK_CHECK(d.add(r, "big", std::string(5000, 'b')) == 0);
+        MINK_CHECK(d.row_size(r) == 201);
+        d.clear();
+        MINK_CHECK(d.empty());
+        MINK_CHECK(d.row_size(0) == 0);
+        MINK_CHECK(d.find(0, "k0") == nullptr);
+    }
+}
+
+// deep copy, copied data outlives source
+static void test_assign() {
+    static const char val[] = "referenced";
+    PluginData src;
+    std::size_t r = src.add_row();
+    src.add(r, "s", "string");
+    src.add(r, "i", 3);
+    src.add_ref(r, "ref", val);
+    r = src.add_row();
+    src.add(r, "big", std::string(3000, 'z'));
+
+    PluginData dst;
+    dst.add(dst.add_row(), "old", 1);
+    dst.assign(src);
+    // self assignment
+    dst.assign(dst);
+    src.clear();
+    src.add(src.add_row(), "s", "overwritten");
+
+    MINK_CHECK(dst.size() == 2);
+    MINK_CHECK(dst.row_size(0) == 3 && dst.row_size(1) == 1);
+    MINK_CHECK(dst.find(0, "old") == nullptr);
+    MINK_CHECK(dst.find(0, "s")->value.s == "string");
+    MINK_CHECK(dst.find(0, "i")->value.i == 3);
+    const PluginColumn *c = dst.find(0, "ref");
+    MINK_CHECK(c->value.s == val && c->value.s.data() != val);
+    MINK_CHECK(dst.find(1, "big")->value.s == std::string(3000, 'z'));
+}
+
+// Plugin_data_std adapters and stringified values
+static void test_std() {
+    mink_utils::Plugin_data_std in = {
+        {{"a", "1"}, {"b", "two"}},
+        {},
+        {{"c", std::string(2000, 'c')}}
+    };
+    PluginData d;
+    d.from_std(in);
+    MINK_CHECK(d.size() == 3);
+    MINK_CHECK(d.row_size(1) == 0);
+    mink_utils::Plugin_data_std out;
+    d.to_std(out);
+    MINK_CHECK(out == in);
+
+    PluginData t;
+    std::size_t r = t.add_row();
+    t.add(r, "i", -12);
+    t.add(r, "d", 0.5);
+    t.add(r, "s", "str");
+    t.to_std(out);
+    MINK_CHECK(out.size() == 1);
+    MINK_CHECK(out[0]["i"] == "-12");
+    MINK_CHECK(out[0]["d"] == std::to_string(0.5));
+    MINK_CHECK(out[0]["s"] == "str");
+    MINK_CHECK(mink_utils::PluginValue().str().empty());
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_add);
+    MINK_RUN(test_arena);
+    MINK_RUN(test_add_ref);
+    MINK_RUN(test_clear);
+    MINK_RUN(test_assign);
+    MINK_RUN(test_std);
+    return 0;
+}
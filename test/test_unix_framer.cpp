@@ -0,0 +1,152 @@
+/*            _       _
+ *  _ __ ___ (_)_ __ | | __
+ * | '_ ` _ \| | '_ \| |/ /
+ * | | | | | | | | | |   <
+ * |_| |_| |_|_|_| |_|_|\_\
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string>
+#include <vector>
+#include <unix_framer.h>
+#include "mink_test.h"
+
+using frames_t = std::vector<std::string>;
+
+// feed data in chunks of chunk_sz bytes
+static bool feed(Unix_framer &fr,
+                 const std::string &data,
+                 frames_t &out,
+                 std::size_t chunk_sz) {
+    for (std::size_t i = 0; i < data.size(); i += chunk_sz) {
+        std::size_t n = std::min(chunk_sz, data.size() - i);
+        if (!fr.feed(data.data() + i, n, [&out](std::string &&f) {
+                out.push_back(std::move(f));
+            }))
+            return false;
+    }
+    return true;
+}
+
+// all chunk sizes produce the same frames
+static void check_frames(const std::string &data, const frames_t &expected) {
+    for (std::size_t chunk_sz : {std::size_t(1), std::size_t(2), std::size_t(3),
+                                 std::size_t(7), data.size()}) {
+        Unix_framer fr;
+        frames_t out;
+        MINK_CHECK(feed(fr, data, out, chunk_sz));
+        MINK_CHECK(out == expected);
+        MINK_CHECK(fr.pending() == 0);
+    }
+}
+
+static std::string cbor_frame(const std::string &payload) {
+    std::string s(payload);
+    Unix_framer fr;
+    // select CBOR
+    fr.feed("\0", 1, [](std::string &&) {});
+    return fr.frame(std::move(s));
+}
+
+// JSON objects with and without newline terminator
+static void test_json_objects() {
+    const std::string a = R"({"jsonrpc":"2.0","method":"a","id":1})";
+    const std::string b = R"({"jsonrpc":"2.0","method":"b","id":2,"params":{"x":[1,{"y":2}]}})";
+    check_frames(a, {a});
+    check_frames(a + b, {a, b});
+    check_frames(a + "\n" + b + "\n", {a, b});
+    check_frames(" \r\n" + a + "\t\n\n" + b, {a, b});
+}
+
+// braces and quotes inside strings
+static void test_json_strings() {
+    const std::string a = R"({"s":"}{][","q":"\"}","e":"\\","u":"\u007d"})";
+    const std::string b = R"({"id":3})";
+    check_frames(a + b, {a, b});
+}
+
+// non-object requests, one per line
+static void test_json_lines() {
+    const std::string a = R"(["batch",1])";
+    const std::string b = "garbage";
+    check_frames(a + "\n\r\n" + b + "\r\n", {a, b + "\r"});
+    // incomplete line is buffered
+    Unix_framer fr;
+    frames_t out;
+    MINK_CHECK(feed(fr, "[1,2]", out, 5));
+    MINK_CHECK(out.empty());
+    MINK_CHECK(fr.pending() == 5);
+    MINK_CHECK(feed(fr, "\n", out, 1));
+    MINK_CHECK(out == frames_t{"[1,2]"});
+}
+
+// JSON reply is newline terminated
+static void test_json_reply() {
+    Unix_framer fr;
+    fr.feed("{}", 2, [](std::string &&) {});
+    MINK_CHECK(fr.encoding() == json_rpc::ENC_JSON);
+    MINK_CHECK(fr.frame("{\"id\":1}") == "{\"id\":1}\n");
+}
+
+// length prefixed CBOR frames
+static void test_cbor_frames() {
+    const std::string a("\xa1\x62id\x01", 5);
+    const std::string b(300, '\x61');
+    const std::string data = cbor_frame(a) + cbor_frame(b) + cbor_frame("");
+    MINK_CHECK(data.size() == 4 + a.size() + 4 + b.size() + 4);
+    MINK_CHECK(data.compare(0, 4, std::string("\0\0\0\x05", 4)) == 0);
+    check_frames(data, {a, b, ""});
+
+    Unix_framer fr;
+    frames_t out;
+    MINK_CHECK(feed(fr, data, out, data.size()));
+    MINK_CHECK(fr.encoding() == json_rpc::ENC_CBOR);
+}
+
+// oversized length prefix closes connection without
+// waiting for frame data
+static void test_cbor_too_big() {
+    const std::size_t sz = Unix_framer::MAX_FRAME_SIZE + 1;
+    std::string p;
+    for (int i = 3; i >= 0; i--)
+        p.push_back(static_cast<char>((sz >> (i * 8)) & 0xff));
+
+    Unix_framer fr;
+    frames_t out;
+    MINK_CHECK(!feed(fr, p, out, p.size()));
+    MINK_CHECK(out.empty());
+
+    // frames before oversized one are still passed
+    Unix_framer fr2;
+    MINK_CHECK(!feed(fr2, cbor_frame("\x01") + p, out, 64));
+    MINK_CHECK(out == frames_t{"\x01"});
+
+    // max size is accepted
+    Unix_framer fr3;
+    std::string m;
+    for (int i = 3; i >= 0; i--)
+        m.push_back(static_cast<char>((Unix_framer::MAX_FRAME_SIZE >> (i * 8)) & 0xff));
+    MINK_CHECK(feed(fr3, m, out, m.size()));
+}
+
+// unterminated JSON request is bounded
+static void test_json_too_big() {
+    Unix_framer fr;
+    frames_t out;
+    std::string s = "{\"a\":\"" + std::string(Unix_framer::MAX_FRAME_SIZE, 'x');
+    MINK_CHECK(!feed(fr, s, out, 65536));
+    MINK_CHECK(out.empty());
+}
+
+int main(int argc, char **argv) {
+    MINK_RUN(test_json_objects);
+    MINK_RUN(test_json_strings);
+    MINK_RUN(test_json_lines);
+    MINK_RUN(test_json_reply);
+    MINK_RUN(test_cbor_frames);
+    MINK_RUN(test_cbor_too_big);
+    MINK_RUN(test_json_too_big);
+    return 0;
+}